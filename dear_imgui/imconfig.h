@@ -63,6 +63,11 @@
 // Note that stb_sprintf.h is meant to be provided by the user and available in the include path at compile time. Also, the compatibility checks of the arguments and formats done by clang and GCC will be disabled in order to support the extra formats provided by STB sprintf.
 // #define IMGUI_USE_STB_SPRINTF
 
+//---- Use a different hash function for ImHashData()/ImHashStr(), which are used to compute all IDs (default is CRC32).
+// Those are faster than the default, but every ID value will change: Table IDs saved in .ini files won't match, same for any ID hardcoded in your code.
+//#define IMGUI_USE_HASH_CRC32C                             // Use hardware CRC32C instructions (x86 SSE4.2 or ARMv8 CRC extension, which needs to be enabled in your compiler settings).
+//#define IMGUI_USE_HASH_WYHASH                             // Use a portable wyhash-style hash (64-bit multiplications).
+
 //---- Define constructor and implicit cast operators to convert back<>forth between your math types and ImVec2/ImVec4.
 // This will be inlined as part of ImVec2 and ImVec4 class declarations.
 /*
@@ -100,6 +105,11 @@
 //---- Debug Tools: Enable slower asserts
 //#define IMGUI_DEBUG_PARANOID
 
+//---- Debug Tools: Account every MemAlloc()/MemFree() to a category (draw lists, fonts, storage, etc.), tracking live/peak bytes and allocations per frame.
+// See ImGui::MemGetTagStats(), ImGui::MemExportStats() and 'Metrics->Memory'. This adds a small header to each allocation, so any memory
+// handed over to Dear ImGui for it to free later (e.g. font data passed to AddFontFromMemoryTTF) must then be allocated with IM_ALLOC().
+//#define IMGUI_ENABLE_MEMORY_TRACKING
+
 //---- Tip: You can add extra functions within the ImGui:: namespace, here or in your own headers files.
 /*
 namespace ImGui
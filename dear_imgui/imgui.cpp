@@ -62,6 +62,7 @@ CODE
 // [SECTION] ImGuiStorage
 // [SECTION] ImGuiTextFilter
 // [SECTION] ImGuiTextBuffer
+// [SECTION] ImLinearAllocator
 // [SECTION] ImGuiListClipper
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
@@ -371,6 +372,7 @@ CODE
  When you are not sure about a old symbol or function name, try using the Search/Find function of your IDE to look for comments or references in all imgui files.
  You can read releases logs https://github.com/ocornut/imgui/releases for more details.
 
+ - 2026/10/19 (1.80) - ImGuiStorage now uses a hash table for lookups: pairs in ImGuiStorage::Data are kept in insertion order instead of being sorted by key. If you push_back() pairs into Data directly, call BuildSortByKey() afterwards (as before) if you need them sorted.
  - 2020/10/05 (1.79) - removed ImGuiListClipper: Renamed constructor parameters which created an ambiguous alternative to using the ImGuiListClipper::Begin() function, with misleading edge cases (note: imgui_memory_editor <0.40 from imgui_club/ used this old clipper API. Update your copy if needed).
  - 2020/09/25 (1.79) - renamed ImGuiSliderFlags_ClampOnInput to ImGuiSliderFlags_AlwaysClamp. Kept redirection enum (will obsolete sooner because previous name was added recently).
  - 2020/09/25 (1.79) - renamed style.TabMinWidthForUnselectedCloseButton to style.TabMinWidthForCloseButton.
@@ -812,6 +814,11 @@ static const float NAV_WINDOWING_LIST_APPEAR_DELAY          = 0.15f;    // Time
 static const float WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS = 4.0f;     // Extend outside and inside windows. Affect FindHoveredWindow().
 static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduce visual noise by only highlighting the border after a certain time.
 static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 2.00f;    // Lock scrolled window (so it doesn't pick child windows that are scrolling through) for a certain time, unless mouse moved.
+static const float WINDOWS_HIT_GRID_CELL_SIZE               = 128.0f;   // Size of the cells of g.WindowsHitGrid, used to accelerate FindHoveredWindow().
+static const int   WINDOWS_HIT_GRID_CELL_COUNT_MAX          = 64;       // Maximum number of cells on each axis (cells get larger on very large displays).
+static const int   WINDOWS_MEMORY_SHRINK_MIN_BYTES          = 16 * 1024;// Don't bother shrinking window draw buffers when it would release less than this (see io.ConfigWindowsMemoryShrinkTimer).
+static const int   ID_HASH_CACHE_MAX_ENTRIES                = 64 * 1024;// Maximum number of GetID() calls per window and per frame recorded by ImGuiIDHashCache (1.5 MB on 64-bit targets).
+static const int   ID_HASH_CACHE_MAX_STR_LEN                = 256;      // Don't memoize the hash of longer labels.
 
 //-------------------------------------------------------------------------
 // [SECTION] FORWARD DECLARATIONS
@@ -819,6 +826,9 @@ static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 2.00f;    // Lock
 
 static void             SetCurrentWindow(ImGuiWindow* window);
 static void             FindHoveredWindow();
+static void             UpdateWindowHitGridCells(ImGuiWindow* window);
+static size_t           GcUpdateTransientWindowBuffers(ImGuiWindow* window, float shrink_timer);
+static size_t           GcEnforceWindowsMemoryBudget(size_t over_budget_bytes);
 static ImGuiWindow*     CreateNewWindow(const char* name, ImGuiWindowFlags flags);
 static ImVec2           CalcNextScrollFromScrollTargetAndClamp(ImGuiWindow* window);
 
@@ -833,6 +843,8 @@ static void*            WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSetti
 static void             WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
 static void             WindowSettingsHandler_ApplyAll(ImGuiContext*, ImGuiSettingsHandler*);
 static void             WindowSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
+static void             WindowSettingsHandler_ReadBinary(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const void* data, size_t data_size);
+static void             WindowSettingsHandler_WriteAllBinary(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
 
 // Platform Dependents default implementation for IO functions
 static const char*      GetClipboardTextFn_DefaultImpl(void* user_data);
@@ -912,6 +924,25 @@ static void*  (*GImAllocatorAllocFunc)(size_t size, void* user_data) = MallocWra
 static void   (*GImAllocatorFreeFunc)(void* ptr, void* user_data) = FreeWrapper;
 static void*    GImAllocatorUserData = NULL;
 
+// Bytes held by window draw buffers summed over all contexts (each context contributes its g.GcTransientBytes), compared to io.ConfigWindowsMemoryBudget.
+static size_t   GImGcTransientBytes = 0;
+
+// Memory Tracking (see IMGUI_ENABLE_MEMORY_TRACKING in imconfig.h). Global like the allocator functions above, and not thread-safe either.
+// Each allocation is prefixed with a header recording its size and tag. The header is padded to 16 bytes to preserve the alignment given by the allocator.
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+struct ImGuiMemTrackHeader
+{
+    size_t      Size;
+    ImGuiMemTag Tag;
+};
+static const size_t     IM_MEMTRACK_HEADER_SIZE = 16;
+IM_STATIC_ASSERT(sizeof(ImGuiMemTrackHeader) <= IM_MEMTRACK_HEADER_SIZE);
+static ImGuiMemTagStats GImMemTagStats[ImGuiMemTag_COUNT];
+static ImGuiMemTag      GImMemTagCurrent = ImGuiMemTag_Misc;
+static const char*      GImMemTagNames[] = { "Misc", "Context", "DrawList", "Storage", "TextBuffer", "FontAtlas", "Pool", "Settings", "InputText", "FrameArena" };
+IM_STATIC_ASSERT(IM_ARRAYSIZE(GImMemTagNames) == ImGuiMemTag_COUNT);
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO)
 //-----------------------------------------------------------------------------
@@ -1002,6 +1033,7 @@ ImGuiIO::ImGuiIO()
     DeltaTime = 1.0f / 60.0f;
     IniSavingRate = 5.0f;
     IniFilename = "imgui.ini";
+    IniSavingBinary = false;
     LogFilename = "imgui_log.txt";
     MouseDoubleClickTime = 0.30f;
     MouseDoubleClickMaxDist = 6.0f;
@@ -1028,6 +1060,8 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigWindowsMemoryCompactTimer = 60.0f;
+    ConfigWindowsMemoryShrinkTimer = 5.0f;
+    ConfigWindowsMemoryBudget = 0;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1399,76 +1433,293 @@ int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 }
 #endif // #ifdef IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS
 
-// CRC32 needs a 1KB lookup table (not cache friendly)
-// Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
-// - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
-static const ImU32 GCrc32LookupTable[256] =
-{
-    0x00000000,0x77073096,0xEE0E612C,0x990951BA,0x076DC419,0x706AF48F,0xE963A535,0x9E6495A3,0x0EDB8832,0x79DCB8A4,0xE0D5E91E,0x97D2D988,0x09B64C2B,0x7EB17CBD,0xE7B82D07,0x90BF1D91,
-    0x1DB71064,0x6AB020F2,0xF3B97148,0x84BE41DE,0x1ADAD47D,0x6DDDE4EB,0xF4D4B551,0x83D385C7,0x136C9856,0x646BA8C0,0xFD62F97A,0x8A65C9EC,0x14015C4F,0x63066CD9,0xFA0F3D63,0x8D080DF5,
-    0x3B6E20C8,0x4C69105E,0xD56041E4,0xA2677172,0x3C03E4D1,0x4B04D447,0xD20D85FD,0xA50AB56B,0x35B5A8FA,0x42B2986C,0xDBBBC9D6,0xACBCF940,0x32D86CE3,0x45DF5C75,0xDCD60DCF,0xABD13D59,
-    0x26D930AC,0x51DE003A,0xC8D75180,0xBFD06116,0x21B4F4B5,0x56B3C423,0xCFBA9599,0xB8BDA50F,0x2802B89E,0x5F058808,0xC60CD9B2,0xB10BE924,0x2F6F7C87,0x58684C11,0xC1611DAB,0xB6662D3D,
-    0x76DC4190,0x01DB7106,0x98D220BC,0xEFD5102A,0x71B18589,0x06B6B51F,0x9FBFE4A5,0xE8B8D433,0x7807C9A2,0x0F00F934,0x9609A88E,0xE10E9818,0x7F6A0DBB,0x086D3D2D,0x91646C97,0xE6635C01,
-    0x6B6B51F4,0x1C6C6162,0x856530D8,0xF262004E,0x6C0695ED,0x1B01A57B,0x8208F4C1,0xF50FC457,0x65B0D9C6,0x12B7E950,0x8BBEB8EA,0xFCB9887C,0x62DD1DDF,0x15DA2D49,0x8CD37CF3,0xFBD44C65,
-    0x4DB26158,0x3AB551CE,0xA3BC0074,0xD4BB30E2,0x4ADFA541,0x3DD895D7,0xA4D1C46D,0xD3D6F4FB,0x4369E96A,0x346ED9FC,0xAD678846,0xDA60B8D0,0x44042D73,0x33031DE5,0xAA0A4C5F,0xDD0D7CC9,
-    0x5005713C,0x270241AA,0xBE0B1010,0xC90C2086,0x5768B525,0x206F85B3,0xB966D409,0xCE61E49F,0x5EDEF90E,0x29D9C998,0xB0D09822,0xC7D7A8B4,0x59B33D17,0x2EB40D81,0xB7BD5C3B,0xC0BA6CAD,
-    0xEDB88320,0x9ABFB3B6,0x03B6E20C,0x74B1D29A,0xEAD54739,0x9DD277AF,0x04DB2615,0x73DC1683,0xE3630B12,0x94643B84,0x0D6D6A3E,0x7A6A5AA8,0xE40ECF0B,0x9309FF9D,0x0A00AE27,0x7D079EB1,
-    0xF00F9344,0x8708A3D2,0x1E01F268,0x6906C2FE,0xF762575D,0x806567CB,0x196C3671,0x6E6B06E7,0xFED41B76,0x89D32BE0,0x10DA7A5A,0x67DD4ACC,0xF9B9DF6F,0x8EBEEFF9,0x17B7BE43,0x60B08ED5,
-    0xD6D6A3E8,0xA1D1937E,0x38D8C2C4,0x4FDFF252,0xD1BB67F1,0xA6BC5767,0x3FB506DD,0x48B2364B,0xD80D2BDA,0xAF0A1B4C,0x36034AF6,0x41047A60,0xDF60EFC3,0xA867DF55,0x316E8EEF,0x4669BE79,
-    0xCB61B38C,0xBC66831A,0x256FD2A0,0x5268E236,0xCC0C7795,0xBB0B4703,0x220216B9,0x5505262F,0xC5BA3BBE,0xB2BD0B28,0x2BB45A92,0x5CB36A04,0xC2D7FFA7,0xB5D0CF31,0x2CD99E8B,0x5BDEAE1D,
-    0x9B64C2B0,0xEC63F226,0x756AA39C,0x026D930A,0x9C0906A9,0xEB0E363F,0x72076785,0x05005713,0x95BF4A82,0xE2B87A14,0x7BB12BAE,0x0CB61B38,0x92D28E9B,0xE5D5BE0D,0x7CDCEFB7,0x0BDBDF21,
-    0x86D3D2D4,0xF1D4E242,0x68DDB3F8,0x1FDA836E,0x81BE16CD,0xF6B9265B,0x6FB077E1,0x18B74777,0x88085AE6,0xFF0F6A70,0x66063BCA,0x11010B5C,0x8F659EFF,0xF862AE69,0x616BFFD3,0x166CCF45,
-    0xA00AE278,0xD70DD2EE,0x4E048354,0x3903B3C2,0xA7672661,0xD06016F7,0x4969474D,0x3E6E77DB,0xAED16A4A,0xD9D65ADC,0x40DF0B66,0x37D83BF0,0xA9BCAE53,0xDEBB9EC5,0x47B2CF7F,0x30B5FFE9,
-    0xBDBDF21C,0xCABAC28A,0x53B39330,0x24B4A3A6,0xBAD03605,0xCDD70693,0x54DE5729,0x23D967BF,0xB3667A2E,0xC4614AB8,0x5D681B02,0x2A6F2B94,0xB40BBE37,0xC30C8EA1,0x5A05DF1B,0x2D02EF8D,
-};
+// Hash functions used for ID computation: ImHashData() for known size data, ImHashStr() for labels (with support for the ### operator).
+// The hash function is selected at compile-time (see imconfig.h). All of them produce well distributed 32-bit values, but they
+// produce different values for the same input, so e.g. table IDs stored in .ini files will not carry over when switching.
+// - Default: CRC32 (same values as every previous version), processed 4 bytes at a time with 4 lookup tables ("slice-by-4").
+// - IMGUI_USE_HASH_CRC32C: CRC32C using hardware instructions (x86 SSE4.2 or ARMv8 CRC extension).
+// - IMGUI_USE_HASH_WYHASH: portable wyhash-style hash based on 64x64->128 bits multiplications.
+// misc/benchmarks/hash.cpp measures the selected hash against the byte-per-byte CRC32 of 1.79 and earlier, checks that the CRC
+// hashes give the same IDs as it, and counts collisions. Labels are short (~11 characters), so slicing by 8 instead of 4
+// would barely help and would double the size of the tables.
+#if defined(IMGUI_USE_HASH_CRC32C) && defined(IMGUI_USE_HASH_WYHASH)
+#error "Define only one of IMGUI_USE_HASH_CRC32C or IMGUI_USE_HASH_WYHASH."
+#endif
 
-// Known size hash
-// It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
-ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
+static inline ImU32 ImReadU32(const unsigned char* p)  { ImU32 v; memcpy(&v, p, sizeof(v)); return v; }   // Unaligned read, native endianness
+static inline ImU64 ImReadU64(const unsigned char* p)  { ImU64 v; memcpy(&v, p, sizeof(v)); return v; }
+
+#if defined(IMGUI_USE_HASH_CRC32C)
+
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+static inline ImU32 ImHashBytes(const unsigned char* data, size_t data_size, ImU32 seed)
 {
     ImU32 crc = ~seed;
-    const unsigned char* data = (const unsigned char*)data_p;
-    const ImU32* crc32_lut = GCrc32LookupTable;
+    for (; data_size >= 8; data += 8, data_size -= 8)
+        crc = __crc32cd(crc, ImReadU64(data));
+    if (data_size >= 4) { crc = __crc32cw(crc, ImReadU32(data)); data += 4; data_size -= 4; }
     while (data_size-- != 0)
-        crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
+        crc = __crc32cb(crc, *data++);
     return ~crc;
 }
 
-// Zero-terminated string hash, with support for ### to reset back to seed value
-// We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
-// Because this syntax is rarely used we are optimizing for the common case.
-// - If we reach ### in the string we discard the hash so far and reset to the seed.
-// - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
-ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
+static inline ImU32 ImHashZeroes(ImU32 crc, size_t zeroes_count)
+{
+    for (; zeroes_count >= 8; zeroes_count -= 8)
+        crc = __crc32cd(crc, 0);
+    if (zeroes_count >= 4) { crc = __crc32cw(crc, 0); zeroes_count -= 4; }
+    while (zeroes_count-- != 0)
+        crc = __crc32cb(crc, 0);
+    return crc;
+}
+#elif defined(__SSE4_2__) || defined(_MSC_VER)
+#include <nmmintrin.h>
+static inline ImU32 ImHashBytes(const unsigned char* data, size_t data_size, ImU32 seed)
+{
+    ImU32 crc = ~seed;
+#if defined(__x86_64__) || defined(_M_X64)
+    for (; data_size >= 8; data += 8, data_size -= 8)
+        crc = (ImU32)_mm_crc32_u64(crc, ImReadU64(data));
+#endif
+    for (; data_size >= 4; data += 4, data_size -= 4)
+        crc = _mm_crc32_u32(crc, ImReadU32(data));
+    while (data_size-- != 0)
+        crc = _mm_crc32_u8(crc, *data++);
+    return ~crc;
+}
+
+static inline ImU32 ImHashZeroes(ImU32 crc, size_t zeroes_count)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    for (; zeroes_count >= 8; zeroes_count -= 8)
+        crc = (ImU32)_mm_crc32_u64(crc, 0);
+#endif
+    for (; zeroes_count >= 4; zeroes_count -= 4)
+        crc = _mm_crc32_u32(crc, 0);
+    while (zeroes_count-- != 0)
+        crc = _mm_crc32_u8(crc, 0);
+    return crc;
+}
+#else
+#error "IMGUI_USE_HASH_CRC32C requires hardware CRC32C support (e.g. compile with -msse4.2 on x86 or -march=armv8-a+crc on ARM)."
+#endif
+
+#elif defined(IMGUI_USE_HASH_WYHASH)
+
+// Multiply 64x64->128 bits and fold the result back into 64 bits
+static inline ImU64 ImHashMix(ImU64 a, ImU64 b)
 {
-    seed = ~seed;
-    ImU32 crc = seed;
-    const unsigned char* data = (const unsigned char*)data_p;
-    const ImU32* crc32_lut = GCrc32LookupTable;
-    if (data_size != 0)
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = (__uint128_t)a * b;
+    return (ImU64)(r >> 64) ^ (ImU64)r;
+#else
+    ImU64 a_lo = (ImU32)a, a_hi = a >> 32, b_lo = (ImU32)b, b_hi = b >> 32;
+    ImU64 lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo, lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+    ImU64 cross = (lo_lo >> 32) + (ImU32)hi_lo + lo_hi;
+    ImU64 hi = hi_hi + (hi_lo >> 32) + (cross >> 32);
+    ImU64 lo = (cross << 32) | (ImU32)lo_lo;
+    return hi ^ lo;
+#endif
+}
+
+static inline ImU32 ImHashBytes(const unsigned char* data, size_t data_size, ImU32 seed)
+{
+    const ImU64 secret0 = 0xA0761D6478BD642FULL, secret1 = 0xE7037ED1A0B428DBULL;
+    ImU64 state = seed ^ secret0;
+    ImU64 a, b;
+    if (data_size <= 16)
     {
-        while (data_size-- != 0)
+        if (data_size >= 4)
+        {
+            // Two possibly overlapping pairs of 4 bytes reads cover anything between 4 and 16 bytes
+            const size_t off = (data_size >> 3) << 2;
+            a = ((ImU64)ImReadU32(data) << 32) | ImReadU32(data + off);
+            b = ((ImU64)ImReadU32(data + data_size - 4) << 32) | ImReadU32(data + data_size - 4 - off);
+        }
+        else if (data_size > 0)
+        {
+            a = ((ImU64)data[0] << 16) | ((ImU64)data[data_size >> 1] << 8) | data[data_size - 1];
+            b = 0;
+        }
+        else
         {
-            unsigned char c = *data++;
-            if (c == '#' && data_size >= 2 && data[0] == '#' && data[1] == '#')
-                crc = seed;
-            crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
+            a = b = 0;
         }
     }
     else
     {
-        while (unsigned char c = *data++)
-        {
-            if (c == '#' && data[0] == '#' && data[1] == '#')
-                crc = seed;
-            crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
-        }
+        size_t remaining = data_size;
+        for (; remaining > 16; data += 16, remaining -= 16)
+            state = ImHashMix(ImReadU64(data) ^ secret1, ImReadU64(data + 8) ^ state);
+        a = ImReadU64(data + remaining - 16);
+        b = ImReadU64(data + remaining - 8);
     }
+    const ImU64 h = ImHashMix(secret1 ^ data_size, ImHashMix(a ^ secret1, b ^ state));
+    return (ImU32)(h ^ (h >> 32));
+}
+
+#else
+
+// CRC32 needs a 1KB lookup table per slice (not cache friendly, slice-by-4 taps into 4KB)
+// Although the code to generate the tables is simple and shorter than the tables themselves, using const tables allows us to easily:
+// - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
+// GCrc32LookupTable[0] is the regular CRC32 table, GCrc32LookupTable[n][i] advances GCrc32LookupTable[n-1][i] by one more zero byte.
+static const ImU32 GCrc32LookupTable[4][256] =
+{
+    {
+        0x00000000,0x77073096,0xEE0E612C,0x990951BA,0x076DC419,0x706AF48F,0xE963A535,0x9E6495A3,0x0EDB8832,0x79DCB8A4,0xE0D5E91E,0x97D2D988,0x09B64C2B,0x7EB17CBD,0xE7B82D07,0x90BF1D91,
+        0x1DB71064,0x6AB020F2,0xF3B97148,0x84BE41DE,0x1ADAD47D,0x6DDDE4EB,0xF4D4B551,0x83D385C7,0x136C9856,0x646BA8C0,0xFD62F97A,0x8A65C9EC,0x14015C4F,0x63066CD9,0xFA0F3D63,0x8D080DF5,
+        0x3B6E20C8,0x4C69105E,0xD56041E4,0xA2677172,0x3C03E4D1,0x4B04D447,0xD20D85FD,0xA50AB56B,0x35B5A8FA,0x42B2986C,0xDBBBC9D6,0xACBCF940,0x32D86CE3,0x45DF5C75,0xDCD60DCF,0xABD13D59,
+        0x26D930AC,0x51DE003A,0xC8D75180,0xBFD06116,0x21B4F4B5,0x56B3C423,0xCFBA9599,0xB8BDA50F,0x2802B89E,0x5F058808,0xC60CD9B2,0xB10BE924,0x2F6F7C87,0x58684C11,0xC1611DAB,0xB6662D3D,
+        0x76DC4190,0x01DB7106,0x98D220BC,0xEFD5102A,0x71B18589,0x06B6B51F,0x9FBFE4A5,0xE8B8D433,0x7807C9A2,0x0F00F934,0x9609A88E,0xE10E9818,0x7F6A0DBB,0x086D3D2D,0x91646C97,0xE6635C01,
+        0x6B6B51F4,0x1C6C6162,0x856530D8,0xF262004E,0x6C0695ED,0x1B01A57B,0x8208F4C1,0xF50FC457,0x65B0D9C6,0x12B7E950,0x8BBEB8EA,0xFCB9887C,0x62DD1DDF,0x15DA2D49,0x8CD37CF3,0xFBD44C65,
+        0x4DB26158,0x3AB551CE,0xA3BC0074,0xD4BB30E2,0x4ADFA541,0x3DD895D7,0xA4D1C46D,0xD3D6F4FB,0x4369E96A,0x346ED9FC,0xAD678846,0xDA60B8D0,0x44042D73,0x33031DE5,0xAA0A4C5F,0xDD0D7CC9,
+        0x5005713C,0x270241AA,0xBE0B1010,0xC90C2086,0x5768B525,0x206F85B3,0xB966D409,0xCE61E49F,0x5EDEF90E,0x29D9C998,0xB0D09822,0xC7D7A8B4,0x59B33D17,0x2EB40D81,0xB7BD5C3B,0xC0BA6CAD,
+        0xEDB88320,0x9ABFB3B6,0x03B6E20C,0x74B1D29A,0xEAD54739,0x9DD277AF,0x04DB2615,0x73DC1683,0xE3630B12,0x94643B84,0x0D6D6A3E,0x7A6A5AA8,0xE40ECF0B,0x9309FF9D,0x0A00AE27,0x7D079EB1,
+        0xF00F9344,0x8708A3D2,0x1E01F268,0x6906C2FE,0xF762575D,0x806567CB,0x196C3671,0x6E6B06E7,0xFED41B76,0x89D32BE0,0x10DA7A5A,0x67DD4ACC,0xF9B9DF6F,0x8EBEEFF9,0x17B7BE43,0x60B08ED5,
+        0xD6D6A3E8,0xA1D1937E,0x38D8C2C4,0x4FDFF252,0xD1BB67F1,0xA6BC5767,0x3FB506DD,0x48B2364B,0xD80D2BDA,0xAF0A1B4C,0x36034AF6,0x41047A60,0xDF60EFC3,0xA867DF55,0x316E8EEF,0x4669BE79,
+        0xCB61B38C,0xBC66831A,0x256FD2A0,0x5268E236,0xCC0C7795,0xBB0B4703,0x220216B9,0x5505262F,0xC5BA3BBE,0xB2BD0B28,0x2BB45A92,0x5CB36A04,0xC2D7FFA7,0xB5D0CF31,0x2CD99E8B,0x5BDEAE1D,
+        0x9B64C2B0,0xEC63F226,0x756AA39C,0x026D930A,0x9C0906A9,0xEB0E363F,0x72076785,0x05005713,0x95BF4A82,0xE2B87A14,0x7BB12BAE,0x0CB61B38,0x92D28E9B,0xE5D5BE0D,0x7CDCEFB7,0x0BDBDF21,
+        0x86D3D2D4,0xF1D4E242,0x68DDB3F8,0x1FDA836E,0x81BE16CD,0xF6B9265B,0x6FB077E1,0x18B74777,0x88085AE6,0xFF0F6A70,0x66063BCA,0x11010B5C,0x8F659EFF,0xF862AE69,0x616BFFD3,0x166CCF45,
+        0xA00AE278,0xD70DD2EE,0x4E048354,0x3903B3C2,0xA7672661,0xD06016F7,0x4969474D,0x3E6E77DB,0xAED16A4A,0xD9D65ADC,0x40DF0B66,0x37D83BF0,0xA9BCAE53,0xDEBB9EC5,0x47B2CF7F,0x30B5FFE9,
+        0xBDBDF21C,0xCABAC28A,0x53B39330,0x24B4A3A6,0xBAD03605,0xCDD70693,0x54DE5729,0x23D967BF,0xB3667A2E,0xC4614AB8,0x5D681B02,0x2A6F2B94,0xB40BBE37,0xC30C8EA1,0x5A05DF1B,0x2D02EF8D,
+    },
+    {
+        0x00000000,0x191B3141,0x32366282,0x2B2D53C3,0x646CC504,0x7D77F445,0x565AA786,0x4F4196C7,0xC8D98A08,0xD1C2BB49,0xFAEFE88A,0xE3F4D9CB,0xACB54F0C,0xB5AE7E4D,0x9E832D8E,0x87981CCF,
+        0x4AC21251,0x53D92310,0x78F470D3,0x61EF4192,0x2EAED755,0x37B5E614,0x1C98B5D7,0x05838496,0x821B9859,0x9B00A918,0xB02DFADB,0xA936CB9A,0xE6775D5D,0xFF6C6C1C,0xD4413FDF,0xCD5A0E9E,
+        0x958424A2,0x8C9F15E3,0xA7B24620,0xBEA97761,0xF1E8E1A6,0xE8F3D0E7,0xC3DE8324,0xDAC5B265,0x5D5DAEAA,0x44469FEB,0x6F6BCC28,0x7670FD69,0x39316BAE,0x202A5AEF,0x0B07092C,0x121C386D,
+        0xDF4636F3,0xC65D07B2,0xED705471,0xF46B6530,0xBB2AF3F7,0xA231C2B6,0x891C9175,0x9007A034,0x179FBCFB,0x0E848DBA,0x25A9DE79,0x3CB2EF38,0x73F379FF,0x6AE848BE,0x41C51B7D,0x58DE2A3C,
+        0xF0794F05,0xE9627E44,0xC24F2D87,0xDB541CC6,0x94158A01,0x8D0EBB40,0xA623E883,0xBF38D9C2,0x38A0C50D,0x21BBF44C,0x0A96A78F,0x138D96CE,0x5CCC0009,0x45D73148,0x6EFA628B,0x77E153CA,
+        0xBABB5D54,0xA3A06C15,0x888D3FD6,0x91960E97,0xDED79850,0xC7CCA911,0xECE1FAD2,0xF5FACB93,0x7262D75C,0x6B79E61D,0x4054B5DE,0x594F849F,0x160E1258,0x0F152319,0x243870DA,0x3D23419B,
+        0x65FD6BA7,0x7CE65AE6,0x57CB0925,0x4ED03864,0x0191AEA3,0x188A9FE2,0x33A7CC21,0x2ABCFD60,0xAD24E1AF,0xB43FD0EE,0x9F12832D,0x8609B26C,0xC94824AB,0xD05315EA,0xFB7E4629,0xE2657768,
+        0x2F3F79F6,0x362448B7,0x1D091B74,0x04122A35,0x4B53BCF2,0x52488DB3,0x7965DE70,0x607EEF31,0xE7E6F3FE,0xFEFDC2BF,0xD5D0917C,0xCCCBA03D,0x838A36FA,0x9A9107BB,0xB1BC5478,0xA8A76539,
+        0x3B83984B,0x2298A90A,0x09B5FAC9,0x10AECB88,0x5FEF5D4F,0x46F46C0E,0x6DD93FCD,0x74C20E8C,0xF35A1243,0xEA412302,0xC16C70C1,0xD8774180,0x9736D747,0x8E2DE606,0xA500B5C5,0xBC1B8484,
+        0x71418A1A,0x685ABB5B,0x4377E898,0x5A6CD9D9,0x152D4F1E,0x0C367E5F,0x271B2D9C,0x3E001CDD,0xB9980012,0xA0833153,0x8BAE6290,0x92B553D1,0xDDF4C516,0xC4EFF457,0xEFC2A794,0xF6D996D5,
+        0xAE07BCE9,0xB71C8DA8,0x9C31DE6B,0x852AEF2A,0xCA6B79ED,0xD37048AC,0xF85D1B6F,0xE1462A2E,0x66DE36E1,0x7FC507A0,0x54E85463,0x4DF36522,0x02B2F3E5,0x1BA9C2A4,0x30849167,0x299FA026,
+        0xE4C5AEB8,0xFDDE9FF9,0xD6F3CC3A,0xCFE8FD7B,0x80A96BBC,0x99B25AFD,0xB29F093E,0xAB84387F,0x2C1C24B0,0x350715F1,0x1E2A4632,0x07317773,0x4870E1B4,0x516BD0F5,0x7A468336,0x635DB277,
+        0xCBFAD74E,0xD2E1E60F,0xF9CCB5CC,0xE0D7848D,0xAF96124A,0xB68D230B,0x9DA070C8,0x84BB4189,0x03235D46,0x1A386C07,0x31153FC4,0x280E0E85,0x674F9842,0x7E54A903,0x5579FAC0,0x4C62CB81,
+        0x8138C51F,0x9823F45E,0xB30EA79D,0xAA1596DC,0xE554001B,0xFC4F315A,0xD7626299,0xCE7953D8,0x49E14F17,0x50FA7E56,0x7BD72D95,0x62CC1CD4,0x2D8D8A13,0x3496BB52,0x1FBBE891,0x06A0D9D0,
+        0x5E7EF3EC,0x4765C2AD,0x6C48916E,0x7553A02F,0x3A1236E8,0x230907A9,0x0824546A,0x113F652B,0x96A779E4,0x8FBC48A5,0xA4911B66,0xBD8A2A27,0xF2CBBCE0,0xEBD08DA1,0xC0FDDE62,0xD9E6EF23,
+        0x14BCE1BD,0x0DA7D0FC,0x268A833F,0x3F91B27E,0x70D024B9,0x69CB15F8,0x42E6463B,0x5BFD777A,0xDC656BB5,0xC57E5AF4,0xEE530937,0xF7483876,0xB809AEB1,0xA1129FF0,0x8A3FCC33,0x9324FD72,
+    },
+    {
+        0x00000000,0x01C26A37,0x0384D46E,0x0246BE59,0x0709A8DC,0x06CBC2EB,0x048D7CB2,0x054F1685,0x0E1351B8,0x0FD13B8F,0x0D9785D6,0x0C55EFE1,0x091AF964,0x08D89353,0x0A9E2D0A,0x0B5C473D,
+        0x1C26A370,0x1DE4C947,0x1FA2771E,0x1E601D29,0x1B2F0BAC,0x1AED619B,0x18ABDFC2,0x1969B5F5,0x1235F2C8,0x13F798FF,0x11B126A6,0x10734C91,0x153C5A14,0x14FE3023,0x16B88E7A,0x177AE44D,
+        0x384D46E0,0x398F2CD7,0x3BC9928E,0x3A0BF8B9,0x3F44EE3C,0x3E86840B,0x3CC03A52,0x3D025065,0x365E1758,0x379C7D6F,0x35DAC336,0x3418A901,0x3157BF84,0x3095D5B3,0x32D36BEA,0x331101DD,
+        0x246BE590,0x25A98FA7,0x27EF31FE,0x262D5BC9,0x23624D4C,0x22A0277B,0x20E69922,0x2124F315,0x2A78B428,0x2BBADE1F,0x29FC6046,0x283E0A71,0x2D711CF4,0x2CB376C3,0x2EF5C89A,0x2F37A2AD,
+        0x709A8DC0,0x7158E7F7,0x731E59AE,0x72DC3399,0x7793251C,0x76514F2B,0x7417F172,0x75D59B45,0x7E89DC78,0x7F4BB64F,0x7D0D0816,0x7CCF6221,0x798074A4,0x78421E93,0x7A04A0CA,0x7BC6CAFD,
+        0x6CBC2EB0,0x6D7E4487,0x6F38FADE,0x6EFA90E9,0x6BB5866C,0x6A77EC5B,0x68315202,0x69F33835,0x62AF7F08,0x636D153F,0x612BAB66,0x60E9C151,0x65A6D7D4,0x6464BDE3,0x662203BA,0x67E0698D,
+        0x48D7CB20,0x4915A117,0x4B531F4E,0x4A917579,0x4FDE63FC,0x4E1C09CB,0x4C5AB792,0x4D98DDA5,0x46C49A98,0x4706F0AF,0x45404EF6,0x448224C1,0x41CD3244,0x400F5873,0x4249E62A,0x438B8C1D,
+        0x54F16850,0x55330267,0x5775BC3E,0x56B7D609,0x53F8C08C,0x523AAABB,0x507C14E2,0x51BE7ED5,0x5AE239E8,0x5B2053DF,0x5966ED86,0x58A487B1,0x5DEB9134,0x5C29FB03,0x5E6F455A,0x5FAD2F6D,
+        0xE1351B80,0xE0F771B7,0xE2B1CFEE,0xE373A5D9,0xE63CB35C,0xE7FED96B,0xE5B86732,0xE47A0D05,0xEF264A38,0xEEE4200F,0xECA29E56,0xED60F461,0xE82FE2E4,0xE9ED88D3,0xEBAB368A,0xEA695CBD,
+        0xFD13B8F0,0xFCD1D2C7,0xFE976C9E,0xFF5506A9,0xFA1A102C,0xFBD87A1B,0xF99EC442,0xF85CAE75,0xF300E948,0xF2C2837F,0xF0843D26,0xF1465711,0xF4094194,0xF5CB2BA3,0xF78D95FA,0xF64FFFCD,
+        0xD9785D60,0xD8BA3757,0xDAFC890E,0xDB3EE339,0xDE71F5BC,0xDFB39F8B,0xDDF521D2,0xDC374BE5,0xD76B0CD8,0xD6A966EF,0xD4EFD8B6,0xD52DB281,0xD062A404,0xD1A0CE33,0xD3E6706A,0xD2241A5D,
+        0xC55EFE10,0xC49C9427,0xC6DA2A7E,0xC7184049,0xC25756CC,0xC3953CFB,0xC1D382A2,0xC011E895,0xCB4DAFA8,0xCA8FC59F,0xC8C97BC6,0xC90B11F1,0xCC440774,0xCD866D43,0xCFC0D31A,0xCE02B92D,
+        0x91AF9640,0x906DFC77,0x922B422E,0x93E92819,0x96A63E9C,0x976454AB,0x9522EAF2,0x94E080C5,0x9FBCC7F8,0x9E7EADCF,0x9C381396,0x9DFA79A1,0x98B56F24,0x99770513,0x9B31BB4A,0x9AF3D17D,
+        0x8D893530,0x8C4B5F07,0x8E0DE15E,0x8FCF8B69,0x8A809DEC,0x8B42F7DB,0x89044982,0x88C623B5,0x839A6488,0x82580EBF,0x801EB0E6,0x81DCDAD1,0x8493CC54,0x8551A663,0x8717183A,0x86D5720D,
+        0xA9E2D0A0,0xA820BA97,0xAA6604CE,0xABA46EF9,0xAEEB787C,0xAF29124B,0xAD6FAC12,0xACADC625,0xA7F18118,0xA633EB2F,0xA4755576,0xA5B73F41,0xA0F829C4,0xA13A43F3,0xA37CFDAA,0xA2BE979D,
+        0xB5C473D0,0xB40619E7,0xB640A7BE,0xB782CD89,0xB2CDDB0C,0xB30FB13B,0xB1490F62,0xB08B6555,0xBBD72268,0xBA15485F,0xB853F606,0xB9919C31,0xBCDE8AB4,0xBD1CE083,0xBF5A5EDA,0xBE9834ED,
+    },
+    {
+        0x00000000,0xB8BC6765,0xAA09C88B,0x12B5AFEE,0x8F629757,0x37DEF032,0x256B5FDC,0x9DD738B9,0xC5B428EF,0x7D084F8A,0x6FBDE064,0xD7018701,0x4AD6BFB8,0xF26AD8DD,0xE0DF7733,0x58631056,
+        0x5019579F,0xE8A530FA,0xFA109F14,0x42ACF871,0xDF7BC0C8,0x67C7A7AD,0x75720843,0xCDCE6F26,0x95AD7F70,0x2D111815,0x3FA4B7FB,0x8718D09E,0x1ACFE827,0xA2738F42,0xB0C620AC,0x087A47C9,
+        0xA032AF3E,0x188EC85B,0x0A3B67B5,0xB28700D0,0x2F503869,0x97EC5F0C,0x8559F0E2,0x3DE59787,0x658687D1,0xDD3AE0B4,0xCF8F4F5A,0x7733283F,0xEAE41086,0x525877E3,0x40EDD80D,0xF851BF68,
+        0xF02BF8A1,0x48979FC4,0x5A22302A,0xE29E574F,0x7F496FF6,0xC7F50893,0xD540A77D,0x6DFCC018,0x359FD04E,0x8D23B72B,0x9F9618C5,0x272A7FA0,0xBAFD4719,0x0241207C,0x10F48F92,0xA848E8F7,
+        0x9B14583D,0x23A83F58,0x311D90B6,0x89A1F7D3,0x1476CF6A,0xACCAA80F,0xBE7F07E1,0x06C36084,0x5EA070D2,0xE61C17B7,0xF4A9B859,0x4C15DF3C,0xD1C2E785,0x697E80E0,0x7BCB2F0E,0xC377486B,
+        0xCB0D0FA2,0x73B168C7,0x6104C729,0xD9B8A04C,0x446F98F5,0xFCD3FF90,0xEE66507E,0x56DA371B,0x0EB9274D,0xB6054028,0xA4B0EFC6,0x1C0C88A3,0x81DBB01A,0x3967D77F,0x2BD27891,0x936E1FF4,
+        0x3B26F703,0x839A9066,0x912F3F88,0x299358ED,0xB4446054,0x0CF80731,0x1E4DA8DF,0xA6F1CFBA,0xFE92DFEC,0x462EB889,0x549B1767,0xEC277002,0x71F048BB,0xC94C2FDE,0xDBF98030,0x6345E755,
+        0x6B3FA09C,0xD383C7F9,0xC1366817,0x798A0F72,0xE45D37CB,0x5CE150AE,0x4E54FF40,0xF6E89825,0xAE8B8873,0x1637EF16,0x048240F8,0xBC3E279D,0x21E91F24,0x99557841,0x8BE0D7AF,0x335CB0CA,
+        0xED59B63B,0x55E5D15E,0x47507EB0,0xFFEC19D5,0x623B216C,0xDA874609,0xC832E9E7,0x708E8E82,0x28ED9ED4,0x9051F9B1,0x82E4565F,0x3A58313A,0xA78F0983,0x1F336EE6,0x0D86C108,0xB53AA66D,
+        0xBD40E1A4,0x05FC86C1,0x1749292F,0xAFF54E4A,0x322276F3,0x8A9E1196,0x982BBE78,0x2097D91D,0x78F4C94B,0xC048AE2E,0xD2FD01C0,0x6A4166A5,0xF7965E1C,0x4F2A3979,0x5D9F9697,0xE523F1F2,
+        0x4D6B1905,0xF5D77E60,0xE762D18E,0x5FDEB6EB,0xC2098E52,0x7AB5E937,0x680046D9,0xD0BC21BC,0x88DF31EA,0x3063568F,0x22D6F961,0x9A6A9E04,0x07BDA6BD,0xBF01C1D8,0xADB46E36,0x15080953,
+        0x1D724E9A,0xA5CE29FF,0xB77B8611,0x0FC7E174,0x9210D9CD,0x2AACBEA8,0x38191146,0x80A57623,0xD8C66675,0x607A0110,0x72CFAEFE,0xCA73C99B,0x57A4F122,0xEF189647,0xFDAD39A9,0x45115ECC,
+        0x764DEE06,0xCEF18963,0xDC44268D,0x64F841E8,0xF92F7951,0x41931E34,0x5326B1DA,0xEB9AD6BF,0xB3F9C6E9,0x0B45A18C,0x19F00E62,0xA14C6907,0x3C9B51BE,0x842736DB,0x96929935,0x2E2EFE50,
+        0x2654B999,0x9EE8DEFC,0x8C5D7112,0x34E11677,0xA9362ECE,0x118A49AB,0x033FE645,0xBB838120,0xE3E09176,0x5B5CF613,0x49E959FD,0xF1553E98,0x6C820621,0xD43E6144,0xC68BCEAA,0x7E37A9CF,
+        0xD67F4138,0x6EC3265D,0x7C7689B3,0xC4CAEED6,0x591DD66F,0xE1A1B10A,0xF3141EE4,0x4BA87981,0x13CB69D7,0xAB770EB2,0xB9C2A15C,0x017EC639,0x9CA9FE80,0x241599E5,0x36A0360B,0x8E1C516E,
+        0x866616A7,0x3EDA71C2,0x2C6FDE2C,0x94D3B949,0x090481F0,0xB1B8E695,0xA30D497B,0x1BB12E1E,0x43D23E48,0xFB6E592D,0xE9DBF6C3,0x516791A6,0xCCB0A91F,0x740CCE7A,0x66B96194,0xDE0506F1,
+    },
+};
+
+static inline ImU32 ImHashBytes(const unsigned char* data, size_t data_size, ImU32 seed)
+{
+    ImU32 crc = ~seed;
+    const ImU32 (*crc32_lut)[256] = GCrc32LookupTable;
+    for (; data_size >= 4; data += 4, data_size -= 4)
+    {
+        // Reading as little-endian so the first byte of the stream lands in the lowest bits
+        crc ^= (ImU32)data[0] | ((ImU32)data[1] << 8) | ((ImU32)data[2] << 16) | ((ImU32)data[3] << 24);
+        crc = crc32_lut[3][crc & 0xFF] ^ crc32_lut[2][(crc >> 8) & 0xFF] ^ crc32_lut[1][(crc >> 16) & 0xFF] ^ crc32_lut[0][crc >> 24];
+    }
+    while (data_size-- != 0)
+        crc = (crc >> 8) ^ crc32_lut[0][(crc & 0xFF) ^ *data++];
     return ~crc;
 }
 
+// Feed 'zeroes_count' zero bytes to a CRC register (without the initial/final inversions), see ImHashLabel()
+static inline ImU32 ImHashZeroes(ImU32 crc, size_t zeroes_count)
+{
+    const ImU32 (*crc32_lut)[256] = GCrc32LookupTable;
+    for (; zeroes_count >= 4; zeroes_count -= 4)
+        crc = crc32_lut[3][crc & 0xFF] ^ crc32_lut[2][(crc >> 8) & 0xFF] ^ crc32_lut[1][(crc >> 16) & 0xFF] ^ crc32_lut[0][crc >> 24];
+    while (zeroes_count-- != 0)
+        crc = (crc >> 8) ^ crc32_lut[0][crc & 0xFF];
+    return crc;
+}
+
+#endif
+
+// Known size hash
+// It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
+ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
+{
+    return ImHashBytes((const unsigned char*)data_p, data_size, seed);
+}
+
+// Zero-terminated string hash, with support for ### to reset back to seed value
+// We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
+// - Hashing from the seed starting at the last ### is equivalent to discarding the hash so far and resetting to the seed
+//   whenever we reach ###, so we locate the last ### first (memchr() is fast and # are rare) and hash the remainder in one go.
+ImU32 ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
+{
+    const char* data_end = data_p + (data_size != 0 ? data_size : strlen(data_p));
+    const char* hash_begin = data_p;
+    for (const char* p = data_p; data_end - p >= 3 && (p = (const char*)memchr(p, '#', (size_t)(data_end - p - 2))) != NULL; p++)
+        if (p[1] == '#' && p[2] == '#')
+            hash_begin = p;
+    return ImHashBytes((const unsigned char*)hash_begin, (size_t)(data_end - hash_begin), seed);
+}
+
+// Hash of a label computed at compile-time by IM_LABEL(), with the seed applied at runtime, == ImHashStr(label.Label, 0, seed)
+// - CRC are linear, so hashing data with a seed gives the hash of the same data with a zero seed, xor'ed with the CRC register obtained by
+//   feeding as many zero bytes to the seed. We never need to look at the string itself.
+// - The wyhash-style hash has no such property, but IM_LABEL() doesn't compute hashes at compile-time with it either.
+ImU32 ImHashLabel(const ImGuiLabelHash& label, ImU32 seed)
+{
+#ifndef IMGUI_USE_HASH_WYHASH
+    if (label.HashLen >= 0)
+        return label.Hash ^ ImHashZeroes(seed, (size_t)label.HashLen);
+#endif
+    return ImHashStr(label.Label, 0, seed);
+}
+
+// Check ImHashStrConst() against known CRC values, including the "##"/"###" handling and the empty label, so a mismatch with ImHashStr() fails to compile
+#ifdef IMGUI_HAS_CONSTEXPR_HASH
+#ifdef IMGUI_USE_HASH_CRC32C
+IM_STATIC_ASSERT(ImHashStrConst("123456789") == 0xE3069283u);
+IM_STATIC_ASSERT(ImHashStrConst("##") == 0x89E04163u && ImHashStrConst("###") == 0x138FAEACu);
+IM_STATIC_ASSERT(ImHashStrConst("Label##id") == 0x0CB8C8E0u && ImHashStrConst("Label##id", 0x12345678u) == 0xC8662109u);
+IM_STATIC_ASSERT(ImHashStrConst("Hello###World") == 0x010A39E4u && ImHashStrConst("Hello###World") == ImHashStrConst("Other###World"));
+#else
+IM_STATIC_ASSERT(ImHashStrConst("123456789") == 0xCBF43926u);
+IM_STATIC_ASSERT(ImHashStrConst("##") == 0x5D1714ECu && ImHashStrConst("###") == 0xD98427B8u);
+IM_STATIC_ASSERT(ImHashStrConst("Label##id") == 0xAC509037u && ImHashStrConst("Label##id", 0x12345678u) == 0x6650296Au);
+IM_STATIC_ASSERT(ImHashStrConst("Hello###World") == 0x5022271Fu && ImHashStrConst("Hello###World") == ImHashStrConst("Other###World"));
+#endif
+IM_STATIC_ASSERT(ImHashStrConst("") == 0 && ImHashStrConstLen("") == 0);
+IM_STATIC_ASSERT(ImHashStrConstLen("##") == 2 && ImHashStrConstLen("###") == 3 && ImHashStrConstLen("Hello###World") == 8);
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
 //-----------------------------------------------------------------------------
@@ -1642,10 +1893,11 @@ int ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end)
 }
 
 // Based on stb_to_utf8() from github.com/nothings/stb/
-static inline int ImTextCharToUtf8(char* buf, int buf_size, unsigned int c)
+int ImTextCharToUtf8(char* buf, int buf_size, unsigned int c)
 {
     if (c < 0x80)
     {
+        if (buf_size < 1) return 0;
         buf[0] = (char)c;
         return 1;
     }
@@ -1813,27 +2065,106 @@ void ImGui::ColorConvertHSVtoRGB(float h, float s, float v, float& out_r, float&
 // Helper: Key->value storage
 //-----------------------------------------------------------------------------
 
-// std::lower_bound but without the bullshit
-static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiStoragePair>& data, ImGuiID key)
+// Small storages (e.g. most per-window storages) are searched linearly and don't allocate a lookup table.
+static const int STORAGE_SLOTS_MIN_DATA_COUNT = 8;
+
+static inline ImU32 StorageSlotHash(ImGuiID key)
 {
-    ImGuiStorage::ImGuiStoragePair* first = data.Data;
-    ImGuiStorage::ImGuiStoragePair* last = data.Data + data.Size;
-    size_t count = (size_t)(last - first);
-    while (count > 0)
+    // Keys are generally already hashed IDs, but user storages may use small sequential integers: mix them over the table.
+    ImU32 h = key * 0x9E3779B1u;
+    return h ^ (h >> 16);
+}
+
+// Register Data[data_index] in the lookup table, which needs to have at least one empty slot.
+static void StorageInsertSlot(ImGuiStorage* storage, int data_index)
+{
+    const ImGuiID key = storage->Data[data_index].key;
+    const ImU32 mask = (ImU32)storage->Slots.Size - 1;
+    for (ImU32 n = StorageSlotHash(key) & mask; ; n = (n + 1) & mask)
     {
-        size_t count2 = count >> 1;
-        ImGuiStorage::ImGuiStoragePair* mid = first + count2;
-        if (mid->key < key)
+        ImGuiStorage::ImGuiStorageSlot* slot = &storage->Slots[n];
+        if (slot->index == -1)
         {
-            first = ++mid;
-            count -= count2 + 1;
+            slot->key = key;
+            slot->index = data_index;
+            return;
         }
-        else
+        if (slot->key == key)
+            return; // Duplicate key pushed directly into Data[]: first one wins
+    }
+}
+
+static void StorageRebuildSlots(ImGuiStorage* storage)
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Storage);
+    storage->SlotsDataCount = storage->Data.Size;
+    if (storage->Data.Size < STORAGE_SLOTS_MIN_DATA_COUNT)
+    {
+        storage->Slots.clear();
+        return;
+    }
+
+    // Keep load factor under 50%: with linear probing this keeps probe sequences very short
+    int slots_count = STORAGE_SLOTS_MIN_DATA_COUNT * 2;
+    while (slots_count < storage->Data.Size * 2)
+        slots_count *= 2;
+    storage->Slots.resize(slots_count);
+    for (int n = 0; n < slots_count; n++)
+        storage->Slots.Data[n].index = -1;
+    for (int n = 0; n < storage->Data.Size; n++)
+        StorageInsertSlot(storage, n);
+}
+
+// Pure lookup, usable from const accessors: never updates the lookup table.
+// If pairs were pushed into Data[] directly since the table was built, fall back to a linear search until the next mutating call.
+static const ImGuiStorage::ImGuiStoragePair* StorageFindPair(const ImGuiStorage* storage, ImGuiID key)
+{
+    if (storage->Slots.Size == 0 || storage->SlotsDataCount != storage->Data.Size)
+    {
+        for (const ImGuiStorage::ImGuiStoragePair* it = storage->Data.begin(); it != storage->Data.end(); it++)
+            if (it->key == key)
+                return it;
+        return NULL;
+    }
+
+    const ImU32 mask = (ImU32)storage->Slots.Size - 1;
+    for (ImU32 n = StorageSlotHash(key) & mask; ; n = (n + 1) & mask)
+    {
+        const ImGuiStorage::ImGuiStorageSlot* slot = &storage->Slots.Data[n];
+        if (slot->index == -1)
+            return NULL;
+        if (slot->key == key)
         {
-            count = count2;
+            const ImGuiStorage::ImGuiStoragePair* pair = &storage->Data.Data[slot->index];
+            IM_ASSERT(pair->key == key && "Pairs in ImGuiStorage::Data were reordered or modified directly: call BuildSortByKey() afterwards!");
+            return pair;
         }
     }
-    return first;
+}
+
+// Lookup for mutating functions, which bring the lookup table up to date first
+static ImGuiStorage::ImGuiStoragePair* StorageFindPairForWrite(ImGuiStorage* storage, ImGuiID key)
+{
+    if (storage->SlotsDataCount != storage->Data.Size)
+        StorageRebuildSlots(storage);
+    return const_cast<ImGuiStorage::ImGuiStoragePair*>(StorageFindPair(storage, key));
+}
+
+// Only call after StorageFindPairForWrite() failed to find the key (so the lookup table is up to date)
+static ImGuiStorage::ImGuiStoragePair* StorageAddPair(ImGuiStorage* storage, const ImGuiStorage::ImGuiStoragePair& pair)
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Storage);
+    storage->Data.push_back(pair);
+    if (storage->Slots.Size > 0 && storage->Data.Size * 2 <= storage->Slots.Size)
+    {
+        storage->SlotsDataCount = storage->Data.Size;
+        StorageInsertSlot(storage, storage->Data.Size - 1);
+    }
+    else
+    {
+        StorageRebuildSlots(storage);
+    }
+    return &storage->Data.back();
 }
 
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
@@ -1851,14 +2182,13 @@ void ImGuiStorage::BuildSortByKey()
     };
     if (Data.Size > 1)
         ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), StaticFunc::PairCompareByID);
+    StorageRebuildSlots(this);
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_i;
+    const ImGuiStoragePair* it = StorageFindPair(this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -1868,26 +2198,22 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_f;
+    const ImGuiStoragePair* it = StorageFindPair(this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return NULL;
-    return it->val_p;
+    const ImGuiStoragePair* it = StorageFindPair(this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    ImGuiStoragePair* it = StorageFindPairForWrite(this, key);
+    if (it == NULL)
+        it = StorageAddPair(this, ImGuiStoragePair(key, default_val));
     return &it->val_i;
 }
 
@@ -1898,30 +2224,27 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    ImGuiStoragePair* it = StorageFindPairForWrite(this, key);
+    if (it == NULL)
+        it = StorageAddPair(this, ImGuiStoragePair(key, default_val));
     return &it->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
+    ImGuiStoragePair* it = StorageFindPairForWrite(this, key);
+    if (it == NULL)
+        it = StorageAddPair(this, ImGuiStoragePair(key, default_val));
     return &it->val_p;
 }
 
-// FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_i = val;
+    ImGuiStoragePair* it = StorageFindPairForWrite(this, key);
+    if (it == NULL)
+        StorageAddPair(this, ImGuiStoragePair(key, val));
+    else
+        it->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -1931,24 +2254,20 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_f = val;
+    ImGuiStoragePair* it = StorageFindPairForWrite(this, key);
+    if (it == NULL)
+        StorageAddPair(this, ImGuiStoragePair(key, val));
+    else
+        it->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_p = val;
+    ImGuiStoragePair* it = StorageFindPairForWrite(this, key);
+    if (it == NULL)
+        StorageAddPair(this, ImGuiStoragePair(key, val));
+    else
+        it->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2077,6 +2396,7 @@ char ImGuiTextBuffer::EmptyString[1] = { 0 };
 
 void ImGuiTextBuffer::append(const char* str, const char* str_end)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_TextBuffer);
     int len = str_end ? (int)(str_end - str) : (int)strlen(str);
 
     // Add zero-terminator the first time
@@ -2104,6 +2424,7 @@ void ImGuiTextBuffer::appendf(const char* fmt, ...)
 // Helper: Text buffer for logging/accumulating text
 void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_TextBuffer);
     va_list args_copy;
     va_copy(args_copy, args);
 
@@ -2128,12 +2449,103 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     va_end(args_copy);
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImLinearAllocator
+//-----------------------------------------------------------------------------
+
+void* ImLinearAllocator::Alloc(size_t size)
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FrameArena);
+    size = ImMax((size + 15) & ~(size_t)15, (size_t)16);
+    AllocCount++;
+    AllocBytes += size;
+
+    // Oversized request: use a dedicated block, prefixed with its size so Contains() can test it
+    if (size > BlockSize)
+    {
+        char* block = (char*)IM_ALLOC(size + 16);
+        *(size_t*)(void*)block = size;
+        LargeBlocks.push_back(block);
+        AddAddrRange(block, size + 16);
+        return block + 16;
+    }
+
+    if (CurrentBlock < Blocks.Size && CurrentOffset + size > BlockSize)
+    {
+        CurrentBlock++;
+        CurrentOffset = 0;
+    }
+    if (CurrentBlock == Blocks.Size)
+    {
+        Blocks.push_back((char*)IM_ALLOC(BlockSize));
+        AddAddrRange(Blocks.back(), BlockSize);
+    }
+    void* ptr = Blocks[CurrentBlock] + CurrentOffset;
+    CurrentOffset += size;
+    return ptr;
+}
+
+void ImLinearAllocator::Reset()
+{
+    // Detach blocks before freeing them, as MemFree() asserts on pointers that Contains() reports as ours.
+    ImVector<char*> large_blocks;
+    large_blocks.swap(LargeBlocks);
+    for (int n = 0; n < large_blocks.Size; n++)
+        IM_FREE(large_blocks[n]);
+    if (large_blocks.Size > 0)
+    {
+        AddrMin = AddrMax = NULL;
+        for (int n = 0; n < Blocks.Size; n++)
+            AddAddrRange(Blocks[n], BlockSize);
+    }
+    CurrentBlock = 0;
+    CurrentOffset = 0;
+    AllocCount = 0;
+    AllocBytes = 0;
+}
+
+void ImLinearAllocator::ClearFreeMemory()
+{
+    Reset();
+    ImVector<char*> blocks;
+    blocks.swap(Blocks);
+    for (int n = 0; n < blocks.Size; n++)
+        IM_FREE(blocks[n]);
+    AddrMin = AddrMax = NULL;
+}
+
+bool ImLinearAllocator::Contains(const void* ptr) const
+{
+    const char* p = (const char*)ptr;
+    if (p < AddrMin || p >= AddrMax)
+        return false;
+    for (int n = 0; n < Blocks.Size; n++)
+        if (p >= Blocks[n] && p < Blocks[n] + BlockSize)
+            return true;
+    for (int n = 0; n < LargeBlocks.Size; n++)
+        if (p >= LargeBlocks[n] && p < LargeBlocks[n] + 16 + *(const size_t*)(const void*)LargeBlocks[n])
+            return true;
+    return false;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 // This is currently not as flexible/powerful as it should be and really confusing/spaghetti, mostly because we changed
 // the API mid-way through development and support two ways to using the clipper, needs some rework (see TODO)
 //-----------------------------------------------------------------------------
 
+// We create the union of the ClipRect and the NavScoringRect which at worst should be 1 page away from ClipRect
+static ImRect CalcListClippingRect(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImRect unclipped_rect = window->ClipRect;
+    if (g.NavMoveRequest)
+        unclipped_rect.Add(g.NavScoringRect);
+    if (g.NavJustMovedToId && window->NavLastIds[0] == g.NavJustMovedToId)
+        unclipped_rect.Add(ImRect(window->Pos + window->NavRectRel[0].Min, window->Pos + window->NavRectRel[0].Max));
+    return unclipped_rect;
+}
+
 // Helper to calculate coarse clipping of large list of evenly sized items.
 // NB: Prefer using the ImGuiListClipper higher-level helper if you can! Read comments and instructions there on how those use this sort of pattern.
 // NB: 'items_count' is only used to clamp the result, if you don't know your count you can use INT_MAX
@@ -2154,13 +2566,7 @@ void ImGui::CalcListClipping(int items_count, float items_height, int* out_items
         return;
     }
 
-    // We create the union of the ClipRect and the NavScoringRect which at worst should be 1 page away from ClipRect
-    ImRect unclipped_rect = window->ClipRect;
-    if (g.NavMoveRequest)
-        unclipped_rect.Add(g.NavScoringRect);
-    if (g.NavJustMovedToId && window->NavLastIds[0] == g.NavJustMovedToId)
-        unclipped_rect.Add(ImRect(window->Pos + window->NavRectRel[0].Min, window->Pos + window->NavRectRel[0].Max));
-
+    const ImRect unclipped_rect = CalcListClippingRect(window);
     const ImVec2 pos = window->DC.CursorPos;
     int start = (int)((unclipped_rect.Min.y - pos.y) / items_height);
     int end = (int)((unclipped_rect.Max.y - pos.y) / items_height);
@@ -2217,6 +2623,32 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     StepNo = 0;
     DisplayStart = -1;
     DisplayEnd = 0;
+    Heights = NULL;
+    ForceStart = ForceEnd = 0;
+    PendingStart = PendingEnd = 0;
+}
+
+void ImGuiListClipper::Begin(int items_count, ImGuiListClipperHeights* heights)
+{
+    IM_ASSERT(heights != NULL && items_count >= 0 && items_count < INT_MAX);
+    Begin(items_count, -1.0f);
+    Heights = heights;
+}
+
+void ImGuiListClipper::ForceDisplayRangeByIndices(int item_min, int item_max)
+{
+    IM_ASSERT(ItemsCount >= 0 && StepNo == 0 && "Call after Begin() and before the first Step()");
+    item_min = ImMax(item_min, 0);
+    item_max = ImMin(item_max, ItemsCount);
+    if (item_min >= item_max)
+        return;
+    if (ForceStart < ForceEnd)
+    {
+        item_min = ImMin(item_min, ForceStart);
+        item_max = ImMax(item_max, ForceEnd);
+    }
+    ForceStart = item_min;
+    ForceEnd = item_max;
 }
 
 void ImGuiListClipper::End()
@@ -2225,17 +2657,123 @@ void ImGuiListClipper::End()
         return;
 
     // In theory here we should assert that ImGui::GetCursorPosY() == StartPosY + DisplayEnd * ItemsHeight, but it feels saner to just seek at the end and not assert/crash the user.
-    if (ItemsCount < INT_MAX && DisplayStart >= 0)
+    if (Heights != NULL)
+    {
+        if (ItemsCount > 0 && DisplayStart >= 0)
+            SetCursorPosYAndSetupForPrevLine(StartPosY + (float)Heights->GetTotalHeight(), Heights->GetHeight(ItemsCount - 1));
+    }
+    else if (ItemsCount < INT_MAX && DisplayStart >= 0)
+    {
         SetCursorPosYAndSetupForPrevLine(StartPosY + ItemsCount * ItemsHeight, ItemsHeight);
+    }
     ItemsCount = -1;
     StepNo = 3;
 }
 
+// Step() for elements of variable heights: seek to the first visible element using the stored heights, then return the visible
+// elements one by one, measuring each of them, until we are past the clipping rectangle.
+static bool ListClipperStepWithHeights(ImGuiListClipper* clipper)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiListClipperHeights* heights = clipper->Heights;
+
+    if (clipper->StepNo == 0)
+    {
+        clipper->StartPosY = window->DC.CursorPos.y;
+        if (heights->DefaultHeight <= 0.0f)
+            heights->DefaultHeight = ImGui::GetTextLineHeightWithSpacing();
+        heights->Resize(clipper->ItemsCount);
+        if (clipper->ItemsCount == 0 || window->SkipItems)
+        {
+            clipper->End();
+            return false;
+        }
+
+        // If logging is active, do not perform any clipping
+        int start = 0;
+        clipper->ClipMaxY = FLT_MAX;
+        clipper->ExtraItems = 0;
+        if (!g.LogEnabled)
+        {
+            // When performing a navigation request, ensure we have one item extra in the direction we are moving to
+            const ImRect unclipped_rect = CalcListClippingRect(window);
+            start = heights->FindItemAtOffset((double)(unclipped_rect.Min.y - clipper->StartPosY));
+            if (g.NavMoveRequest && g.NavMoveClipDir == ImGuiDir_Up)
+                start--;
+            start = ImClamp(start, 0, clipper->ItemsCount - 1);
+            clipper->ClipMaxY = unclipped_rect.Max.y;
+            clipper->ExtraItems = (g.NavMoveRequest && g.NavMoveClipDir == ImGuiDir_Down) ? 1 : 0;
+        }
+
+        // Forced elements before the visible ones are displayed first, then we seek to the visible ones (PendingStart)
+        clipper->PendingStart = -1;
+        if (clipper->ForceStart < clipper->ForceEnd && clipper->ForceStart < start)
+        {
+            if (clipper->ForceEnd < start)
+                clipper->PendingStart = start;
+            start = clipper->ForceStart;
+        }
+
+        // Seek cursor
+        if (start > 0)
+            SetCursorPosYAndSetupForPrevLine(clipper->StartPosY + (float)heights->GetOffset(start), heights->GetHeight(start - 1));
+        clipper->DisplayStart = start;
+        clipper->DisplayEnd = start + 1;
+        clipper->ItemPosY = window->DC.CursorPos.y;
+        clipper->StepNo = 1;
+        return true;
+    }
+
+    // Measure the element which was just submitted
+    const float item_height = window->DC.CursorPos.y - clipper->ItemPosY;
+    if (item_height >= 0.0f && item_height != heights->GetHeight(clipper->DisplayStart))
+        heights->SetHeight(clipper->DisplayStart, item_height);
+
+    // Next element, unless we reached the end of the list or went past the clipping rectangle
+    int next = clipper->DisplayEnd;
+    bool display_next = false;
+    if (next < clipper->ItemsCount)
+    {
+        if (next >= clipper->ForceStart && next < clipper->ForceEnd)
+            display_next = true;
+        else if (clipper->PendingStart >= 0)
+        {
+            // Done with the forced elements, seek to the visible ones
+            next = clipper->PendingStart;
+            clipper->PendingStart = -1;
+            display_next = true;
+        }
+        else if (window->DC.CursorPos.y < clipper->ClipMaxY || clipper->ExtraItems-- > 0)
+            display_next = true;
+        else if (next < clipper->ForceStart)
+        {
+            // Done with the visible elements, seek to the forced ones
+            next = clipper->ForceStart;
+            display_next = true;
+        }
+    }
+    if (!display_next)
+    {
+        clipper->End();
+        return false;
+    }
+    if (next != clipper->DisplayEnd)
+        SetCursorPosYAndSetupForPrevLine(clipper->StartPosY + (float)heights->GetOffset(next), heights->GetHeight(next - 1));
+    clipper->DisplayStart = next;
+    clipper->DisplayEnd = next + 1;
+    clipper->ItemPosY = window->DC.CursorPos.y;
+    return true;
+}
+
 bool ImGuiListClipper::Step()
 {
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
 
+    if (Heights != NULL)
+        return ListClipperStepWithHeights(this);
+
     // Reached end of list
     if (DisplayEnd >= ItemsCount || window->SkipItems)
     {
@@ -2280,6 +2818,30 @@ bool ImGuiListClipper::Step()
         DisplayStart += already_submitted;
         DisplayEnd += already_submitted;
 
+        // Forced elements are merged with the visible ones when contiguous, otherwise displayed in a separate step (first when they come first)
+        const int force_start = ImMax(ForceStart, already_submitted);
+        const int force_end = ForceEnd;
+        if (force_start < force_end)
+        {
+            if (force_end < DisplayStart)
+            {
+                PendingStart = DisplayStart;
+                PendingEnd = DisplayEnd;
+                DisplayStart = force_start;
+                DisplayEnd = force_end;
+            }
+            else if (force_start > DisplayEnd)
+            {
+                PendingStart = force_start;
+                PendingEnd = force_end;
+            }
+            else
+            {
+                DisplayStart = ImMin(DisplayStart, force_start);
+                DisplayEnd = ImMax(DisplayEnd, force_end);
+            }
+        }
+
         // Seek cursor
         if (DisplayStart > already_submitted)
             SetCursorPosYAndSetupForPrevLine(StartPosY + DisplayStart * ItemsHeight, ItemsHeight);
@@ -2292,6 +2854,16 @@ bool ImGuiListClipper::Step()
     // Advance the cursor to the end of the list and then returns 'false' to end the loop.
     if (StepNo == 3)
     {
+        // Display the elements which were not contiguous with the previous ones
+        if (PendingStart < PendingEnd)
+        {
+            SetCursorPosYAndSetupForPrevLine(StartPosY + PendingStart * ItemsHeight, ItemsHeight);
+            DisplayStart = PendingStart;
+            DisplayEnd = PendingEnd;
+            PendingStart = PendingEnd = 0;
+            return true;
+        }
+
         // Seek cursor
         if (ItemsCount < INT_MAX)
             SetCursorPosYAndSetupForPrevLine(StartPosY + ItemsCount * ItemsHeight, ItemsHeight); // advance cursor
@@ -2303,6 +2875,86 @@ bool ImGuiListClipper::Step()
     return false;
 }
 
+void ImGuiListClipperHeights::Resize(int items_count)
+{
+    IM_ASSERT(items_count >= 0);
+    if (items_count == Heights.Size && Tree.Size == Heights.Size + 1)
+        return;
+    const int old_count = Heights.Size;
+    const bool tree_valid = (Tree.Size == old_count + 1);
+    Heights.resize(items_count);
+    for (int n = old_count; n < items_count; n++)
+        Heights[n] = DefaultHeight;
+
+    // Removing elements: Tree[i] only covers elements before i, so the tree stays valid once truncated
+    if (tree_valid && items_count <= old_count)
+    {
+        Tree.resize(items_count + 1);
+        return;
+    }
+
+    // Adding a few elements: compute their nodes from the nodes of their children, O(log N) each
+    if (tree_valid && items_count - old_count <= old_count)
+    {
+        Tree.resize(items_count + 1);
+        for (int i = old_count + 1; i <= items_count; i++)
+        {
+            double sum = Heights[i - 1];
+            for (int child = i - 1; child > i - (i & -i); child -= (child & -child))
+                sum += Tree[child];
+            Tree[i] = sum;
+        }
+        return;
+    }
+
+    // Rebuild the tree in O(N): each node adds its partial sum to its parent
+    Tree.resize(items_count + 1);
+    Tree[0] = 0.0;
+    for (int i = 1; i <= items_count; i++)
+        Tree[i] = Heights[i - 1];
+    for (int i = 1; i <= items_count; i++)
+    {
+        const int parent = i + (i & -i);
+        if (parent <= items_count)
+            Tree[parent] += Tree[i];
+    }
+}
+
+void ImGuiListClipperHeights::SetHeight(int item_idx, float height)
+{
+    IM_ASSERT(item_idx >= 0 && item_idx < Heights.Size && Tree.Size == Heights.Size + 1);
+    const double delta = (double)height - Heights[item_idx];
+    Heights[item_idx] = height;
+    for (int i = item_idx + 1; i <= Heights.Size; i += (i & -i))
+        Tree[i] += delta;
+}
+
+double ImGuiListClipperHeights::GetOffset(int item_idx) const
+{
+    IM_ASSERT(item_idx >= 0 && item_idx <= Heights.Size);
+    double offset = 0.0;
+    for (int i = item_idx; i > 0; i -= (i & -i))
+        offset += Tree[i];
+    return offset;
+}
+
+int ImGuiListClipperHeights::FindItemAtOffset(double offset) const
+{
+    // Descend the implicit tree from the largest power of two, skipping whole blocks of elements ending before 'offset'
+    const int count = Heights.Size;
+    int step = 1;
+    while (step * 2 <= count)
+        step *= 2;
+    int pos = 0;
+    for (; step > 0; step >>= 1)
+        if (pos + step <= count && Tree[pos + step] <= offset)
+        {
+            pos += step;
+            offset -= Tree[pos];
+        }
+    return pos;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] STYLING
 //-----------------------------------------------------------------------------
@@ -2808,6 +3460,13 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
     BeginCount = 0;
     BeginOrderWithinParent = -1;
     BeginOrderWithinContext = -1;
+    SortBeginOrderWithinParent = -1;
+    SortParentWindow = NULL;
+    SortFlags = ImGuiWindowFlags_None;
+    SortActive = false;
+    HitGridCellMin = ImVec2ih(0, 0);
+    HitGridCellMax = ImVec2ih(-1, -1);
+    HitGridOrder = -1;
     PopupId = 0;
     AutoFitFramesX = AutoFitFramesY = -1;
     AutoFitChildAxises = 0x00;
@@ -2838,6 +3497,9 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
 
     MemoryCompacted = false;
     MemoryDrawListIdxCapacity = MemoryDrawListVtxCapacity = 0;
+    MemoryDrawListIdxAverage = MemoryDrawListVtxAverage = 0.0f;
+    MemoryDrawListIdxPeak = MemoryDrawListVtxPeak = 0;
+    MemoryShrinkTimer = 0.0f;
 }
 
 ImGuiWindow::~ImGuiWindow()
@@ -2848,10 +3510,83 @@ ImGuiWindow::~ImGuiWindow()
         ColumnsStorage[i].~ImGuiColumns();
 }
 
+// Copy a label into Strings[], sharing the copy with entries which recently used the same label pointer and contents.
+int ImGuiIDHashCache::AddString(const char* key, const char* str, int str_len)
+{
+    const int recent_n = (int)(((size_t)key >> 3) & (IM_ARRAYSIZE(RecentStr) - 1));
+    if (RecentStr[recent_n] == key && RecentStrLen[recent_n] == str_len && memcmp(Strings.Data + RecentStrOffset[recent_n], str, (size_t)str_len) == 0)
+        return RecentStrOffset[recent_n];
+    const int offset = Strings.Size;
+    Strings.resize(offset + str_len + 1);
+    memcpy(Strings.Data + offset, str, (size_t)str_len);
+    Strings.Data[offset + str_len] = 0;
+    RecentStr[recent_n] = key;
+    RecentStrLen[recent_n] = str_len;
+    RecentStrOffset[recent_n] = offset;
+    return offset;
+}
+
+void ImGuiIDHashCache::NewFrame()
+{
+    // Forget about entries past the last call of the previous frame
+    Entries.resize(ImMin(Cursor, Entries.Size));
+    Cursor = 0;
+
+    // Labels which changed left their old copy behind, compact once in a while
+    if (Strings.Size <= StringsCompactSize * 2 + 4096)
+        return;
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Context);
+    ImVector<char> old_strings;
+    old_strings.swap(Strings);
+    Strings.reserve(StringsCompactSize + 1024);
+    memset(RecentStr, 0, sizeof(RecentStr));
+    for (int n = 0; n < Entries.Size; n++)
+        if (Entries[n].Str != NULL)
+            Entries[n].StrOffset = AddString(Entries[n].Str, old_strings.Data + Entries[n].StrOffset, Entries[n].StrLen);
+    StringsCompactSize = Strings.Size;
+}
+
+ImGuiID ImGuiIDHashCache::GetID(const char* str, const char* str_end, ImGuiID seed)
+{
+    // Same convention as ImHashStr(): a zero size means the string is zero-terminated.
+    const int str_known_len = (str_end != NULL && str_end > str) ? (int)(str_end - str) : 0;
+    if (Cursor < Entries.Size)
+    {
+        // The copy has no zero byte, so when strncmp() succeeds 'str' is at least StrLen characters long and we can read str[StrLen].
+        const ImGuiIDHashCacheEntry& entry = Entries[Cursor];
+        if (entry.Str == str && entry.Seed == seed)
+        {
+            const char* str_copy = Strings.Data + entry.StrOffset;
+            if (str_known_len ? (str_known_len == entry.StrLen && memcmp(str, str_copy, (size_t)str_known_len) == 0) : (strncmp(str, str_copy, (size_t)entry.StrLen) == 0 && str[entry.StrLen] == 0))
+            {
+                Cursor++;
+                return entry.ID;
+            }
+        }
+    }
+
+    // Miss: hash the label and record the call at this position (we still record a call we don't memoize, to stay in sync with the next ones)
+    const int str_len = str_known_len ? str_known_len : (int)strlen(str);
+    const ImGuiID id = ImHashStr(str, (size_t)str_len, seed);
+    if (Cursor >= ID_HASH_CACHE_MAX_ENTRIES)
+        return id;
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Context);
+    if (Cursor == Entries.Size)
+        Entries.push_back(ImGuiIDHashCacheEntry());
+    ImGuiIDHashCacheEntry& entry = Entries[Cursor++];
+    const bool memoize = (str_len <= ID_HASH_CACHE_MAX_STR_LEN) && (str_known_len == 0 || memchr(str, 0, (size_t)str_len) == NULL);
+    entry.Str = memoize ? str : NULL;
+    entry.Seed = seed;
+    entry.ID = id;
+    entry.StrLen = str_len;
+    entry.StrOffset = memoize ? AddString(str, str, str_len) : 0;
+    return id;
+}
+
 ImGuiID ImGuiWindow::GetID(const char* str, const char* str_end)
 {
     ImGuiID seed = IDStack.back();
-    ImGuiID id = ImHashStr(str, str_end ? (str_end - str) : 0, seed);
+    ImGuiID id = IDHashCache.GetID(str, str_end, seed);
     ImGui::KeepAliveID(id);
 #ifdef IMGUI_ENABLE_TEST_ENGINE
     ImGuiContext& g = *GImGui;
@@ -2860,6 +3595,18 @@ ImGuiID ImGuiWindow::GetID(const char* str, const char* str_end)
     return id;
 }
 
+ImGuiID ImGuiWindow::GetID(const ImGuiLabelHash& label)
+{
+    ImGuiID seed = IDStack.back();
+    ImGuiID id = ImHashLabel(label, seed);
+    ImGui::KeepAliveID(id);
+#ifdef IMGUI_ENABLE_TEST_ENGINE
+    ImGuiContext& g = *GImGui;
+    IMGUI_TEST_ENGINE_ID_INFO2(id, ImGuiDataType_String, label.Label, NULL);
+#endif
+    return id;
+}
+
 ImGuiID ImGuiWindow::GetID(const void* ptr)
 {
     ImGuiID seed = IDStack.back();
@@ -2887,7 +3634,7 @@ ImGuiID ImGuiWindow::GetID(int n)
 ImGuiID ImGuiWindow::GetIDNoKeepAlive(const char* str, const char* str_end)
 {
     ImGuiID seed = IDStack.back();
-    ImGuiID id = ImHashStr(str, str_end ? (str_end - str) : 0, seed);
+    ImGuiID id = IDHashCache.GetID(str, str_end, seed);
 #ifdef IMGUI_ENABLE_TEST_ENGINE
     ImGuiContext& g = *GImGui;
     IMGUI_TEST_ENGINE_ID_INFO2(id, ImGuiDataType_String, str, str_end);
@@ -2895,6 +3642,17 @@ ImGuiID ImGuiWindow::GetIDNoKeepAlive(const char* str, const char* str_end)
     return id;
 }
 
+ImGuiID ImGuiWindow::GetIDNoKeepAlive(const ImGuiLabelHash& label)
+{
+    ImGuiID seed = IDStack.back();
+    ImGuiID id = ImHashLabel(label, seed);
+#ifdef IMGUI_ENABLE_TEST_ENGINE
+    ImGuiContext& g = *GImGui;
+    IMGUI_TEST_ENGINE_ID_INFO2(id, ImGuiDataType_String, label.Label, NULL);
+#endif
+    return id;
+}
+
 ImGuiID ImGuiWindow::GetIDNoKeepAlive(const void* ptr)
 {
     ImGuiID seed = IDStack.back();
@@ -2936,17 +3694,24 @@ static void SetCurrentWindow(ImGuiWindow* window)
 }
 
 // Free up/compact internal window buffers, we can use this when a window becomes unused.
-// This is currently unused by the library, but you may call this yourself for easy GC.
+// This is called by NewFrame() for windows unused for io.ConfigWindowsMemoryCompactTimer seconds, or earlier when over io.ConfigWindowsMemoryBudget.
 // Not freed:
 // - ImGuiWindow, ImGuiWindowSettings, Name
 // - StateStorage, ColumnsStorage (may hold useful data)
 // This should have no noticeable visual effect. When the window reappear however, expect new allocation/buffer growth/copy cost.
 void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
 {
+    // Remember capacity to restore when awakening, but not more than recent usage needs, so a past spike doesn't get reallocated.
     window->MemoryCompacted = true;
     window->MemoryDrawListIdxCapacity = window->DrawList->IdxBuffer.Capacity;
     window->MemoryDrawListVtxCapacity = window->DrawList->VtxBuffer.Capacity;
+    if (window->MemoryDrawListIdxPeak > 0 || window->MemoryDrawListIdxAverage > 0.0f)
+    {
+        window->MemoryDrawListIdxCapacity = ImMin(window->MemoryDrawListIdxCapacity, ImMax((int)(window->MemoryDrawListIdxAverage * 1.5f), window->MemoryDrawListIdxPeak));
+        window->MemoryDrawListVtxCapacity = ImMin(window->MemoryDrawListVtxCapacity, ImMax((int)(window->MemoryDrawListVtxAverage * 1.5f), window->MemoryDrawListVtxPeak));
+    }
     window->IDStack.clear();
+    window->IDHashCache.Clear();
     window->DrawList->_ClearFreeMemory();
     window->DC.ChildWindows.clear();
     window->DC.ItemFlagsStack.clear();
@@ -2955,14 +3720,113 @@ void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
     window->DC.GroupStack.clear();
 }
 
-void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
+void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
+{
+    // We stored capacity of the ImDrawList buffer to reduce growth-caused allocation/copy when awakening.
+    // The other buffers tends to amortize much faster.
+    window->MemoryCompacted = false;
+    window->DrawList->IdxBuffer.reserve(window->MemoryDrawListIdxCapacity);
+    window->DrawList->VtxBuffer.reserve(window->MemoryDrawListVtxCapacity);
+    window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
+}
+
+// Reallocate a buffer down to 'capacity' elements (never below its current size), return number of bytes released.
+template<typename T>
+static size_t GcShrinkVector(ImVector<T>& v, int capacity)
+{
+    capacity = ImMax(capacity, v.Size);
+    if (v.Capacity <= capacity)
+        return 0;
+    const size_t reclaimed_bytes = (size_t)(v.Capacity - capacity) * sizeof(T);
+    ImVector<T> new_v;
+    new_v.reserve(capacity);
+    if (v.Size > 0)
+    {
+        new_v.resize(v.Size);
+        memcpy(new_v.Data, v.Data, (size_t)v.Size * sizeof(T));
+    }
+    v.swap(new_v);
+    return reclaimed_bytes;
+}
+
+// Shrink draw list buffers of an active window down to its recent usage (moving average with some headroom, but not less than the recent peak).
+// Return number of bytes released.
+size_t ImGui::GcShrinkTransientWindowBuffers(ImGuiWindow* window)
+{
+    ImDrawList* draw_list = window->DrawList;
+    size_t reclaimed_bytes = 0;
+    reclaimed_bytes += GcShrinkVector(draw_list->IdxBuffer, ImMax((int)(window->MemoryDrawListIdxAverage * 1.5f), window->MemoryDrawListIdxPeak));
+    reclaimed_bytes += GcShrinkVector(draw_list->VtxBuffer, ImMax((int)(window->MemoryDrawListVtxAverage * 1.5f), window->MemoryDrawListVtxPeak));
+    return reclaimed_bytes;
+}
+
+size_t ImGui::GcGetTransientWindowBuffersSize(ImGuiWindow* window)
+{
+    ImDrawList* draw_list = window->DrawList;
+    return (size_t)draw_list->IdxBuffer.Capacity * sizeof(ImDrawIdx) + (size_t)draw_list->VtxBuffer.Capacity * sizeof(ImDrawVert) + (size_t)draw_list->CmdBuffer.Capacity * sizeof(ImDrawCmd);
+}
+
+// Called by NewFrame() for windows which were active during the last frame, before Begin() resets their draw list.
+// Sample draw list usage, and every 'shrink_timer' seconds shrink buffers which have become more than twice as large as needed.
+static size_t GcUpdateTransientWindowBuffers(ImGuiWindow* window, float shrink_timer)
+{
+    ImGuiContext& g = *GImGui;
+    ImDrawList* draw_list = window->DrawList;
+    const float k = ImMin(g.IO.DeltaTime / shrink_timer, 1.0f);
+    window->MemoryDrawListIdxAverage += (draw_list->IdxBuffer.Size - window->MemoryDrawListIdxAverage) * k;
+    window->MemoryDrawListVtxAverage += (draw_list->VtxBuffer.Size - window->MemoryDrawListVtxAverage) * k;
+    window->MemoryDrawListIdxPeak = ImMax(window->MemoryDrawListIdxPeak, draw_list->IdxBuffer.Size);
+    window->MemoryDrawListVtxPeak = ImMax(window->MemoryDrawListVtxPeak, draw_list->VtxBuffer.Size);
+    window->MemoryShrinkTimer += g.IO.DeltaTime;
+    if (window->MemoryShrinkTimer < shrink_timer)
+        return 0;
+
+    size_t reclaimed_bytes = 0;
+    const int idx_needed = ImMax((int)(window->MemoryDrawListIdxAverage * 1.5f), window->MemoryDrawListIdxPeak);
+    const int vtx_needed = ImMax((int)(window->MemoryDrawListVtxAverage * 1.5f), window->MemoryDrawListVtxPeak);
+    const int idx_excess_bytes = (draw_list->IdxBuffer.Capacity - idx_needed) * (int)sizeof(ImDrawIdx);
+    const int vtx_excess_bytes = (draw_list->VtxBuffer.Capacity - vtx_needed) * (int)sizeof(ImDrawVert);
+    if ((draw_list->IdxBuffer.Capacity > idx_needed * 2 && idx_excess_bytes >= WINDOWS_MEMORY_SHRINK_MIN_BYTES) || (draw_list->VtxBuffer.Capacity > vtx_needed * 2 && vtx_excess_bytes >= WINDOWS_MEMORY_SHRINK_MIN_BYTES))
+        reclaimed_bytes = ImGui::GcShrinkTransientWindowBuffers(window);
+    window->MemoryDrawListIdxPeak = draw_list->IdxBuffer.Size;
+    window->MemoryDrawListVtxPeak = draw_list->VtxBuffer.Size;
+    window->MemoryShrinkTimer = 0.0f;
+    return reclaimed_bytes;
+}
+
+static int IMGUI_CDECL GcWindowComparerByLastTimeActive(const void* lhs, const void* rhs)
+{
+    const ImGuiWindow* a = *(const ImGuiWindow* const *)lhs;
+    const ImGuiWindow* b = *(const ImGuiWindow* const *)rhs;
+    return (a->LastTimeActive < b->LastTimeActive) ? -1 : (a->LastTimeActive > b->LastTimeActive) ? +1 : 0;
+}
+
+// Called by NewFrame() when window draw buffers of all contexts are over io.ConfigWindowsMemoryBudget.
+// Compact inactive windows of the current context in least recently used order, then if needed shrink active windows to their recent usage.
+// Return number of bytes released.
+static size_t GcEnforceWindowsMemoryBudget(size_t over_budget_bytes)
 {
-    // We stored capacity of the ImDrawList buffer to reduce growth-caused allocation/copy when awakening.
-    // The other buffers tends to amortize much faster.
-    window->MemoryCompacted = false;
-    window->DrawList->IdxBuffer.reserve(window->MemoryDrawListIdxCapacity);
-    window->DrawList->VtxBuffer.reserve(window->MemoryDrawListVtxCapacity);
-    window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
+    ImGuiContext& g = *GImGui;
+    ImVector<ImGuiWindow*>& candidates = g.WindowsTempSortBuffer;
+    candidates.resize(0);
+    for (int i = 0; i != g.Windows.Size; i++)
+        if (!g.Windows[i]->WasActive && !g.Windows[i]->MemoryCompacted)
+            candidates.push_back(g.Windows[i]);
+    if (candidates.Size > 1)
+        ImQsort(candidates.Data, (size_t)candidates.Size, sizeof(ImGuiWindow*), GcWindowComparerByLastTimeActive);
+
+    size_t reclaimed_bytes = 0;
+    for (int i = 0; i != candidates.Size && reclaimed_bytes < over_budget_bytes; i++)
+    {
+        const size_t window_bytes = ImGui::GcGetTransientWindowBuffersSize(candidates[i]);
+        ImGui::GcCompactTransientWindowBuffers(candidates[i]);
+        reclaimed_bytes += window_bytes;
+    }
+    candidates.resize(0);
+    for (int i = 0; i != g.Windows.Size && reclaimed_bytes < over_budget_bytes; i++)
+        if (g.Windows[i]->WasActive && !g.Windows[i]->MemoryCompacted)
+            reclaimed_bytes += ImGui::GcShrinkTransientWindowBuffers(g.Windows[i]);
+    return reclaimed_bytes;
 }
 
 void ImGui::SetActiveID(ImGuiID id, ImGuiWindow* window)
@@ -3233,21 +4097,139 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
     return ImMax(wrap_pos_x - pos.x, 1.0f);
 }
 
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+static void MemTrackCheckBudget(ImGuiMemTag tag)
+{
+    ImGuiMemTagStats& stats = GImMemTagStats[tag];
+    if (stats.BudgetExceeded || stats.BudgetBytes == 0 || stats.LiveBytes <= stats.BudgetBytes)
+        return;
+    stats.BudgetExceeded = true;
+    if (GImGui != NULL)
+        IMGUI_DEBUG_LOG("MemAlloc: '%s' allocations over budget: %u > %u bytes\n", GImMemTagNames[tag], (unsigned int)stats.LiveBytes, (unsigned int)stats.BudgetBytes);
+}
+#endif
+
 // IM_ALLOC() == ImGui::MemAlloc()
 void* ImGui::MemAlloc(size_t size)
 {
     if (ImGuiContext* ctx = GImGui)
+    {
         ctx->IO.MetricsActiveAllocations++;
+        ctx->FrameAllocCount++;
+        ctx->FrameAllocBytes += size;
+    }
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+    ImGuiMemTrackHeader* header = (ImGuiMemTrackHeader*)GImAllocatorAllocFunc(size + IM_MEMTRACK_HEADER_SIZE, GImAllocatorUserData);
+    if (header == NULL)
+        return NULL;
+    header->Size = size;
+    header->Tag = GImMemTagCurrent;
+    ImGuiMemTagStats& stats = GImMemTagStats[header->Tag];
+    stats.LiveBytes += size;
+    stats.LiveAllocs++;
+    stats.AllocsThisFrame++;
+    if (stats.PeakBytes < stats.LiveBytes)
+        stats.PeakBytes = stats.LiveBytes;
+    MemTrackCheckBudget(header->Tag);
+    return (char*)header + IM_MEMTRACK_HEADER_SIZE;
+#else
     return GImAllocatorAllocFunc(size, GImAllocatorUserData);
+#endif
 }
 
 // IM_FREE() == ImGui::MemFree()
 void ImGui::MemFree(void* ptr)
 {
-    if (ptr)
-        if (ImGuiContext* ctx = GImGui)
-            ctx->IO.MetricsActiveAllocations--;
-    return GImAllocatorFreeFunc(ptr, GImAllocatorUserData);
+    if (ptr == NULL)
+        return;
+    if (ImGuiContext* ctx = GImGui)
+    {
+        // Memory returned by MemAllocFrame() is released by NewFrame(). Only checked when asserts are enabled: Contains() scans the
+        // arena blocks when 'ptr' falls within their address range, which heap allocations interleaved with the blocks may do.
+        IM_ASSERT(!ctx->FrameArena.Contains(ptr) && "Don't call MemFree() on memory returned by MemAllocFrame()!");
+        ctx->IO.MetricsActiveAllocations--;
+    }
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+    ImGuiMemTrackHeader* header = (ImGuiMemTrackHeader*)(void*)((char*)ptr - IM_MEMTRACK_HEADER_SIZE);
+    IM_ASSERT(header->Tag >= 0 && header->Tag < ImGuiMemTag_COUNT && "Corrupted allocation header, or freeing memory which wasn't allocated with MemAlloc()!");
+    ImGuiMemTagStats& stats = GImMemTagStats[header->Tag];
+    IM_ASSERT(stats.LiveBytes >= header->Size && stats.LiveAllocs > 0);
+    stats.LiveBytes -= header->Size;
+    stats.LiveAllocs--;
+    ptr = header;
+#endif
+    GImAllocatorFreeFunc(ptr, GImAllocatorUserData);
+}
+
+// Transient allocation, valid until next NewFrame() on the current context. Don't call MemFree() on it.
+void* ImGui::MemAllocFrame(size_t size)
+{
+    ImGuiContext& g = *GImGui;
+    return g.FrameArena.Alloc(size);
+}
+
+ImGuiMemTag ImGui::MemSetTag(ImGuiMemTag tag)
+{
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+    IM_ASSERT(tag >= 0 && tag < ImGuiMemTag_COUNT);
+    ImGuiMemTag backup_tag = GImMemTagCurrent;
+    GImMemTagCurrent = tag;
+    return backup_tag;
+#else
+    IM_UNUSED(tag);
+    return ImGuiMemTag_Misc;
+#endif
+}
+
+// Return NULL when memory tracking is disabled
+const ImGuiMemTagStats* ImGui::MemGetTagStats(ImGuiMemTag tag)
+{
+    IM_ASSERT(tag >= 0 && tag < ImGuiMemTag_COUNT);
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+    return &GImMemTagStats[tag];
+#else
+    return NULL;
+#endif
+}
+
+void ImGui::MemSetTagBudget(ImGuiMemTag tag, size_t budget_bytes)
+{
+    IM_ASSERT(tag >= 0 && tag < ImGuiMemTag_COUNT);
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+    GImMemTagStats[tag].BudgetBytes = budget_bytes;
+    GImMemTagStats[tag].BudgetExceeded = false;
+    MemTrackCheckBudget(tag);
+#else
+    IM_UNUSED(budget_bytes);
+#endif
+}
+
+void ImGui::MemExportStats(ImGuiTextBuffer* buf, bool json)
+{
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+    // Take a copy first, as appending to the output buffer allocates.
+    ImGuiMemTagStats stats_copy[ImGuiMemTag_COUNT];
+    memcpy(stats_copy, GImMemTagStats, sizeof(stats_copy));
+    if (json)
+        buf->append("[\n");
+    else
+        buf->append("tag,live_bytes,peak_bytes,live_allocs,allocs_last_frame,budget_bytes,budget_exceeded\n");
+    for (int tag = 0; tag < ImGuiMemTag_COUNT; tag++)
+    {
+        const ImGuiMemTagStats& stats = stats_copy[tag];
+        if (json)
+            buf->appendf("  { \"tag\": \"%s\", \"live_bytes\": %llu, \"peak_bytes\": %llu, \"live_allocs\": %d, \"allocs_last_frame\": %d, \"budget_bytes\": %llu, \"budget_exceeded\": %s }%s\n",
+                GImMemTagNames[tag], (unsigned long long)stats.LiveBytes, (unsigned long long)stats.PeakBytes, stats.LiveAllocs, stats.AllocsLastFrame, (unsigned long long)stats.BudgetBytes, stats.BudgetExceeded ? "true" : "false", (tag + 1 < ImGuiMemTag_COUNT) ? "," : "");
+        else
+            buf->appendf("%s,%llu,%llu,%d,%d,%llu,%d\n",
+                GImMemTagNames[tag], (unsigned long long)stats.LiveBytes, (unsigned long long)stats.PeakBytes, stats.LiveAllocs, stats.AllocsLastFrame, (unsigned long long)stats.BudgetBytes, stats.BudgetExceeded ? 1 : 0);
+    }
+    if (json)
+        buf->append("]\n");
+#else
+    IM_UNUSED(buf);
+    IM_UNUSED(json);
+#endif
 }
 
 const char* ImGui::GetClipboardText()
@@ -3293,6 +4275,7 @@ void ImGui::SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data
 
 ImGuiContext* ImGui::CreateContext(ImFontAtlas* shared_font_atlas)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Context);
     ImGuiContext* ctx = IM_NEW(ImGuiContext)(shared_font_atlas);
     if (GImGui == NULL)
         SetCurrentContext(ctx);
@@ -3742,6 +4725,21 @@ void ImGui::NewFrame()
     // Check and assert for various common IO and Configuration mistakes
     ErrorCheckNewFrameSanityChecks();
 
+    // Release transient allocations from the previous frame, publish allocation statistics
+    g.IO.MetricsFrameAllocations = g.FrameAllocCount;
+    g.IO.MetricsFrameAllocatedBytes = (int)g.FrameAllocBytes;
+    g.IO.MetricsFrameArenaBytes = (int)g.FrameArena.AllocBytes;
+    g.FrameArena.Reset();
+    g.FrameAllocCount = 0;
+    g.FrameAllocBytes = 0;
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+    for (int tag = 0; tag < ImGuiMemTag_COUNT; tag++)
+    {
+        GImMemTagStats[tag].AllocsLastFrame = GImMemTagStats[tag].AllocsThisFrame;
+        GImMemTagStats[tag].AllocsThisFrame = 0;
+    }
+#endif
+
     // Load settings on first frame, save settings when modified (after a delay)
     UpdateSettings();
 
@@ -3758,7 +4756,9 @@ void ImGui::NewFrame()
     g.FramerateSecPerFrameIdx = (g.FramerateSecPerFrameIdx + 1) % IM_ARRAYSIZE(g.FramerateSecPerFrame);
     g.IO.Framerate = (g.FramerateSecPerFrameAccum > 0.0f) ? (1.0f / (g.FramerateSecPerFrameAccum / (float)IM_ARRAYSIZE(g.FramerateSecPerFrame))) : FLT_MAX;
 
-    // Setup current font and draw list shared data
+    // Rasterize glyphs requested during previous frame (ImFontConfig::LazyRasterize), then setup current font and draw list shared data
+    if (g.IO.Fonts->LazyBuildData != NULL)
+        ImFontAtlasBuildLazyGlyphs(g.IO.Fonts);
     g.IO.Fonts->Locked = true;
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
@@ -3873,6 +4873,9 @@ void ImGui::NewFrame()
     // Mark all windows as not visible and compact unused memory.
     IM_ASSERT(g.WindowsFocusOrder.Size == g.Windows.Size);
     const float memory_compact_start_time = (g.IO.ConfigWindowsMemoryCompactTimer >= 0.0f) ? (float)g.Time - g.IO.ConfigWindowsMemoryCompactTimer : FLT_MAX;
+    const float memory_shrink_timer = g.IO.ConfigWindowsMemoryShrinkTimer;
+    size_t memory_reclaimed = 0;
+    size_t memory_transient = 0;
     for (int i = 0; i != g.Windows.Size; i++)
     {
         ImGuiWindow* window = g.Windows[i];
@@ -3881,10 +4884,41 @@ void ImGui::NewFrame()
         window->Active = false;
         window->WriteAccessed = false;
 
-        // Garbage collect transient buffers of recently unused windows
+        // Garbage collect transient buffers of recently unused windows,
+        // shrink buffers of active windows which are left much larger than their recent usage (e.g. after a one-time spike)
         if (!window->WasActive && !window->MemoryCompacted && window->LastTimeActive < memory_compact_start_time)
+        {
+            memory_reclaimed += GcGetTransientWindowBuffersSize(window);
             GcCompactTransientWindowBuffers(window);
+        }
+        else if (window->WasActive && !window->MemoryCompacted && memory_shrink_timer > 0.0f)
+            memory_reclaimed += GcUpdateTransientWindowBuffers(window, memory_shrink_timer);
+        memory_transient += GcGetTransientWindowBuffersSize(window);
+    }
+
+    // Enforce the memory budget of window buffers, shared by all contexts
+    GImGcTransientBytes = GImGcTransientBytes - g.GcTransientBytes + memory_transient;
+    g.GcTransientBytes = memory_transient;
+    if (g.IO.ConfigWindowsMemoryBudget > 0 && GImGcTransientBytes > (size_t)g.IO.ConfigWindowsMemoryBudget)
+    {
+        const size_t budget_reclaimed = GcEnforceWindowsMemoryBudget(GImGcTransientBytes - (size_t)g.IO.ConfigWindowsMemoryBudget);
+        memory_reclaimed += budget_reclaimed;
+        memory_transient -= ImMin(budget_reclaimed, memory_transient);
+        GImGcTransientBytes -= g.GcTransientBytes - memory_transient;
+        g.GcTransientBytes = memory_transient;
     }
+    g.GcReclaimedBytesTotal += memory_reclaimed;
+    g.IO.MetricsWindowsMemoryBytes = (int)g.GcTransientBytes;
+    g.IO.MetricsWindowsMemoryReclaimed = (int)memory_reclaimed;
+
+    // Garbage collect line indices of multi-line text inputs which haven't been submitted recently (disabled with a negative ConfigWindowsMemoryCompactTimer)
+    if (g.IO.ConfigWindowsMemoryCompactTimer >= 0.0f)
+        for (int i = 0; i < g.InputTextLineCaches.Size; i++)
+            if (g.InputTextLineCaches[i]->LastTimeUsed < memory_compact_start_time)
+            {
+                IM_DELETE(g.InputTextLineCaches[i]);
+                g.InputTextLineCaches.erase(g.InputTextLineCaches.Data + i--);
+            }
 
     // Closing the focused window restore focus to the first active root window in descending z-order
     if (g.NavWindow && !g.NavWindow->WasActive)
@@ -3952,6 +4986,8 @@ void ImGui::Initialize(ImGuiContext* context)
         ini_handler.ReadLineFn = WindowSettingsHandler_ReadLine;
         ini_handler.ApplyAllFn = WindowSettingsHandler_ApplyAll;
         ini_handler.WriteAllFn = WindowSettingsHandler_WriteAll;
+        ini_handler.ReadBinaryFn = WindowSettingsHandler_ReadBinary;
+        ini_handler.WriteAllBinaryFn = WindowSettingsHandler_WriteAllBinary;
         g.SettingsHandlers.push_back(ini_handler);
     }
 
@@ -4010,6 +5046,10 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.Windows.clear();
     g.WindowsFocusOrder.clear();
     g.WindowsTempSortBuffer.clear();
+    g.WindowsHitGrid.ClearFreeMemory();
+    g.FrameArena.ClearFreeMemory();
+    GImGcTransientBytes -= g.GcTransientBytes;
+    g.GcTransientBytes = 0;
     g.CurrentWindow = NULL;
     g.CurrentWindowStack.clear();
     g.WindowsById.Clear();
@@ -4031,10 +5071,20 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.ShrinkWidthBuffer.clear();
 
     g.ClipboardHandlerData.clear();
+    g.PlotColumns.clear();
+    g.PlotColumnsMean.clear();
+    g.ComboStringItems.clear();
+    g.BoxSelectInitial.Bounds.clear();
+    g.TreeViewNewRows.clear();
+    g.TreeViewStack.clear();
     g.MenusIdSubmittedThisFrame.clear();
     g.InputTextState.ClearFreeMemory();
+    for (int i = 0; i < g.InputTextLineCaches.Size; i++)
+        IM_DELETE(g.InputTextLineCaches[i]);
+    g.InputTextLineCaches.clear();
 
     g.SettingsWindows.clear();
+    g.SettingsWindowsMap.Clear();
     g.SettingsHandlers.clear();
 
     if (g.LogFile)
@@ -4062,14 +5112,25 @@ static int IMGUI_CDECL ChildWindowComparer(const void* lhs, const void* rhs)
     return (a->BeginOrderWithinParent - b->BeginOrderWithinParent);
 }
 
+// Child windows are mostly submitted in order already, only call ImQsort() when needed.
+static void SortChildWindows(ImGuiWindow* window)
+{
+    ImVector<ImGuiWindow*>& children = window->DC.ChildWindows;
+    for (int i = 1; i < children.Size; i++)
+        if (ChildWindowComparer(&children.Data[i - 1], &children.Data[i]) > 0)
+        {
+            ImQsort(children.Data, (size_t)children.Size, sizeof(ImGuiWindow*), ChildWindowComparer);
+            return;
+        }
+}
+
 static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window)
 {
     out_sorted_windows->push_back(window);
     if (window->Active)
     {
         int count = window->DC.ChildWindows.Size;
-        if (count > 1)
-            ImQsort(window->DC.ChildWindows.Data, (size_t)count, sizeof(ImGuiWindow*), ChildWindowComparer);
+        SortChildWindows(window);
         for (int i = 0; i < count; i++)
         {
             ImGuiWindow* child = window->DC.ChildWindows[i];
@@ -4081,6 +5142,7 @@ static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, Im
 
 static void AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* draw_list)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawList);
     // Remove trailing command if unused.
     // Technically we could return directly instead of popping, but this make things looks neat in Metrics window as well.
     draw_list->_PopUnusedDrawCmd();
@@ -4246,19 +5308,50 @@ void ImGui::EndFrame()
 
     // Sort the window list so that all child windows are after their parent
     // We cannot do that on FocusWindow() because children may not exist yet
-    g.WindowsTempSortBuffer.resize(0);
-    g.WindowsTempSortBuffer.reserve(g.Windows.Size);
-    for (int i = 0; i != g.Windows.Size; i++)
+    // The result only depends on the current order and on the Active/ParentWindow/BeginOrderWithinParent/Flags fields of each window:
+    // when none of them changed since the last sort (which is the case for most frames) the order is already correct.
+    const ImGuiWindowFlags sort_flags_mask = ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_Popup | ImGuiWindowFlags_Tooltip;
+    bool sort_dirty = g.WindowsSortDirty;
+    for (int i = 0; i != g.Windows.Size && !sort_dirty; i++)
     {
         ImGuiWindow* window = g.Windows[i];
-        if (window->Active && (window->Flags & ImGuiWindowFlags_ChildWindow))       // if a child is active its parent will add it
-            continue;
-        AddWindowToSortBuffer(&g.WindowsTempSortBuffer, window);
+        if (window->SortActive != window->Active || window->SortParentWindow != window->ParentWindow || window->SortBeginOrderWithinParent != window->BeginOrderWithinParent || window->SortFlags != (window->Flags & sort_flags_mask))
+            sort_dirty = true;
     }
+    if (sort_dirty)
+    {
+        g.WindowsTempSortBuffer.resize(0);
+        g.WindowsTempSortBuffer.reserve(g.Windows.Size);
+        for (int i = 0; i != g.Windows.Size; i++)
+        {
+            ImGuiWindow* window = g.Windows[i];
+            if (window->Active && (window->Flags & ImGuiWindowFlags_ChildWindow))       // if a child is active its parent will add it
+                continue;
+            AddWindowToSortBuffer(&g.WindowsTempSortBuffer, window);
+        }
 
-    // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
-    IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
-    g.Windows.swap(g.WindowsTempSortBuffer);
+        // This usually assert if there is a mismatch between the ImGuiWindowFlags_ChildWindow / ParentWindow values and DC.ChildWindows[] in parents, aka we've done something wrong.
+        IM_ASSERT(g.Windows.Size == g.WindowsTempSortBuffer.Size);
+        if (memcmp(g.Windows.Data, g.WindowsTempSortBuffer.Data, (size_t)g.Windows.size_in_bytes()) != 0)
+            g.WindowsHitGrid.OrderDirty = true;
+        g.Windows.swap(g.WindowsTempSortBuffer);
+        for (int i = 0; i != g.Windows.Size; i++)
+        {
+            ImGuiWindow* window = g.Windows[i];
+            window->SortActive = window->Active;
+            window->SortParentWindow = window->ParentWindow;
+            window->SortBeginOrderWithinParent = window->BeginOrderWithinParent;
+            window->SortFlags = (window->Flags & sort_flags_mask);
+        }
+        g.WindowsSortDirty = false;
+    }
+    else
+    {
+        // DC.ChildWindows[] are rebuilt by Begin() every frame, they still need sorting for Render().
+        for (int i = 0; i != g.Windows.Size; i++)
+            if (g.Windows[i]->Active && g.Windows[i]->DC.ChildWindows.Size > 1)
+                SortChildWindows(g.Windows[i]);
+    }
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     // Unlock font atlas
@@ -4344,10 +5437,114 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     return text_size;
 }
 
+// Padding applied to window rectangles by FindHoveredWindow(). Windows that can be resized from their edges get a larger padding.
+static inline ImVec2 GetWindowHitTestPadding()
+{
+    ImGuiContext& g = *GImGui;
+    return ImMax(g.Style.TouchExtraPadding, ImVec2(WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS, WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS));
+}
+
+static bool IsWindowHitByPoint(ImGuiWindow* window, const ImVec2& pos, const ImVec2& padding_regular, const ImVec2& padding_for_resize_from_edges)
+{
+    if (!window->Active || window->Hidden)
+        return false;
+    if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
+        return false;
+
+    // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
+    ImRect bb(window->OuterRectClipped);
+    if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize))
+        bb.Expand(padding_regular);
+    else
+        bb.Expand(padding_for_resize_from_edges);
+    if (!bb.Contains(pos))
+        return false;
+
+    // Support for one rectangular hole in any given window
+    // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
+    if (window->HitTestHoleSize.x != 0)
+    {
+        ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
+        ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
+        if (ImRect(hole_pos, hole_pos + hole_size).Contains(pos))
+            return false;
+    }
+    return true;
+}
+
+// Setup cells to cover the display area, re-registering every window when the display size or hit-test padding changed.
+static void SetupWindowHitGrid()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowHitGrid* grid = &g.WindowsHitGrid;
+    const ImVec2 padding = GetWindowHitTestPadding();
+    const ImVec2 display_size = ImMax(g.IO.DisplaySize, ImVec2(0.0f, 0.0f));
+    if (grid->Cells.Size > 0 && grid->DisplaySize.x == display_size.x && grid->DisplaySize.y == display_size.y && grid->Padding.x == padding.x && grid->Padding.y == padding.y)
+        return;
+
+    for (int n = 0; n < grid->Cells.Size; n++)
+        grid->Cells[n].Windows.clear();
+    grid->DisplaySize = display_size;
+    grid->Padding = padding;
+    grid->Origin = ImVec2(-padding.x, -padding.y);
+    const ImVec2 area_size = display_size + padding * 2.0f;
+    grid->CellCount.x = (short)ImClamp((int)ImCeil(area_size.x / WINDOWS_HIT_GRID_CELL_SIZE), 1, WINDOWS_HIT_GRID_CELL_COUNT_MAX);
+    grid->CellCount.y = (short)ImClamp((int)ImCeil(area_size.y / WINDOWS_HIT_GRID_CELL_SIZE), 1, WINDOWS_HIT_GRID_CELL_COUNT_MAX);
+    grid->CellSize = ImVec2(ImMax(area_size.x / grid->CellCount.x, 1.0f), ImMax(area_size.y / grid->CellCount.y, 1.0f));
+    const int cells_count = grid->CellCount.x * grid->CellCount.y;
+    if (grid->Cells.Size < cells_count)
+        grid->Cells.resize(cells_count, ImGuiWindowHitGridCell());
+
+    for (int i = 0; i < g.Windows.Size; i++)
+    {
+        ImGuiWindow* window = g.Windows[i];
+        window->HitGridCellMin = ImVec2ih(0, 0);
+        window->HitGridCellMax = ImVec2ih(-1, -1);
+        UpdateWindowHitGridCells(window);
+    }
+}
+
+// Called by Begin() after updating OuterRectClipped, keep the window registered in cells overlapping its hit-test rectangle.
+static void UpdateWindowHitGridCells(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowHitGrid* grid = &g.WindowsHitGrid;
+    SetupWindowHitGrid();
+
+    // Compute new range of cells (empty if rectangle is empty or outside of the grid)
+    ImRect bb(window->OuterRectClipped);
+    bb.Expand(grid->Padding);
+    ImVec2ih cell_min(0, 0), cell_max(-1, -1);
+    if (bb.Min.x <= bb.Max.x && bb.Min.y <= bb.Max.y)
+    {
+        const ImVec2 min_f = (bb.Min - grid->Origin) / grid->CellSize;
+        const ImVec2 max_f = (bb.Max - grid->Origin) / grid->CellSize;
+        if (max_f.x >= 0.0f && max_f.y >= 0.0f && min_f.x < grid->CellCount.x && min_f.y < grid->CellCount.y)
+        {
+            cell_min = ImVec2ih((short)ImMax((int)min_f.x, 0), (short)ImMax((int)min_f.y, 0));
+            cell_max = ImVec2ih((short)ImMin((int)max_f.x, grid->CellCount.x - 1), (short)ImMin((int)max_f.y, grid->CellCount.y - 1));
+        }
+    }
+    if (cell_min.x == window->HitGridCellMin.x && cell_min.y == window->HitGridCellMin.y && cell_max.x == window->HitGridCellMax.x && cell_max.y == window->HitGridCellMax.y)
+        return;
+
+    // Unregister from previous cells, register in new cells
+    for (int y = window->HitGridCellMin.y; y <= window->HitGridCellMax.y; y++)
+        for (int x = window->HitGridCellMin.x; x <= window->HitGridCellMax.x; x++)
+            grid->Cells[y * grid->CellCount.x + x].Windows.find_erase_unsorted(window);
+    for (int y = cell_min.y; y <= cell_max.y; y++)
+        for (int x = cell_min.x; x <= cell_max.x; x++)
+            grid->Cells[y * grid->CellCount.x + x].Windows.push_back(window);
+    window->HitGridCellMin = cell_min;
+    window->HitGridCellMax = cell_max;
+}
+
 // Find window given position, search front-to-back
 // FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programmatically
 // with SetWindowPos() and not SetNextWindowPos() will have that rectangle lagging by a frame at the time FindHoveredWindow() is
 // called, aka before the next Begin(). Moving window isn't affected.
+// We use g.WindowsHitGrid to only test windows registered in the cell under the mouse, then keep the front-most hit according
+// to the g.Windows[] order. When the mouse is outside of the grid (e.g. dragging outside of the display area), we test all windows.
 static void FindHoveredWindow()
 {
     ImGuiContext& g = *GImGui;
@@ -4358,40 +5555,58 @@ static void FindHoveredWindow()
         hovered_window = g.MovingWindow;
 
     ImVec2 padding_regular = g.Style.TouchExtraPadding;
-    ImVec2 padding_for_resize_from_edges = g.IO.ConfigWindowsResizeFromEdges ? ImMax(g.Style.TouchExtraPadding, ImVec2(WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS, WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS)) : padding_regular;
-    for (int i = g.Windows.Size - 1; i >= 0; i--)
-    {
-        ImGuiWindow* window = g.Windows[i];
-        if (!window->Active || window->Hidden)
-            continue;
-        if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
-            continue;
+    ImVec2 padding_for_resize_from_edges = g.IO.ConfigWindowsResizeFromEdges ? GetWindowHitTestPadding() : padding_regular;
+    const ImVec2 mouse_pos = g.IO.MousePos;
 
-        // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
-        ImRect bb(window->OuterRectClipped);
-        if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize))
-            bb.Expand(padding_regular);
-        else
-            bb.Expand(padding_for_resize_from_edges);
-        if (!bb.Contains(g.IO.MousePos))
-            continue;
+    ImGuiWindowHitGrid* grid = &g.WindowsHitGrid;
+    SetupWindowHitGrid();
+    const ImVec2 mouse_cell = (mouse_pos - grid->Origin) / grid->CellSize;
+    if (!ImGui::IsMousePosValid(&mouse_pos))
+    {
+        // No window can contain an invalid mouse position
+    }
+    else if (mouse_cell.x >= 0.0f && mouse_cell.y >= 0.0f && mouse_cell.x < grid->CellCount.x && mouse_cell.y < grid->CellCount.y)
+    {
+        if (grid->OrderDirty)
+        {
+            for (int i = 0; i < g.Windows.Size; i++)
+                g.Windows[i]->HitGridOrder = i;
+            grid->OrderDirty = false;
+        }
 
-        // Support for one rectangular hole in any given window
-        // FIXME: Consider generalizing hit-testing override (with more generic data, callback, etc.) (#1512)
-        if (window->HitTestHoleSize.x != 0)
+        ImGuiWindow* hit_window = NULL;
+        ImGuiWindow* hit_window_ignoring_moving_window = NULL;
+        const ImVector<ImGuiWindow*>& cell_windows = grid->Cells[(int)mouse_cell.y * grid->CellCount.x + (int)mouse_cell.x].Windows;
+        for (int i = 0; i < cell_windows.Size; i++)
         {
-            ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
-            ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
-            if (ImRect(hole_pos, hole_pos + hole_size).Contains(g.IO.MousePos))
+            ImGuiWindow* window = cell_windows[i];
+            if (hit_window && window->HitGridOrder < hit_window->HitGridOrder && hit_window_ignoring_moving_window && window->HitGridOrder < hit_window_ignoring_moving_window->HitGridOrder)
+                continue;
+            if (!IsWindowHitByPoint(window, mouse_pos, padding_regular, padding_for_resize_from_edges))
                 continue;
+            if (hit_window == NULL || window->HitGridOrder > hit_window->HitGridOrder)
+                hit_window = window;
+            if ((!g.MovingWindow || window->RootWindow != g.MovingWindow->RootWindow) && (hit_window_ignoring_moving_window == NULL || window->HitGridOrder > hit_window_ignoring_moving_window->HitGridOrder))
+                hit_window_ignoring_moving_window = window;
         }
-
         if (hovered_window == NULL)
-            hovered_window = window;
-        if (hovered_window_ignoring_moving_window == NULL && (!g.MovingWindow || window->RootWindow != g.MovingWindow->RootWindow))
-            hovered_window_ignoring_moving_window = window;
-        if (hovered_window && hovered_window_ignoring_moving_window)
-            break;
+            hovered_window = hit_window;
+        hovered_window_ignoring_moving_window = hit_window_ignoring_moving_window;
+    }
+    else
+    {
+        for (int i = g.Windows.Size - 1; i >= 0; i--)
+        {
+            ImGuiWindow* window = g.Windows[i];
+            if (!IsWindowHitByPoint(window, mouse_pos, padding_regular, padding_for_resize_from_edges))
+                continue;
+            if (hovered_window == NULL)
+                hovered_window = window;
+            if (hovered_window_ignoring_moving_window == NULL && (!g.MovingWindow || window->RootWindow != g.MovingWindow->RootWindow))
+                hovered_window_ignoring_moving_window = window;
+            if (hovered_window && hovered_window_ignoring_moving_window)
+                break;
+        }
     }
 
     g.HoveredWindow = hovered_window;
@@ -4908,6 +6123,7 @@ static void ApplyWindowSettings(ImGuiWindow* window, ImGuiWindowSettings* settin
 
 static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Context);
     ImGuiContext& g = *GImGui;
     //IMGUI_DEBUG_LOG("CreateNewWindow '%s', flags = 0x%08X\n", name, flags);
 
@@ -4949,6 +6165,8 @@ static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
         g.Windows.push_front(window); // Quite slow but rare and only once
     else
         g.Windows.push_back(window);
+    g.WindowsHitGrid.OrderDirty = true;
+    g.WindowsSortDirty = true;
     return window;
 }
 
@@ -5472,6 +6690,7 @@ void ImGui::UpdateWindowParentAndRootLinks(ImGuiWindow* window, ImGuiWindowFlags
 // - Passing 'bool* p_open' displays a Close button on the upper-right corner of the window, the pointed value will be set to false when the button is pressed.
 bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_Context);
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
@@ -5610,6 +6829,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->HasCloseButton = (p_open != NULL);
         window->ClipRect = ImVec4(-FLT_MAX, -FLT_MAX, +FLT_MAX, +FLT_MAX);
         window->IDStack.resize(1);
+        window->IDHashCache.NewFrame();
         window->DrawList->_ResetForNewFrame();
 
         // Restore buffer capacity when woken from a compacted state, to avoid
@@ -5845,6 +7065,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         const ImRect title_bar_rect = window->TitleBarRect();
         window->OuterRectClipped = outer_rect;
         window->OuterRectClipped.ClipWith(host_rect);
+        UpdateWindowHitGridCells(window);
 
         // Inner rectangle
         // Not affected by window border size. Used by:
@@ -6164,6 +7385,8 @@ void ImGui::BringWindowToDisplayFront(ImGuiWindow* window)
         {
             memmove(&g.Windows[i], &g.Windows[i + 1], (size_t)(g.Windows.Size - i - 1) * sizeof(ImGuiWindow*));
             g.Windows[g.Windows.Size - 1] = window;
+            g.WindowsHitGrid.OrderDirty = true;
+            g.WindowsSortDirty = true;
             break;
         }
 }
@@ -6178,6 +7401,8 @@ void ImGui::BringWindowToDisplayBack(ImGuiWindow* window)
         {
             memmove(&g.Windows[1], &g.Windows[0], (size_t)i * sizeof(ImGuiWindow*));
             g.Windows[0] = window;
+            g.WindowsHitGrid.OrderDirty = true;
+            g.WindowsSortDirty = true;
             break;
         }
 }
@@ -6752,6 +7977,14 @@ void ImGui::PushID(const char* str_id_begin, const char* str_id_end)
     window->IDStack.push_back(id);
 }
 
+void ImGui::PushID(const ImGuiLabelHash& str_id)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiID id = window->GetIDNoKeepAlive(str_id);
+    window->IDStack.push_back(id);
+}
+
 void ImGui::PushID(const void* ptr_id)
 {
     ImGuiContext& g = *GImGui;
@@ -6808,6 +8041,12 @@ ImGuiID ImGui::GetID(const char* str_id_begin, const char* str_id_end)
     return window->GetID(str_id_begin, str_id_end);
 }
 
+ImGuiID ImGui::GetID(const ImGuiLabelHash& str_id)
+{
+    ImGuiWindow* window = GImGui->CurrentWindow;
+    return window->GetID(str_id);
+}
+
 ImGuiID ImGui::GetID(const void* ptr_id)
 {
     ImGuiWindow* window = GImGui->CurrentWindow;
@@ -9901,6 +11140,7 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
     IM_PLACEMENT_NEW(settings) ImGuiWindowSettings();
     settings->ID = ImHashStr(name, name_len);
     memcpy(settings->GetName(), name, name_len + 1);   // Store with zero terminator
+    g.SettingsWindowsMap.SetInt(settings->ID, g.SettingsWindows.offset_from_ptr(settings) + 1);
 
     return settings;
 }
@@ -9908,10 +11148,8 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
 ImGuiWindowSettings* ImGui::FindWindowSettings(ImGuiID id)
 {
     ImGuiContext& g = *GImGui;
-    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
-        if (settings->ID == id)
-            return settings;
-    return NULL;
+    const int offset_plus_one = g.SettingsWindowsMap.GetInt(id, 0);
+    return offset_plus_one ? g.SettingsWindows.ptr_from_offset(offset_plus_one - 1) : NULL;
 }
 
 ImGuiWindowSettings* ImGui::FindOrCreateWindowSettings(const char* name)
@@ -9931,6 +11169,151 @@ ImGuiSettingsHandler* ImGui::FindSettingsHandler(const char* type_name)
     return NULL;
 }
 
+// Binary settings format (io.IniSavingBinary), all integers are little-endian regardless of the platform:
+// - Header: "IMGUIBIN" + ImU32 version.
+// - Entries: ImU32 entry size (including this header, padded to 4 bytes), ImU32 flags, ImU32 type name size, ImU32 name size, ImU32 payload size, type name, name, payload.
+//   Sizes of the type name and name include their zero-terminator. The type name (e.g. "Window") is stored rather than its hash, as the hash
+//   function depends on compile-time options (see ImHashStr()) and the data must stay readable by any build.
+// - The payload is either a handler specific blob (SETTINGS_BINARY_ENTRY_BLOB, see WriteAllBinaryFn/ReadBinaryFn), or the zero-terminated text lines of the entry.
+// Saving in binary then in text format outputs the same .ini data as saving in text format directly.
+static const char   SETTINGS_BINARY_MAGIC[8] = { 'I', 'M', 'G', 'U', 'I', 'B', 'I', 'N' };
+static const ImU32  SETTINGS_BINARY_VERSION = 2;
+static const ImU32  SETTINGS_BINARY_ENTRY_BLOB = 1 << 0;
+static const size_t SETTINGS_BINARY_HEADER_SIZE = 12;
+static const size_t SETTINGS_BINARY_ENTRY_HEADER_SIZE = 20;
+
+static inline ImU32 SettingsBinaryReadU32(const unsigned char* p)  { return (ImU32)p[0] | ((ImU32)p[1] << 8) | ((ImU32)p[2] << 16) | ((ImU32)p[3] << 24); }
+static inline void  SettingsBinaryWriteU32(char* p, ImU32 v)         { p[0] = (char)(v & 0xFF); p[1] = (char)((v >> 8) & 0xFF); p[2] = (char)((v >> 16) & 0xFF); p[3] = (char)((v >> 24) & 0xFF); }
+
+static void SettingsBinaryAppendEntryEx(ImGuiTextBuffer* buf, const char* type_name, const char* type_name_end, ImU32 flags, const char* name, const char* name_end, const void* payload, size_t payload_size)
+{
+    const size_t type_name_size = (size_t)(type_name_end - type_name) + 1;
+    const size_t name_size = (size_t)(name_end - name) + 1;
+    const size_t entry_size = (SETTINGS_BINARY_ENTRY_HEADER_SIZE + type_name_size + name_size + payload_size + 3) & ~(size_t)3;
+    const char zeroes[4] = { 0, 0, 0, 0 };
+    char header[SETTINGS_BINARY_ENTRY_HEADER_SIZE];
+    SettingsBinaryWriteU32(header, (ImU32)entry_size);
+    SettingsBinaryWriteU32(header + 4, flags);
+    SettingsBinaryWriteU32(header + 8, (ImU32)type_name_size);
+    SettingsBinaryWriteU32(header + 12, (ImU32)name_size);
+    SettingsBinaryWriteU32(header + 16, (ImU32)payload_size);
+    buf->append(header, header + SETTINGS_BINARY_ENTRY_HEADER_SIZE);
+    buf->append(type_name, type_name_end);
+    buf->append(zeroes, zeroes + 1);
+    buf->append(name, name_end);
+    buf->append(zeroes, zeroes + 1);
+    if (payload_size > 0)
+        buf->append((const char*)payload, (const char*)payload + payload_size);
+    buf->append(zeroes, zeroes + (entry_size - SETTINGS_BINARY_ENTRY_HEADER_SIZE - type_name_size - name_size - payload_size));
+}
+
+// To be called by ImGuiSettingsHandler::WriteAllBinaryFn for each entry.
+// The payload is stored as is: write multi-byte values in a fixed byte order (e.g. little-endian) if the data may be shared between platforms.
+void ImGui::SettingsBinaryAppendEntry(ImGuiTextBuffer* buf, ImGuiSettingsHandler* handler, const char* name, const void* payload, size_t payload_size)
+{
+    SettingsBinaryAppendEntryEx(buf, handler->TypeName, handler->TypeName + strlen(handler->TypeName), SETTINGS_BINARY_ENTRY_BLOB, name, name + strlen(name), payload, payload_size);
+}
+
+// Convert .ini text output (e.g. from a handler without WriteAllBinaryFn) into binary entries.
+// Parsing is the same as LoadIniSettingsFromMemory(), minus the empty lines and comments which would be ignored when loading anyway.
+static void SettingsBinaryAppendTextEntries(ImGuiTextBuffer* buf, const char* text, const char* text_end)
+{
+    ImGuiTextBuffer payload;
+    const char* entry_type_name = NULL;
+    const char* entry_type_name_end = NULL;
+    const char* entry_name = NULL;
+    const char* entry_name_end = NULL;
+    const char* line_end = NULL;
+    for (const char* line = text; line < text_end; line = line_end + 1)
+    {
+        while (line < text_end && (*line == '\n' || *line == '\r'))
+            line++;
+        line_end = line;
+        while (line_end < text_end && *line_end != '\n' && *line_end != '\r')
+            line_end++;
+        if (line == line_end || line[0] == ';')
+            continue;
+        if (line[0] == '[' && line_end[-1] == ']')
+        {
+            const char* name_end = line_end - 1;
+            const char* type_start = line + 1;
+            const char* type_end = ImStrchrRange(type_start, name_end, ']');
+            const char* name_start = type_end ? ImStrchrRange(type_end + 1, name_end, '[') : NULL;
+            if (!type_end || !name_start)
+                continue;
+            if (entry_name != NULL)
+                SettingsBinaryAppendEntryEx(buf, entry_type_name, entry_type_name_end, 0, entry_name, entry_name_end, payload.Buf.Data, (size_t)payload.size());
+            payload.clear();
+            entry_type_name = type_start;
+            entry_type_name_end = type_end;
+            entry_name = name_start + 1;
+            entry_name_end = name_end;
+        }
+        else if (entry_name != NULL)
+        {
+            const char zero = 0;
+            payload.append(line, line_end);
+            payload.append(&zero, &zero + 1);
+        }
+    }
+    if (entry_name != NULL)
+        SettingsBinaryAppendEntryEx(buf, entry_type_name, entry_type_name_end, 0, entry_name, entry_name_end, payload.Buf.Data, (size_t)payload.size());
+}
+
+static bool IsSettingsDataBinary(const char* data, size_t data_size)
+{
+    return data_size >= SETTINGS_BINARY_HEADER_SIZE && memcmp(data, SETTINGS_BINARY_MAGIC, sizeof(SETTINGS_BINARY_MAGIC)) == 0;
+}
+
+// Read entries in place, without writing to (or copying) the buffer. Stop on truncated or corrupted data.
+// Sizes are checked one at a time against what's left of the entry, so a corrupted size can't make a sum wrap around (with 32-bit size_t).
+static void LoadSettingsFromMemoryBinary(const char* data, size_t data_size)
+{
+    ImGuiContext& g = *GImGui;
+    if (SettingsBinaryReadU32((const unsigned char*)data + sizeof(SETTINGS_BINARY_MAGIC)) != SETTINGS_BINARY_VERSION)
+        return;
+    const char* data_end = data + data_size;
+    for (const char* entry = data + SETTINGS_BINARY_HEADER_SIZE; (size_t)(data_end - entry) >= SETTINGS_BINARY_ENTRY_HEADER_SIZE; )
+    {
+        const unsigned char* header = (const unsigned char*)entry;
+        const size_t entry_size = SettingsBinaryReadU32(header);
+        const ImU32 flags = SettingsBinaryReadU32(header + 4);
+        const size_t type_name_size = SettingsBinaryReadU32(header + 8);
+        const size_t name_size = SettingsBinaryReadU32(header + 12);
+        const size_t payload_size = SettingsBinaryReadU32(header + 16);
+        if (entry_size < SETTINGS_BINARY_ENTRY_HEADER_SIZE || entry_size > (size_t)(data_end - entry))
+            break;
+        size_t entry_remaining = entry_size - SETTINGS_BINARY_ENTRY_HEADER_SIZE;
+        if (type_name_size == 0 || type_name_size > entry_remaining)
+            break;
+        entry_remaining -= type_name_size;
+        if (name_size == 0 || name_size > entry_remaining)
+            break;
+        entry_remaining -= name_size;
+        if (payload_size > entry_remaining)
+            break;
+        const char* type_name = entry + SETTINGS_BINARY_ENTRY_HEADER_SIZE;
+        const char* name = type_name + type_name_size;
+        const char* payload = name + name_size;
+        const char* payload_end = payload + payload_size;
+        if (type_name[type_name_size - 1] != 0 || name[name_size - 1] != 0 || (!(flags & SETTINGS_BINARY_ENTRY_BLOB) && payload_size > 0 && payload_end[-1] != 0))
+            break;
+        entry += entry_size;
+
+        ImGuiSettingsHandler* handler = ImGui::FindSettingsHandler(type_name);
+        if (handler == NULL || ((flags & SETTINGS_BINARY_ENTRY_BLOB) && handler->ReadBinaryFn == NULL))
+            continue;
+        void* entry_data = handler->ReadOpenFn(&g, handler, name);
+        if (entry_data == NULL)
+            continue;
+        if (flags & SETTINGS_BINARY_ENTRY_BLOB)
+            handler->ReadBinaryFn(&g, handler, entry_data, payload, payload_size);
+        else
+            for (const char* line = payload; line < payload_end; line += strlen(line) + 1)
+                handler->ReadLineFn(&g, handler, entry_data, line);
+    }
+}
+
 void ImGui::ClearIniSettings()
 {
     ImGuiContext& g = *GImGui;
@@ -9960,13 +11343,18 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
 
     // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
     // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
+    // Binary data (see io.IniSavingBinary) is read in place instead.
     if (ini_size == 0)
         ini_size = strlen(ini_data);
-    g.SettingsIniData.Buf.resize((int)ini_size + 1);
+    const bool is_binary = IsSettingsDataBinary(ini_data, ini_size);
+    g.SettingsIniData.Buf.resize(is_binary ? 0 : (int)ini_size + 1);
     char* const buf = g.SettingsIniData.Buf.Data;
-    char* const buf_end = buf + ini_size;
-    memcpy(buf, ini_data, ini_size);
-    buf_end[0] = 0;
+    char* const buf_end = buf + (is_binary ? 0 : ini_size);
+    if (!is_binary)
+    {
+        memcpy(buf, ini_data, ini_size);
+        buf_end[0] = 0;
+    }
 
     // Call pre-read handlers
     // Some types will clear their data (e.g. dock information) some types will allow merge/override (window)
@@ -9974,46 +11362,54 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
         if (g.SettingsHandlers[handler_n].ReadInitFn)
             g.SettingsHandlers[handler_n].ReadInitFn(&g, &g.SettingsHandlers[handler_n]);
 
-    void* entry_data = NULL;
-    ImGuiSettingsHandler* entry_handler = NULL;
-
-    char* line_end = NULL;
-    for (char* line = buf; line < buf_end; line = line_end + 1)
+    if (is_binary)
     {
-        // Skip new lines markers, then find end of the line
-        while (*line == '\n' || *line == '\r')
-            line++;
-        line_end = line;
-        while (line_end < buf_end && *line_end != '\n' && *line_end != '\r')
-            line_end++;
-        line_end[0] = 0;
-        if (line[0] == ';')
-            continue;
-        if (line[0] == '[' && line_end > line && line_end[-1] == ']')
+        LoadSettingsFromMemoryBinary(ini_data, ini_size);
+    }
+    else
+    {
+        void* entry_data = NULL;
+        ImGuiSettingsHandler* entry_handler = NULL;
+
+        char* line_end = NULL;
+        for (char* line = buf; line < buf_end; line = line_end + 1)
         {
-            // Parse "[Type][Name]". Note that 'Name' can itself contains [] characters, which is acceptable with the current format and parsing code.
-            line_end[-1] = 0;
-            const char* name_end = line_end - 1;
-            const char* type_start = line + 1;
-            char* type_end = (char*)(void*)ImStrchrRange(type_start, name_end, ']');
-            const char* name_start = type_end ? ImStrchrRange(type_end + 1, name_end, '[') : NULL;
-            if (!type_end || !name_start)
+            // Skip new lines markers, then find end of the line
+            while (*line == '\n' || *line == '\r')
+                line++;
+            line_end = line;
+            while (line_end < buf_end && *line_end != '\n' && *line_end != '\r')
+                line_end++;
+            line_end[0] = 0;
+            if (line[0] == ';')
                 continue;
-            *type_end = 0; // Overwrite first ']'
-            name_start++;  // Skip second '['
-            entry_handler = FindSettingsHandler(type_start);
-            entry_data = entry_handler ? entry_handler->ReadOpenFn(&g, entry_handler, name_start) : NULL;
-        }
-        else if (entry_handler != NULL && entry_data != NULL)
-        {
-            // Let type handler parse the line
-            entry_handler->ReadLineFn(&g, entry_handler, entry_data, line);
+            if (line[0] == '[' && line_end > line && line_end[-1] == ']')
+            {
+                // Parse "[Type][Name]". Note that 'Name' can itself contains [] characters, which is acceptable with the current format and parsing code.
+                line_end[-1] = 0;
+                const char* name_end = line_end - 1;
+                const char* type_start = line + 1;
+                char* type_end = (char*)(void*)ImStrchrRange(type_start, name_end, ']');
+                const char* name_start = type_end ? ImStrchrRange(type_end + 1, name_end, '[') : NULL;
+                if (!type_end || !name_start)
+                    continue;
+                *type_end = 0; // Overwrite first ']'
+                name_start++;  // Skip second '['
+                entry_handler = FindSettingsHandler(type_start);
+                entry_data = entry_handler ? entry_handler->ReadOpenFn(&g, entry_handler, name_start) : NULL;
+            }
+            else if (entry_handler != NULL && entry_data != NULL)
+            {
+                // Let type handler parse the line
+                entry_handler->ReadLineFn(&g, entry_handler, entry_data, line);
+            }
         }
     }
     g.SettingsLoaded = true;
 
     // [DEBUG] Restore untouched copy so it can be browsed in Metrics (not strictly necessary)
-    memcpy(buf, ini_data, ini_size);
+    if (!is_binary)
+        memcpy(buf, ini_data, ini_size);
 
     // Call post-read handlers
     for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
@@ -10030,7 +11426,7 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 
     size_t ini_data_size = 0;
     const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
-    ImFileHandle f = ImFileOpen(ini_filename, "wt");
+    ImFileHandle f = ImFileOpen(ini_filename, g.IO.IniSavingBinary ? "wb" : "wt");
     if (!f)
         return;
     ImFileWrite(ini_data, sizeof(char), ini_data_size, f);
@@ -10038,16 +11434,38 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 }
 
 // Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
+// With io.IniSavingBinary, handlers providing WriteAllBinaryFn write binary entries directly, the text output of others gets converted.
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
     ImGuiContext& g = *GImGui;
     g.SettingsDirtyTimer = 0.0f;
     g.SettingsIniData.Buf.resize(0);
     g.SettingsIniData.Buf.push_back(0);
+    if (g.IO.IniSavingBinary)
+    {
+        g.SettingsIniData.append(SETTINGS_BINARY_MAGIC, SETTINGS_BINARY_MAGIC + sizeof(SETTINGS_BINARY_MAGIC));
+        char version[4];
+        SettingsBinaryWriteU32(version, SETTINGS_BINARY_VERSION);
+        g.SettingsIniData.append(version, version + 4);
+    }
+    ImGuiTextBuffer text_buf;
     for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
     {
         ImGuiSettingsHandler* handler = &g.SettingsHandlers[handler_n];
-        handler->WriteAllFn(&g, handler, &g.SettingsIniData);
+        if (!g.IO.IniSavingBinary)
+        {
+            handler->WriteAllFn(&g, handler, &g.SettingsIniData);
+        }
+        else if (handler->WriteAllBinaryFn)
+        {
+            handler->WriteAllBinaryFn(&g, handler, &g.SettingsIniData);
+        }
+        else
+        {
+            text_buf.clear();
+            handler->WriteAllFn(&g, handler, &text_buf);
+            SettingsBinaryAppendTextEntries(&g.SettingsIniData, text_buf.begin(), text_buf.end());
+        }
     }
     if (out_size)
         *out_size = (size_t)g.SettingsIniData.size();
@@ -10060,6 +11478,7 @@ static void WindowSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandl
     for (int i = 0; i != g.Windows.Size; i++)
         g.Windows[i]->SettingsOffset = -1;
     g.SettingsWindows.clear();
+    g.SettingsWindowsMap.Clear();
 }
 
 static void* WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
@@ -10095,10 +11514,10 @@ static void WindowSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandl
         }
 }
 
-static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+// Gather data from windows that were active during this session
+// (if a window wasn't opened in this session we preserve its settings)
+static void WindowSettingsHandler_GatherAll(ImGuiContext* ctx)
 {
-    // Gather data from windows that were active during this session
-    // (if a window wasn't opened in this session we preserve its settings)
     ImGuiContext& g = *ctx;
     for (int i = 0; i != g.Windows.Size; i++)
     {
@@ -10117,6 +11536,12 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
         settings->Size = ImVec2ih((short)window->SizeFull.x, (short)window->SizeFull.y);
         settings->Collapsed = window->Collapsed;
     }
+}
+
+static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_GatherAll(ctx);
 
     // Write to text buffer
     buf->reserve(buf->size() + g.SettingsWindows.size() * 6); // ballpark reserve
@@ -10131,6 +11556,40 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
     }
 }
 
+// Binary payload: Pos.x, Pos.y, Size.x, Size.y, Collapsed (as 5 x little-endian ImS16)
+static void WindowSettingsHandler_ReadBinary(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const void* data, size_t data_size)
+{
+    ImGuiWindowSettings* settings = (ImGuiWindowSettings*)entry;
+    const unsigned char* bytes = (const unsigned char*)data;
+    ImS16 v[5];
+    if (data_size < sizeof(v))
+        return;
+    for (int n = 0; n < 5; n++)
+        v[n] = (ImS16)(bytes[n * 2] | (bytes[n * 2 + 1] << 8));
+    settings->Pos = ImVec2ih(v[0], v[1]);
+    settings->Size = ImVec2ih(v[2], v[3]);
+    settings->Collapsed = (v[4] != 0);
+}
+
+static void WindowSettingsHandler_WriteAllBinary(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_GatherAll(ctx);
+
+    buf->reserve(buf->size() + g.SettingsWindows.size() + g.SettingsWindows.size() / 2); // ballpark reserve
+    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+    {
+        const ImS16 v[5] = { settings->Pos.x, settings->Pos.y, settings->Size.x, settings->Size.y, (ImS16)(settings->Collapsed ? 1 : 0) };
+        unsigned char bytes[10];
+        for (int n = 0; n < 5; n++)
+        {
+            bytes[n * 2] = (unsigned char)((ImU16)v[n] & 0xFF);
+            bytes[n * 2 + 1] = (unsigned char)((ImU16)v[n] >> 8);
+        }
+        ImGui::SettingsBinaryAppendEntry(buf, handler, settings->GetName(), bytes, sizeof(bytes));
+    }
+}
+
 
 //-----------------------------------------------------------------------------
 // [SECTION] VIEWPORTS, PLATFORM WINDOWS
@@ -10356,6 +11815,48 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     ImGui::Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
     ImGui::Text("%d active windows (%d visible)", io.MetricsActiveWindows, io.MetricsRenderWindows);
     ImGui::Text("%d active allocations", io.MetricsActiveAllocations);
+    ImGui::Text("%d allocations last frame (%d bytes), frame arena: %d bytes used, %d KB reserved", io.MetricsFrameAllocations, io.MetricsFrameAllocatedBytes, io.MetricsFrameArenaBytes, (int)(g.FrameArena.GetReservedBytes() / 1024));
+    ImGui::Text("Windows buffers: %d KB (all contexts: %d KB), reclaimed %d bytes last frame, %d KB total", io.MetricsWindowsMemoryBytes / 1024, (int)(GImGcTransientBytes / 1024), io.MetricsWindowsMemoryReclaimed, (int)(g.GcReclaimedBytesTotal / 1024));
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+    if (ImGui::TreeNode("Memory", "Memory tracking (%d tags)", ImGuiMemTag_COUNT))
+    {
+        bool copy_csv = ImGui::SmallButton("Copy as CSV");
+        ImGui::SameLine();
+        bool copy_json = ImGui::SmallButton("Copy as JSON");
+        if (copy_csv || copy_json)
+        {
+            ImGuiTextBuffer buf;
+            ImGui::MemExportStats(&buf, copy_json);
+            ImGui::SetClipboardText(buf.c_str());
+        }
+        ImGui::Columns(6, "##memtags", true);
+        ImGui::Text("Tag"); ImGui::NextColumn();
+        ImGui::Text("Live"); ImGui::NextColumn();
+        ImGui::Text("Peak"); ImGui::NextColumn();
+        ImGui::Text("Allocs"); ImGui::NextColumn();
+        ImGui::Text("Allocs/frame"); ImGui::NextColumn();
+        ImGui::Text("Budget"); ImGui::NextColumn();
+        ImGui::Separator();
+        for (int tag = 0; tag < ImGuiMemTag_COUNT; tag++)
+        {
+            const ImGuiMemTagStats* stats = ImGui::MemGetTagStats(tag);
+            ImGui::Text("%s", GImMemTagNames[tag]); ImGui::NextColumn();
+            ImGui::Text("%.1f KB", stats->LiveBytes / 1024.0f); ImGui::NextColumn();
+            ImGui::Text("%.1f KB", stats->PeakBytes / 1024.0f); ImGui::NextColumn();
+            ImGui::Text("%d", stats->LiveAllocs); ImGui::NextColumn();
+            ImGui::Text("%d", stats->AllocsLastFrame); ImGui::NextColumn();
+            if (stats->BudgetBytes == 0)
+                ImGui::TextDisabled("-");
+            else if (stats->BudgetExceeded)
+                ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "%.1f KB (exceeded)", stats->BudgetBytes / 1024.0f);
+            else
+                ImGui::Text("%.1f KB", stats->BudgetBytes / 1024.0f);
+            ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+        ImGui::TreePop();
+    }
+#endif
     ImGui::Separator();
 
     // Helper functions to display common structures:
@@ -10549,6 +12050,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 
             ImGuiWindowFlags flags = window->Flags;
             NodeDrawList(window, window->DrawList, "DrawList");
+            ImGui::BulletText("IDHashCache: %d entries, %d bytes", window->IDHashCache.Entries.Size, (int)window->IDHashCache.GetMemorySize());
             ImGui::BulletText("Pos: (%.1f,%.1f), Size: (%.1f,%.1f), ContentSize (%.1f,%.1f)", window->Pos.x, window->Pos.y, window->Size.x, window->Size.y, window->ContentSize.x, window->ContentSize.y);
             ImGui::BulletText("Flags: 0x%08X (%s%s%s%s%s%s%s%s%s..)", flags,
                 (flags & ImGuiWindowFlags_ChildWindow)  ? "Child " : "",      (flags & ImGuiWindowFlags_Tooltip)     ? "Tooltip "   : "",  (flags & ImGuiWindowFlags_Popup) ? "Popup " : "",
@@ -10618,7 +12120,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 
         static void NodeStorage(ImGuiStorage* storage, const char* label)
         {
-            if (!ImGui::TreeNode(label, "%s: %d entries, %d bytes", label, storage->Data.Size, storage->Data.size_in_bytes()))
+            if (!ImGui::TreeNode(label, "%s: %d entries, %d bytes", label, storage->Data.Size, storage->Data.size_in_bytes() + storage->Slots.size_in_bytes()))
                 return;
             for (int n = 0; n < storage->Data.Size; n++)
             {
@@ -10753,7 +12255,10 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 
         if (ImGui::TreeNode("SettingsIniData", "Settings unpacked data (.ini): %d bytes", g.SettingsIniData.size()))
         {
-            ImGui::InputTextMultiline("##Ini", (char*)(void*)g.SettingsIniData.c_str(), g.SettingsIniData.Buf.Size, ImVec2(-FLT_MIN, 0.0f), ImGuiInputTextFlags_ReadOnly);
+            if (IsSettingsDataBinary(g.SettingsIniData.c_str(), (size_t)g.SettingsIniData.size()))
+                ImGui::TextDisabled("(binary data, see io.IniSavingBinary)");
+            else
+                ImGui::InputTextMultiline("##Ini", (char*)(void*)g.SettingsIniData.c_str(), g.SettingsIniData.Buf.Size, ImVec2(-FLT_MIN, 0.0f), ImGuiInputTextFlags_ReadOnly);
             ImGui::TreePop();
         }
         ImGui::TreePop();
@@ -29,7 +29,7 @@ Index of this file:
 // ImGuiIO
 // Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
 // Obsolete functions
-// Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
+// Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiPlotSeries, ImGuiPlotEnvelope, ImColor)
 // Draw List API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
 // Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 
@@ -120,21 +120,31 @@ struct ImDrawListSplitter;          // Helper to split a draw list into differen
 struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
+struct ImFontAtlasTexPage;          // Additional texture page of a multi-page ImFontAtlas (see ImFontAtlas::TexMaxHeight)
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
 struct ImGuiContext;                // Dear ImGui context (opaque structure, unless including imgui_internal.h)
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
+struct ImGuiLabelHash;              // Label with its hash computed at compile-time, see IM_LABEL()
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Heights of the items of a list with variable item heights, for ImGuiListClipper
+struct ImGuiMemTagStats;            // Per-tag allocation statistics, when IMGUI_ENABLE_MEMORY_TRACKING is defined (see MemGetTagStats())
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame, used by IMGUI_ONCE_UPON_A_FRAME macro
 struct ImGuiPayload;                // User data payload for drag and drop operations
+struct ImGuiPlotAsyncEnvelope;      // Helper to build plot envelopes on worker threads while PlotLines()/PlotHistogram() draw the last completed one
+struct ImGuiPlotEnvelope;           // Helper holding the min/max of the values of each pixel column of a plot
+struct ImGuiPlotSeries;             // Helper to store a large/live series of values with a min/max pyramid, for PlotLines()/PlotHistogram()
+struct ImGuiSelectionRanges;        // Set of selected items stored as sorted ranges of indices, for BeginMultiSelect()
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
+struct ImGuiTreeView;               // Helper to display large trees with ImGuiListClipper: flattened list of the visible nodes, see BeginTreeView()
+struct ImGuiTreeViewRow;            // A visible node of an ImGuiTreeView
 
 // Enums/Flags (declared as int for compatibility with old C++, to allow using as flags and to not pollute the top of this file)
 // - Tip: Use your programming IDE navigation facilities on the names in the _central column_ below to find the actual flags/enum lists!
@@ -145,10 +155,12 @@ typedef int ImGuiCond;              // -> enum ImGuiCond_            // Enum: A
 typedef int ImGuiDataType;          // -> enum ImGuiDataType_        // Enum: A primary data type
 typedef int ImGuiDir;               // -> enum ImGuiDir_             // Enum: A cardinal direction
 typedef int ImGuiKey;               // -> enum ImGuiKey_             // Enum: A key identifier (ImGui-side enum)
+typedef int ImGuiMemTag;            // -> enum ImGuiMemTag_          // Enum: An allocation category for memory tracking
 typedef int ImGuiNavInput;          // -> enum ImGuiNavInput_        // Enum: An input identifier for navigation
 typedef int ImGuiMouseButton;       // -> enum ImGuiMouseButton_     // Enum: A mouse button identifier (0=left, 1=right, 2=middle)
 typedef int ImGuiMouseCursor;       // -> enum ImGuiMouseCursor_     // Enum: A mouse cursor identifier
 typedef int ImGuiStyleVar;          // -> enum ImGuiStyleVar_        // Enum: A variable identifier for styling
+typedef int ImDrawCmdFlags;         // -> enum ImDrawCmdFlags_       // Flags: for ImDrawCmd (how the renderer should sample its texture)
 typedef int ImDrawCornerFlags;      // -> enum ImDrawCornerFlags_    // Flags: for ImDrawList::AddRect(), AddRectFilled() etc.
 typedef int ImDrawListFlags;        // -> enum ImDrawListFlags_      // Flags: for ImDrawList
 typedef int ImFontAtlasFlags;       // -> enum ImFontAtlasFlags_     // Flags: for ImFontAtlas build
@@ -162,6 +174,7 @@ typedef int ImGuiFocusedFlags;      // -> enum ImGuiFocusedFlags_    // Flags: f
 typedef int ImGuiHoveredFlags;      // -> enum ImGuiHoveredFlags_    // Flags: for IsItemHovered(), IsWindowHovered() etc.
 typedef int ImGuiInputTextFlags;    // -> enum ImGuiInputTextFlags_  // Flags: for InputText(), InputTextMultiline()
 typedef int ImGuiKeyModFlags;       // -> enum ImGuiKeyModFlags_     // Flags: for io.KeyMods (Ctrl/Shift/Alt/Super)
+typedef int ImGuiMultiSelectFlags;  // -> enum ImGuiMultiSelectFlags_ // Flags: for BeginMultiSelect()
 typedef int ImGuiPopupFlags;        // -> enum ImGuiPopupFlags_      // Flags: for OpenPopup*(), BeginPopupContext*(), IsPopupOpen()
 typedef int ImGuiSelectableFlags;   // -> enum ImGuiSelectableFlags_ // Flags: for Selectable()
 typedef int ImGuiSliderFlags;       // -> enum ImGuiSliderFlags_     // Flags: for DragFloat(), DragInt(), SliderFloat(), SliderInt() etc.
@@ -418,6 +431,8 @@ namespace ImGui
     IMGUI_API ImGuiID       GetID(const char* str_id);                                      // calculate unique ID (hash of whole ID stack + given parameter). e.g. if you want to query into ImGuiStorage yourself
     IMGUI_API ImGuiID       GetID(const char* str_id_begin, const char* str_id_end);
     IMGUI_API ImGuiID       GetID(const void* ptr_id);
+    IMGUI_API void          PushID(const ImGuiLabelHash& str_id);                           // push string into the ID stack, using the hash computed by IM_LABEL("str_id") at compile-time.
+    IMGUI_API ImGuiID       GetID(const ImGuiLabelHash& str_id);
 
     // Widgets: Text
     IMGUI_API void          TextUnformatted(const char* text, const char* text_end = NULL); // raw text without formatting. Roughly equivalent to Text("%s", text) but: A) doesn't require null terminated string if 'text_end' is specified, B) it's faster, no memory copy is done, no buffer size limits, recommended for long chunks of text.
@@ -439,11 +454,14 @@ namespace ImGui
     // - You may also use one of the many IsItemXXX functions (e.g. IsItemActive, IsItemHovered, etc.) to query widget state.
     IMGUI_API bool          Button(const char* label, const ImVec2& size = ImVec2(0, 0));   // button
     IMGUI_API bool          SmallButton(const char* label);                                 // button with FramePadding=(0,0) to easily embed within text
+    IMGUI_API bool          Button(const ImGuiLabelHash& label, const ImVec2& size = ImVec2(0, 0)); // Button(IM_LABEL("label")): same as Button("label") without hashing the label at runtime
+    IMGUI_API bool          SmallButton(const ImGuiLabelHash& label);
     IMGUI_API bool          InvisibleButton(const char* str_id, const ImVec2& size, ImGuiButtonFlags flags = 0); // flexible button behavior without the visuals, frequently useful to build custom behaviors using the public api (along with IsItemActive, IsItemHovered, etc.)
     IMGUI_API bool          ArrowButton(const char* str_id, ImGuiDir dir);                  // square button with an arrow shape
     IMGUI_API void          Image(ImTextureID user_texture_id, const ImVec2& size, const ImVec2& uv0 = ImVec2(0, 0), const ImVec2& uv1 = ImVec2(1,1), const ImVec4& tint_col = ImVec4(1,1,1,1), const ImVec4& border_col = ImVec4(0,0,0,0));
     IMGUI_API bool          ImageButton(ImTextureID user_texture_id, const ImVec2& size, const ImVec2& uv0 = ImVec2(0, 0),  const ImVec2& uv1 = ImVec2(1,1), int frame_padding = -1, const ImVec4& bg_col = ImVec4(0,0,0,0), const ImVec4& tint_col = ImVec4(1,1,1,1));    // <0 frame_padding uses default frame padding settings. 0 for no padding
     IMGUI_API bool          Checkbox(const char* label, bool* v);
+    IMGUI_API bool          Checkbox(const ImGuiLabelHash& label, bool* v);
     IMGUI_API bool          CheckboxFlags(const char* label, unsigned int* flags, unsigned int flags_value);
     IMGUI_API bool          RadioButton(const char* label, bool active);                    // use with e.g. if (RadioButton("one", my_value==1)) { my_value = 1; }
     IMGUI_API bool          RadioButton(const char* label, int* v, int v_button);           // shortcut to handle the above pattern when value is an integer
@@ -453,6 +471,7 @@ namespace ImGui
     // Widgets: Combo Box
     // - The BeginCombo()/EndCombo() api allows you to manage your contents and selection state however you want it, by creating e.g. Selectable() items.
     // - The old Combo() api are helpers over BeginCombo()/EndCombo() which are kept available for convenience purpose.
+    // - Combo() and ListBox() only submit the visible items, so they can hold very large lists. Typing while they are focused moves keyboard focus to the next item starting with the typed text.
     IMGUI_API bool          BeginCombo(const char* label, const char* preview_value, ImGuiComboFlags flags = 0);
     IMGUI_API void          EndCombo(); // only call EndCombo() if BeginCombo() returns true!
     IMGUI_API bool          Combo(const char* label, int* current_item, const char* const items[], int items_count, int popup_max_height_in_items = -1);
@@ -535,6 +554,7 @@ namespace ImGui
     // Widgets: Trees
     // - TreeNode functions return true when the node is open, in which case you need to also call TreePop() when you are finished displaying the tree node contents.
     IMGUI_API bool          TreeNode(const char* label);
+    IMGUI_API bool          TreeNode(const ImGuiLabelHash& label);
     IMGUI_API bool          TreeNode(const char* str_id, const char* fmt, ...) IM_FMTARGS(2);   // helper variation to easily decorelate the id from the displayed string. Read the FAQ about why and how to use ID. to align arbitrary text at the same level as a TreeNode() you can use Bullet().
     IMGUI_API bool          TreeNode(const void* ptr_id, const char* fmt, ...) IM_FMTARGS(2);   // "
     IMGUI_API bool          TreeNodeV(const char* str_id, const char* fmt, va_list args) IM_FMTLIST(2);
@@ -551,6 +571,9 @@ namespace ImGui
     IMGUI_API bool          CollapsingHeader(const char* label, ImGuiTreeNodeFlags flags = 0);  // if returning 'true' the header is open. doesn't indent nor push on ID stack. user doesn't have to call TreePop().
     IMGUI_API bool          CollapsingHeader(const char* label, bool* p_open, ImGuiTreeNodeFlags flags = 0); // when 'p_open' isn't NULL, display an additional small close button on upper right of the header
     IMGUI_API void          SetNextItemOpen(bool is_open, ImGuiCond cond = 0);                  // set next TreeNode/CollapsingHeader open state.
+    IMGUI_API void          BeginTreeView(ImGuiTreeView* view);                                 // large trees: push an ID scope for the nodes and update view->Rows, the list of visible nodes to clip with ImGuiListClipper. See ImGuiTreeView.
+    IMGUI_API bool          TreeViewNode(ImGuiTreeView* view, int row_idx, const char* label, ImGuiTreeNodeFlags flags = 0); // display the node of view->Rows[row_idx], indented by its depth. return true when open. doesn't push on ID stack, user doesn't have to call TreePop().
+    IMGUI_API void          EndTreeView();
 
     // Widgets: Selectables
     // - A selectable highlights when hovered, and can display another color when selected.
@@ -558,6 +581,16 @@ namespace ImGui
     IMGUI_API bool          Selectable(const char* label, bool selected = false, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0)); // "bool selected" carry the selection state (read-only). Selectable() is clicked is returns true so you can modify your selection state. size.x==0.0: use remaining width, size.x>0.0: specify width. size.y==0.0: use label height, size.y>0.0: specify height
     IMGUI_API bool          Selectable(const char* label, bool* p_selected, ImGuiSelectableFlags flags = 0, const ImVec2& size = ImVec2(0, 0));      // "bool* p_selected" point to the selection state (read-write), as a convenient helper.
 
+    // Widgets: Multi-selection
+    // - Between BeginMultiSelect() and EndMultiSelect(), Selectable() and TreeNode() items preceded by SetNextItemSelectionIndex() read their
+    //   selected state from 'selection' (their 'selected' parameter/flag is ignored) and update it: click, CTRL+click (toggle), SHIFT+click (range),
+    //   keyboard navigation (with SHIFT: range, with CTRL: move without selecting), CTRL+A (select all), dragging from empty space (box-select).
+    // - The cost doesn't depend on the number of items or selected items, so this works with ImGuiListClipper. Indices should follow the display order.
+    // - Box-selection assumes items are laid out vertically (one item per line) and can be used with clipped lists.
+    IMGUI_API void          BeginMultiSelect(ImGuiSelectionRanges* selection, int items_count, ImGuiMultiSelectFlags flags = 0);
+    IMGUI_API void          EndMultiSelect();
+    IMGUI_API void          SetNextItemSelectionIndex(int item_idx);                           // set index of the next Selectable()/TreeNode() in the selection
+
     // Widgets: List Boxes
     // - FIXME: To be consistent with all the newer API, ListBoxHeader/ListBoxFooter should in reality be called BeginListBox/EndListBox. Will rename them.
     IMGUI_API bool          ListBox(const char* label, int* current_item, const char* const items[], int items_count, int height_in_items = -1);
@@ -571,6 +604,10 @@ namespace ImGui
     IMGUI_API void          PlotLines(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
     IMGUI_API void          PlotHistogram(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          PlotLines(const char* label, const ImGuiPlotSeries* series, int display_start = 0, int display_count = -1, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));     // display_count = -1: up to the last value. Cost is O(graph width * log(values count)).
+    IMGUI_API void          PlotHistogram(const char* label, const ImGuiPlotSeries* series, int display_start = 0, int display_count = -1, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0)); // "
+    IMGUI_API void          PlotLines(const char* label, ImGuiPlotAsyncEnvelope* envelope, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));       // Draw the last completed envelope, see ImGuiPlotAsyncEnvelope.
+    IMGUI_API void          PlotHistogram(const char* label, ImGuiPlotAsyncEnvelope* envelope, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));   // "
 
     // Widgets: Value() Helpers.
     // - Those are merely shortcut to calling Text() with a format string. Output single value in "name: value" format (tip: freely declare more in your code to handle your types. you can add functions to the ImGui namespace)
@@ -770,6 +807,8 @@ namespace ImGui
     // Settings/.Ini Utilities
     // - The disk functions are automatically called if io.IniFilename != NULL (default is "imgui.ini").
     // - Set io.IniFilename to NULL to load/save manually. Read io.WantSaveIniSettings description about handling .ini saving manually.
+    // - When io.IniSavingBinary is set, data is saved in a compact binary format (which may contain zeroes: use the returned size). Always pass the size when loading it back.
+    //   Binary data is read in place without being copied, so you may e.g. pass a memory-mapped file to LoadIniSettingsFromMemory().
     IMGUI_API void          LoadIniSettingsFromDisk(const char* ini_filename);                  // call after CreateContext() and before the first call to NewFrame(). NewFrame() automatically calls LoadIniSettingsFromDisk(io.IniFilename).
     IMGUI_API void          LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size=0); // call after CreateContext() and before the first call to NewFrame() to provide .ini data from your own data source.
     IMGUI_API void          SaveIniSettingsToDisk(const char* ini_filename);                    // this is automatically called (if io.IniFilename is not empty) a few seconds after any modification that should be reflected in the .ini file (and also by DestroyContext).
@@ -779,11 +818,23 @@ namespace ImGui
     IMGUI_API bool          DebugCheckVersionAndDataLayout(const char* version_str, size_t sz_io, size_t sz_style, size_t sz_vec2, size_t sz_vec4, size_t sz_drawvert, size_t sz_drawidx); // This is called by IMGUI_CHECKVERSION() macro.
 
     // Memory Allocators
-    // - All those functions are not reliant on the current context.
+    // - All those functions are not reliant on the current context (except MemAllocFrame()).
     // - If you reload the contents of imgui.cpp at runtime, you may need to call SetCurrentContext() + SetAllocatorFunctions() again because we use global storage for those.
+    // - MemAllocFrame() returns transient memory carved out of a per-context arena (itself allocated with MemAlloc()). It stays valid until the next NewFrame()
+    //   on the same context, where it is all released at once. Never call MemFree() on it, and use MemAlloc() for anything that needs to outlive the frame.
     IMGUI_API void          SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data), void (*free_func)(void* ptr, void* user_data), void* user_data = NULL);
     IMGUI_API void*         MemAlloc(size_t size);
     IMGUI_API void          MemFree(void* ptr);
+    IMGUI_API void*         MemAllocFrame(size_t size);
+
+    // Memory Tracking
+    // - Only active when IMGUI_ENABLE_MEMORY_TRACKING is defined in imconfig.h, otherwise those are no-op and MemGetTagStats() returns NULL.
+    // - Every MemAlloc() is accounted to the current tag (ImGuiMemTag_Misc unless set). Statistics are global, shared by all contexts.
+    // - Exceeding a budget (0 = no budget) sets ImGuiMemTagStats::BudgetExceeded and outputs a message with IMGUI_DEBUG_LOG().
+    IMGUI_API ImGuiMemTag   MemSetTag(ImGuiMemTag tag);                                         // set tag for following MemAlloc() calls, return previous tag.
+    IMGUI_API const ImGuiMemTagStats* MemGetTagStats(ImGuiMemTag tag);
+    IMGUI_API void          MemSetTagBudget(ImGuiMemTag tag, size_t budget_bytes);
+    IMGUI_API void          MemExportStats(ImGuiTextBuffer* out_buf, bool json = false);        // append statistics for all tags as CSV (default) or JSON.
 
 } // namespace ImGui
 
@@ -856,9 +907,11 @@ enum ImGuiInputTextFlags_
     ImGuiInputTextFlags_CharsScientific     = 1 << 17,  // Allow 0123456789.+-*/eE (Scientific notation input)
     ImGuiInputTextFlags_CallbackResize      = 1 << 18,  // Callback on buffer capacity changes request (beyond 'buf_size' parameter value), allowing the string to grow. Notify when the string wants to be resized (for string types which hold a cache of their Size). You will be provided a new BufSize in the callback and NEED to honor it. (see misc/cpp/imgui_stdlib.h for an example of using this)
     ImGuiInputTextFlags_CallbackEdit        = 1 << 19,  // Callback on any edit (note that InputText() already returns true on edit, the callback is useful mainly to manipulate the underlying buffer while focus is active)
+    ImGuiInputTextFlags_RetainLineIndex     = 1 << 20,  // InputTextMultiline(): keep a line index of the buffer between frames so that large buffers are measured and rendered in O(visible lines) while inactive. Your code may only append to the buffer (appended text is detected), submit one frame without the flag after any other modification.
+    ImGuiInputTextFlags_IncrementalCopyBack = 1 << 21,  // While active, only copy the text modified since the last frame back to your buffer, instead of comparing and copying the whole text. Your buffer must keep the text written by the widget between frames. Ignored with ImGuiInputTextFlags_CallbackResize.
     // [Internal]
-    ImGuiInputTextFlags_Multiline           = 1 << 20,  // For internal use by InputTextMultiline()
-    ImGuiInputTextFlags_NoMarkEdited        = 1 << 21   // For internal use by functions using InputText() before reformatting data
+    ImGuiInputTextFlags_Multiline           = 1 << 26,  // For internal use by InputTextMultiline()
+    ImGuiInputTextFlags_NoMarkEdited        = 1 << 27   // For internal use by functions using InputText() before reformatting data
 };
 
 // Flags for ImGui::TreeNodeEx(), ImGui::CollapsingHeader*()
@@ -917,6 +970,15 @@ enum ImGuiSelectableFlags_
     ImGuiSelectableFlags_AllowItemOverlap   = 1 << 4    // (WIP) Hit testing to allow subsequent widgets to overlap this one
 };
 
+// Flags for ImGui::BeginMultiSelect()
+enum ImGuiMultiSelectFlags_
+{
+    ImGuiMultiSelectFlags_None                  = 0,
+    ImGuiMultiSelectFlags_NoSelectAll           = 1 << 0,   // Disable CTRL+A shortcut selecting all items
+    ImGuiMultiSelectFlags_NoBoxSelect           = 1 << 1,   // Disable selecting items by dragging a rectangle from empty space
+    ImGuiMultiSelectFlags_NoClearOnClickVoid    = 1 << 2    // Don't clear the selection when clicking empty space
+};
+
 // Flags for ImGui::BeginCombo()
 enum ImGuiComboFlags_
 {
@@ -1358,6 +1420,22 @@ enum ImGuiCond_
     ImGuiCond_Appearing     = 1 << 3    // Set the variable if the object/window is appearing after being hidden/inactive (or the first time)
 };
 
+// Allocation categories for MemSetTag() / MemGetTagStats(), when IMGUI_ENABLE_MEMORY_TRACKING is defined
+enum ImGuiMemTag_
+{
+    ImGuiMemTag_Misc,               // Anything not tagged below
+    ImGuiMemTag_Context,            // ImGuiContext, ImGuiWindow and their buffers
+    ImGuiMemTag_DrawList,           // ImDrawList buffers (commands, vertices, indices, paths, channels) and ImDrawData
+    ImGuiMemTag_Storage,            // ImGuiStorage pairs and hash tables
+    ImGuiMemTag_TextBuffer,         // ImGuiTextBuffer (logging, .ini output, etc.)
+    ImGuiMemTag_FontAtlas,          // ImFontAtlas, ImFont, glyphs and texture data
+    ImGuiMemTag_Pool,               // ImPool (tab bars, etc.)
+    ImGuiMemTag_Settings,           // Window/table settings (ImChunkStream)
+    ImGuiMemTag_InputText,          // InputText() state and buffers
+    ImGuiMemTag_FrameArena,         // Blocks backing MemAllocFrame()
+    ImGuiMemTag_COUNT
+};
+
 //-----------------------------------------------------------------------------
 // Helpers: Memory allocations macros
 // IM_MALLOC(), IM_FREE(), IM_NEW(), IM_PLACEMENT_NEW(), IM_DELETE()
@@ -1515,6 +1593,7 @@ struct ImGuiIO
     float       DeltaTime;                      // = 1.0f/60.0f     // Time elapsed since last frame, in seconds.
     float       IniSavingRate;                  // = 5.0f           // Minimum time between saving positions/sizes to .ini file, in seconds.
     const char* IniFilename;                    // = "imgui.ini"    // Path to .ini file. Set NULL to disable automatic .ini loading/saving, if e.g. you want to manually load/save from memory.
+    bool        IniSavingBinary;                // = false          // Save settings in a compact binary format instead of .ini text. Faster to save and load with many windows. Loading accepts both formats.
     const char* LogFilename;                    // = "imgui_log.txt"// Path to .log file (default parameter to ImGui::LogToFile when no file is specified).
     float       MouseDoubleClickTime;           // = 0.30f          // Time for a double-click, in seconds.
     float       MouseDoubleClickMaxDist;        // = 6.0f           // Distance threshold to stay in to validate a double-click, in pixels.
@@ -1537,6 +1616,8 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // [BETA] Set to true to only allow moving windows when clicked+dragged from the title bar. Windows without a title bar are not affected.
     float       ConfigWindowsMemoryCompactTimer;// = 60.0f          // [BETA] Compact window memory usage when unused. Set to -1.0f to disable.
+    float       ConfigWindowsMemoryShrinkTimer; // = 5.0f           // [BETA] Shrink draw buffers of active windows back towards their average usage (over this duration) after a spike. Set to -1.0f to disable.
+    int         ConfigWindowsMemoryBudget;      // = 0              // [BETA] Budget in bytes for window draw buffers, summed over all contexts. When exceeded, buffers of the least recently used windows are compacted early. 0 = no budget.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -1610,6 +1691,11 @@ struct ImGuiIO
     int         MetricsRenderWindows;           // Number of visible windows
     int         MetricsActiveWindows;           // Number of active windows
     int         MetricsActiveAllocations;       // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
+    int         MetricsFrameAllocations;        // Number of MemAlloc() calls during the last frame (from one NewFrame() to the next), based on current context.
+    int         MetricsFrameAllocatedBytes;     // Bytes requested by those MemAlloc() calls.
+    int         MetricsFrameArenaBytes;         // Bytes allocated with MemAllocFrame() during the last frame.
+    int         MetricsWindowsMemoryBytes;      // Bytes held by window draw buffers (vertices, indices, commands) in the current context.
+    int         MetricsWindowsMemoryReclaimed;  // Bytes released by garbage collection of window buffers during the last NewFrame().
     ImVec2      MouseDelta;                     // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
     //------------------------------------------------------------------
@@ -1787,6 +1873,63 @@ struct ImGuiOnceUponAFrame
     operator bool() const { int current_frame = ImGui::GetFrameCount(); if (RefFrame == current_frame) return false; RefFrame = current_frame; return true; }
 };
 
+// Helper: Label with its hash computed at compile-time.
+// Usage: ImGui::Button(IM_LABEL("Delete")); ImGui::PushID(IM_LABEL("Settings###settings"));
+// - Most labels are string literals, yet they are hashed every frame. IM_LABEL() hashes a literal at compile-time, and the ImGuiLabelHash
+//   overloads (PushID(), GetID(), Button(), SmallButton(), Checkbox(), TreeNode()) only need to apply the seed from the ID stack at runtime.
+//   This is a few table lookups for typical labels, instead of finding the "###" marker and hashing the whole string.
+// - The resulting IDs are identical to the ones from the regular functions, including the "##" and "###" behavior:
+//   ImHashStrConst(str, seed) == ImHashStr(str, 0, seed).
+// - This needs C++14 (relaxed constexpr) and the default CRC32 hash or IMGUI_USE_HASH_CRC32C, in which case IMGUI_HAS_CONSTEXPR_HASH is defined.
+//   Otherwise IM_LABEL() only stores the label, and the overloads hash it at runtime, so code using it compiles everywhere.
+struct ImGuiLabelHash
+{
+    const char*     Label;      // Label as passed to IM_LABEL()
+    ImU32           Hash;       // == ImHashStr(Label, 0, 0), when HashLen >= 0
+    int             HashLen;    // Length of the hashed part of Label (starting at the last "###"), or -1 when Hash wasn't computed at compile-time
+
+    ImGuiLabelHash(const char* label, ImU32 hash, int hash_len) { Label = label; Hash = hash; HashLen = hash_len; }
+};
+
+#if !defined(IMGUI_USE_HASH_WYHASH) && (__cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L))
+#define IMGUI_HAS_CONSTEXPR_HASH
+#ifdef IMGUI_USE_HASH_CRC32C
+#define IM_HASH_CRC_POLY            0x82F63B78u     // CRC32C (Castagnoli), reflected
+#else
+#define IM_HASH_CRC_POLY            0xEDB88320u     // CRC32, reflected
+#endif
+constexpr int ImHashStrConstBegin(const char* str) // Offset of the last "###" in 'str', or 0
+{
+    int begin = 0;
+    for (int n = 0; str[n] != 0; n++)
+        if (str[n] == '#' && str[n + 1] == '#' && str[n + 2] == '#')
+            begin = n;
+    return begin;
+}
+constexpr int ImHashStrConstLen(const char* str)
+{
+    int len = 0;
+    for (const char* p = str + ImHashStrConstBegin(str); *p != 0; p++)
+        len++;
+    return len;
+}
+constexpr ImU32 ImHashStrConst(const char* str, ImU32 seed = 0)
+{
+    ImU32 crc = ~seed;
+    for (const char* p = str + ImHashStrConstBegin(str); *p != 0; p++)
+    {
+        crc ^= (unsigned char)*p;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (IM_HASH_CRC_POLY & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+template<ImU32 V> struct ImHashConstValue { static const ImU32 Value = V; };   // Force evaluation at compile-time
+#define IM_LABEL(_LABEL)            ImGuiLabelHash(_LABEL, ImHashConstValue<ImHashStrConst(_LABEL)>::Value, (int)ImHashConstValue<(ImU32)ImHashStrConstLen(_LABEL)>::Value)
+#else
+#define IM_LABEL(_LABEL)            ImGuiLabelHash(_LABEL, 0, -1)
+#endif
+
 // Helper: Parse and apply text filters. In format "aaaaa[,bbbb][,ccccc]"
 struct ImGuiTextFilter
 {
@@ -1834,10 +1977,26 @@ struct ImGuiTextBuffer
     IMGUI_API void      appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
 };
 
+// Helper: Allocation statistics for one ImGuiMemTag, see MemGetTagStats()
+// (only updated when IMGUI_ENABLE_MEMORY_TRACKING is defined in imconfig.h)
+struct ImGuiMemTagStats
+{
+    size_t      LiveBytes;          // Bytes currently allocated
+    size_t      PeakBytes;          // High-water mark of LiveBytes
+    int         LiveAllocs;         // Number of allocations currently alive
+    int         AllocsThisFrame;    // Number of allocations since the last NewFrame()
+    int         AllocsLastFrame;    // Number of allocations during the last full frame
+    size_t      BudgetBytes;        // Warn when LiveBytes goes over this (0 = no budget), see MemSetTagBudget()
+    bool        BudgetExceeded;     // Set when LiveBytes went over BudgetBytes, cleared when setting a new budget
+
+    ImGuiMemTagStats()  { memset(this, 0, sizeof(*this)); }
+};
+
 // Helper: Key->Value storage
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
-// This is optimized for efficient lookup (dichotomy into a contiguous buffer) and rare insertion (typically tied to user interactions aka max once a frame)
+// Pairs are stored contiguously in Data. Past a few pairs, lookups go through an open-addressing hash table (Slots) indexing into Data,
+// so both lookups and insertions are O(1) on average, which matters when e.g. expanding a tree with 100k+ nodes for the first time.
 // You can use it as custom user storage for temporary values. Declare your own storage if, for example:
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
@@ -1853,13 +2012,21 @@ struct ImGuiStorage
         ImGuiStoragePair(ImGuiID _key, float _val_f)    { key = _key; val_f = _val_f; }
         ImGuiStoragePair(ImGuiID _key, void* _val_p)    { key = _key; val_p = _val_p; }
     };
+    struct ImGuiStorageSlot
+    {
+        ImGuiID key;
+        int     index;                  // Index into Data[], -1 if the slot is empty
+    };
 
-    ImVector<ImGuiStoragePair>      Data;
+    ImVector<ImGuiStoragePair>      Data;               // Pairs, in insertion order (or sorted by key after BuildSortByKey())
+    ImVector<ImGuiStorageSlot>      Slots;              // [Internal] Hash table indexing Data[] (power of two size, linear probing). Empty while Data is small.
+    int                             SlotsDataCount;     // [Internal] Value of Data.Size when Slots was last updated. If pairs were pushed into Data directly, Get***() searches linearly until the next Set***()/Get***Ref() call rebuilds Slots.
 
-    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
-    // - Set***() functions find pair, insertion on demand if missing.
-    // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    // - Get***() functions find pair, never add/allocate. A query is O(1) on average.
+    // - Set***() functions find pair, insertion on demand if missing. Insertion appends to Data and is O(1) amortized.
+    // - A typical frame shouldn't need to insert any new pair.
+    ImGuiStorage()      { SlotsDataCount = 0; }
+    void                Clear() { Data.clear(); Slots.clear(); SlotsDataCount = 0; }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -1881,7 +2048,8 @@ struct ImGuiStorage
     // Use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
 
-    // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // For quicker full rebuild of a storage (instead of an incremental one), you may push_back() all your contents into Data and then call this once.
+    // This sorts pairs by key and rebuilds the lookup table in one go. Also call it if you modified keys in Data directly.
     IMGUI_API void      BuildSortByKey();
 };
 
@@ -1902,6 +2070,16 @@ struct ImGuiStorage
 // - Clipper can measure the height of the first element
 // - Clipper calculate the actual range of elements to display based on the current clipping rectangle, position the cursor before the first visible element.
 // - User code submit visible elements.
+// Items of different heights are supported by passing a persistent ImGuiListClipperHeights to Begin() instead of a height:
+//   static ImGuiListClipperHeights heights;   // Keep it alive along with your list
+//   clipper.Begin(1000000, &heights);
+//   (same loop as above)
+// In this mode the clipper finds the first visible element from the stored heights, then lets you process visible elements one by
+// one so it can measure them and update their stored heights. Elements which have never been visible use heights.DefaultHeight
+// (or you may set their height beforehand with heights.SetHeight() if you know it). The cost is proportional to the number of
+// visible elements (times log2 of the number of elements), regardless of the size of the list.
+// Call ForceDisplayRangeByIndices() after Begin() to have some elements submitted even if they are not visible, e.g. an element you
+// want to focus or scroll to (in which case they are returned by a separate step).
 struct ImGuiListClipper
 {
     int     DisplayStart;
@@ -1912,6 +2090,12 @@ struct ImGuiListClipper
     int     StepNo;
     float   ItemsHeight;
     float   StartPosY;
+    ImGuiListClipperHeights* Heights;   // Variable heights mode, see above
+    float   ItemPosY;                   // Variable heights mode: cursor position before the current element, to measure it
+    float   ClipMaxY;                   // Variable heights mode: stop after the element crossing this position
+    int     ExtraItems;                 // Variable heights mode: number of elements to display after the clipping rectangle (for navigation)
+    int     ForceStart, ForceEnd;       // Elements to display even if they are not visible, see ForceDisplayRangeByIndices()
+    int     PendingStart, PendingEnd;   // Elements to display in a later step, when they are not contiguous with the visible ones
 
     IMGUI_API ImGuiListClipper();
     IMGUI_API ~ImGuiListClipper();
@@ -1919,14 +2103,188 @@ struct ImGuiListClipper
     // items_count: Use INT_MAX if you don't know how many items you have (in which case the cursor won't be advanced in the final step)
     // items_height: Use -1.0f to be calculated automatically on first step. Otherwise pass in the distance between your items, typically GetTextLineHeightWithSpacing() or GetFrameHeightWithSpacing().
     IMGUI_API void Begin(int items_count, float items_height = -1.0f);  // Automatically called by constructor if you passed 'items_count' or by Step() in Step 1.
+    IMGUI_API void Begin(int items_count, ImGuiListClipperHeights* heights); // Items of variable heights. 'items_count' can't be INT_MAX in this mode.
     IMGUI_API void End();                                               // Automatically called on the last call of Step() that returns false.
     IMGUI_API bool Step();                                              // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
+    IMGUI_API void ForceDisplayRangeByIndices(int item_min, int item_max); // Call after Begin(): display items [item_min, item_max) even if they are not visible. Calling it again extends the range.
 
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     inline ImGuiListClipper(int items_count, float items_height = -1.0f) { memset(this, 0, sizeof(*this)); ItemsCount = -1; Begin(items_count, items_height); } // [removed in 1.79]
 #endif
 };
 
+// Helper: Heights of the elements of a list, for ImGuiListClipper with elements of variable heights.
+// Heights include the vertical spacing between elements (same as ImGuiListClipper's 'items_height').
+// Offsets are stored in a Fenwick tree (binary indexed tree): changing the height of an element, getting the offset of an
+// element and finding the element at a given offset are all O(log N). Offsets use double precision, so they don't drift.
+struct ImGuiListClipperHeights
+{
+    ImVector<float>     Heights;        // Height of each element
+    ImVector<double>    Tree;           // Fenwick tree over Heights[], Tree[i] is the sum of Heights[i - (i & -i) .. i - 1]
+    float               DefaultHeight;  // Height for new elements. When <= 0.0f, the clipper sets it to GetTextLineHeightWithSpacing().
+
+    ImGuiListClipperHeights()           { DefaultHeight = 0.0f; }
+    void                Clear()         { Heights.clear(); Tree.clear(); }
+    int                 Size() const    { return Heights.Size; }
+    float               GetHeight(int item_idx) const { IM_ASSERT(item_idx >= 0 && item_idx < Heights.Size); return Heights[item_idx]; }
+    double              GetTotalHeight() const { return GetOffset(Heights.Size); }
+    IMGUI_API void      Resize(int items_count);                // Add elements with DefaultHeight or remove elements at the end. O(log N) per added element, O(1) when removing.
+    IMGUI_API void      SetHeight(int item_idx, float height);
+    IMGUI_API double    GetOffset(int item_idx) const;          // Sum of the heights of elements [0, item_idx)
+    IMGUI_API int       FindItemAtOffset(double offset) const;  // Index of the element covering 'offset', clamped to [0, Size()]
+};
+
+// Helper: Set of selected items for BeginMultiSelect(), stored as sorted ranges of item indices.
+// Selecting N contiguous items (e.g. SHIFT+click, CTRL+A over 1M items) stores a single range, testing if an item is selected is a binary
+// search over the ranges, and selecting/deselecting a range costs O(log R + R) where R is the number of ranges, regardless of N.
+// Usage:
+//   static ImGuiSelectionRanges selection;
+//   ImGui::BeginMultiSelect(&selection, items_count);
+//   ImGuiListClipper clipper;
+//   clipper.Begin(items_count);
+//   while (clipper.Step())
+//       for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//       {
+//           ImGui::SetNextItemSelectionIndex(i);
+//           ImGui::Selectable(label[i]);
+//       }
+//   ImGui::EndMultiSelect();
+//   for (int n = 0; n < selection.Bounds.Size; n += 2) { /* items [Bounds[n], Bounds[n + 1]) are selected */ }
+struct ImGuiSelectionRanges
+{
+    ImVector<int>       Bounds;         // Sorted boundaries: items [Bounds[0], Bounds[1]), [Bounds[2], Bounds[3]), ... are selected
+    int                 Anchor;         // Start of SHIFT+click ranges: last item clicked or navigated to without SHIFT, -1 if none
+
+    ImGuiSelectionRanges()              { Anchor = -1; }
+    void                Clear()         { Bounds.resize(0); Anchor = -1; }
+    bool                Empty() const   { return Bounds.Size == 0; }
+    void                SetSelected(int item_idx, bool selected) { SetRange(item_idx, item_idx + 1, selected); }
+    IMGUI_API bool      Contains(int item_idx) const;                           // O(log R)
+    IMGUI_API void      SetRange(int item_begin, int item_end, bool selected);  // Select or deselect items [item_begin, item_end)
+    IMGUI_API int       CalcSelectedCount() const;                              // O(R)
+};
+
+// Helper: Flattened list of the visible nodes of a tree (the nodes whose ancestors are all open), in display order.
+// Submitting a tree with TreeNode()/TreePop() requires walking all the open nodes every frame, and the rows can't be clipped because their
+// positions depend on the open state of the nodes above them. ImGuiTreeView keeps the rows so they can be clipped with ImGuiListClipper:
+// opening or closing a node inserts or removes the rows of its visible descendants, at a cost proportional to their number (plus a memmove
+// of the rows below), so the cost of a frame depends on the number of displayed rows, not on the size of the tree.
+// Open states are stored in the window storage (the same storage as TreeNode()), identified by the node identifiers returned by GetChild().
+// Usage:
+//   static ImGuiTreeView view;
+//   view.GetChildCount = MyGetChildCount;  // int MyGetChildCount(void* user_data, int node)   node == -1: number of root nodes
+//   view.GetChild = MyGetChild;            // int MyGetChild(void* user_data, int node, int child_idx)
+//   view.UserData = &my_scene;
+//   ImGui::BeginTreeView(&view);
+//   ImGuiListClipper clipper;
+//   clipper.Begin(view.Rows.Size);
+//   while (clipper.Step())
+//       for (int row = clipper.DisplayStart; row < clipper.DisplayEnd && row < view.Rows.Size; row++)
+//           ImGui::TreeViewNode(&view, row, my_scene.GetName(view.Rows[row].Node));
+//   ImGui::EndTreeView();
+// Opening or closing a node with TreeViewNode() updates Rows[] immediately, so don't keep pointers to rows across calls.
+// Call Invalidate() when the structure of the tree changed, or after changing open states in the storage: Rows[] is rebuilt on the next
+// BeginTreeView(), at a cost proportional to the number of visible nodes.
+struct ImGuiTreeViewRow
+{
+    int                 Node;           // Node identifier, as returned by GetChild()
+    int                 Depth;          // 0 for root nodes
+    bool                Open;           // Open state when the row was last updated: the rows of the visible descendants follow it
+};
+
+struct ImGuiTreeView
+{
+    int                 (*GetChildCount)(void* user_data, int node);            // Number of children of 'node' (of root nodes when node == -1)
+    int                 (*GetChild)(void* user_data, int node, int child_idx);  // Identifier of a child of 'node' (of a root node when node == -1). Must be unique and stable: used to identify open states.
+    void*               UserData;
+    ImVector<ImGuiTreeViewRow> Rows;    // Visible nodes, in display order
+    bool                Dirty;          // Rebuild Rows[] on the next BeginTreeView()
+
+    ImGuiTreeView()                     { GetChildCount = NULL; GetChild = NULL; UserData = NULL; Dirty = true; }
+    void                Invalidate()    { Dirty = true; }
+    IMGUI_API int       FindRow(int node) const;    // Row of a visible node, -1 if not visible. O(N).
+};
+
+// Helper: Series of values for PlotLines()/PlotHistogram(), for large or live data (e.g. telemetry).
+// Values are stored with a pyramid of min/max over blocks of 16, 32, 64... values. Appending a value updates the pyramid in O(log N),
+// and the min/max of any range of values is found in O(log N), so plotting costs O(graph width * log N) instead of O(N), whichever
+// part of the series is displayed: pass display_start/display_count to PlotLines()/PlotHistogram() to zoom and pan.
+// With 'max_count' > 0, the series is a ring buffer: once full, appending a value overwrites the oldest one.
+// Usage:
+//   static ImGuiPlotSeries series(1000000);
+//   series.PushBack(sample);
+//   ImGui::PlotLines("Signal", &series, first_visible_sample, visible_samples_count);
+struct ImGuiPlotSeries
+{
+    ImVector<float>     Values;         // Storage (as a ring buffer when MaxCount > 0). Use GetValue() to read values in order.
+    int                 MaxCount;       // When > 0, maximum number of values: oldest values are overwritten
+    int                 Head;           // Index in Values[] of the oldest value
+    ImVector<ImVec2>    Levels[28];     // Min (x) and max (y) of blocks of Values[]: Levels[k][n] covers Values[n << (k + 4) .. (n + 1) << (k + 4)). NaN are ignored.
+
+    ImGuiPlotSeries(int max_count = 0)  { MaxCount = max_count; Head = 0; }
+    void                Clear()         { Values.clear(); Head = 0; for (int k = 0; k < IM_ARRAYSIZE(Levels); k++) Levels[k].clear(); }
+    int                 Size() const    { return Values.Size; }
+    float               GetValue(int idx) const { IM_ASSERT(idx >= 0 && idx < Values.Size); idx += Head; return Values[idx < Values.Size ? idx : idx - Values.Size]; }
+    IMGUI_API void      PushBack(float v);
+    IMGUI_API void      SetValue(int idx, float v);
+    IMGUI_API void      CalcMinMax(int idx_begin, int idx_end, float* out_min, float* out_max) const; // Min/max of values [idx_begin, idx_end), ignoring NaN. FLT_MAX/-FLT_MAX when empty.
+    IMGUI_API void      CalcColumnsMinMax(int idx_begin, int idx_end, ImVec2* out_columns, int columns_count) const; // Min (x) and max (y) of values [idx_begin, idx_end) split in columns_count columns, for plotting. Boundaries between columns are moved back by less than half a column to use larger blocks.
+
+    // [Internal]
+    IMGUI_API void      UpdateLevels(int storage_idx);
+    IMGUI_API void      CalcStorageMinMax(int storage_begin, int storage_end, float* io_min, float* io_max) const;
+    IMGUI_API void      CalcRangeMinMax(int idx_begin, int idx_end, int level, float* io_min, float* io_max) const;
+};
+
+// Helper: Envelope of a plot: min (x) and max (y) of the values covered by each pixel column, and optionally their mean.
+// Build() doesn't use the Dear ImGui context and doesn't allocate when columns_count <= Columns.Capacity: it may then run on any thread,
+// as long as the values aren't modified meanwhile. (Dear ImGui allocations update context statistics: they must happen on the UI thread)
+// With columns_count = -1, Build() keeps the current size of Columns (as set by ImGuiPlotAsyncEnvelope::BeginBuild()) and never allocates.
+struct ImGuiPlotEnvelope
+{
+    ImVector<ImVec2>    Columns;        // Min (x) and max (y) of the values of each column, ignoring NaN (FLT_MAX/-FLT_MAX if none)
+    ImVector<float>     ColumnsMean;    // Mean of the values of each column, ignoring NaN. Empty unless BuildMean is set.
+    float               ValuesMin;      // Min/max of all values, ignoring NaN
+    float               ValuesMax;
+    int                 ValuesCount;    // Number of values the envelope was built from
+    unsigned int        Version;        // Version of the data the envelope was built from (set by ImGuiPlotAsyncEnvelope::BeginBuild())
+    bool                BuildMean;      // Also compute ColumnsMean, drawn as the plot over the faded min/max envelope. Reads every value, even from a ImGuiPlotSeries.
+
+    ImGuiPlotEnvelope()                 { ValuesMin = FLT_MAX; ValuesMax = -FLT_MAX; ValuesCount = 0; Version = 0; BuildMean = false; }
+    IMGUI_API void      Build(const float* values, int values_count, int values_offset = 0, int columns_count = -1, int stride = sizeof(float));
+    IMGUI_API void      Build(const ImGuiPlotSeries* series, int display_start = 0, int display_count = -1, int columns_count = -1);
+};
+
+// Helper: Double buffered envelope, to build plot envelopes on worker threads while PlotLines()/PlotHistogram() draw the last completed one.
+// Dear ImGui doesn't create threads: you schedule the builds on your own job system. Only Build() runs on a worker, everything else is
+// called from the UI thread, so no synchronization is needed beyond knowing that your task completed.
+// Usage:
+//   static ImGuiPlotAsyncEnvelope envelope;
+//   if (ImGuiPlotEnvelope* e = envelope.BeginBuild(data_version))      // When data_version changed and no build is in progress
+//       MyJobSystem_Submit([=]() { e->Build(values, count); });        // Only touch 'e' on the worker: its column count was fixed by BeginBuild()
+//   if (MyJobSystem_IsComplete(...))
+//       envelope.EndBuild();                                           // The built envelope is drawn from now on
+//   ImGui::PlotLines("Signal", &envelope);
+// The plot is drawn from the previous envelope while a build is in progress. With a WaitBuildFn callback, PlotLines()/PlotHistogram()
+// call it when the build started more than MaxStaleFrames frames ago: it should wait for the task and call EndBuild().
+struct ImGuiPlotAsyncEnvelope
+{
+    ImGuiPlotEnvelope   Envelopes[2];   // Displayed envelope and envelope being built
+    int                 FrontIdx;       // Index of the displayed envelope (-1 until a first build completes)
+    int                 ColumnsCount;   // Pixel width of the plot when last drawn. 0 until first drawn. Updated by PlotLines()/PlotHistogram(): don't read it from the worker.
+    bool                Building;       // A build is in progress (between BeginBuild() and EndBuild())
+    int                 BuildFrame;     // Frame of the last BeginBuild()
+    int                 MaxStaleFrames; // Number of frames a build may stay in progress before calling WaitBuildFn (default 1)
+    bool                BuildMean;      // Build envelopes with the mean of each column, see ImGuiPlotEnvelope::BuildMean
+    void                (*WaitBuildFn)(ImGuiPlotAsyncEnvelope* envelope, void* user_data); // Optional. Wait for the build to complete and call EndBuild().
+    void*               WaitBuildUserData;
+
+    ImGuiPlotAsyncEnvelope()            { FrontIdx = -1; ColumnsCount = 0; Building = false; BuildFrame = -1; MaxStaleFrames = 1; BuildMean = false; WaitBuildFn = NULL; WaitBuildUserData = NULL; }
+    const ImGuiPlotEnvelope* GetDisplayed() const { return FrontIdx >= 0 ? &Envelopes[FrontIdx] : NULL; }
+    IMGUI_API ImGuiPlotEnvelope* BeginBuild(unsigned int data_version); // Return an envelope to build (with Columns, and ColumnsMean if BuildMean is set, sized to ColumnsCount) if data_version or ColumnsCount changed since the last build, NULL otherwise
+    IMGUI_API void      EndBuild();                                     // Call once the build completed
+};
+
 // Helpers macros to generate 32-bit encoded colors
 #ifdef IMGUI_USE_BGRA_PACKED_COLOR
 #define IM_COL32_R_SHIFT    16
@@ -2004,6 +2362,7 @@ struct ImDrawCmd
     ImVec4          ClipRect;           // 4*4  // Clipping rectangle (x1, y1, x2, y2). Subtract ImDrawData->DisplayPos to get clipping rectangle in "viewport" coordinates
     ImTextureID     TextureId;          // 4-8  // User-provided texture ID. Set by user in ImfontAtlas::SetTexID() for fonts or passed to Image*() functions. Ignore if never using images or multiple fonts atlas.
     unsigned int    VtxOffset;          // 4    // Start offset in vertex buffer. ImGuiBackendFlags_RendererHasVtxOffset: always 0, otherwise may be >0 to support meshes larger than 64K vertices with 16-bit indices.
+    ImDrawCmdFlags  Flags;              // 4    // See ImDrawCmdFlags_. Generally 0, ImDrawCmdFlags_TextureSDF for text drawn with a signed distance field font.
     unsigned int    IdxOffset;          // 4    // Start offset in index buffer. Always equal to sum of ElemCount drawn so far.
     unsigned int    ElemCount;          // 4    // Number of indices (multiple of 3) to be rendered as triangles. Vertices are stored in the callee ImDrawList's vtx_buffer[] array, indices in idx_buffer[].
     ImDrawCallback  UserCallback;       // 4-8  // If != NULL, call the function instead of rendering the vertices. clip_rect and texture_id will be set normally.
@@ -2073,6 +2432,13 @@ enum ImDrawCornerFlags_
     ImDrawCornerFlags_All       = 0xF     // In your function calls you may use ~0 (= all bits sets) instead of ImDrawCornerFlags_All, as a convenience
 };
 
+// Flags for ImDrawCmd, telling the renderer back-end how to use the texture.
+enum ImDrawCmdFlags_
+{
+    ImDrawCmdFlags_None                     = 0,
+    ImDrawCmdFlags_TextureSDF               = 1 << 0   // Texture alpha holds a signed distance field (ImFontConfig::SignedDistanceField), 128 = glyph edge. Render with an alpha threshold around 0.5 instead of plain alpha blending.
+};
+
 // Flags for ImDrawList. Those are set automatically by ImGui:: functions from ImGuiIO settings, and generally not manipulated directly.
 // It is however possible to temporarily alter flags between calls to ImDrawList:: functions.
 enum ImDrawListFlags_
@@ -2109,6 +2475,8 @@ struct ImDrawList
     ImVector<ImVec4>        _ClipRectStack;     // [Internal]
     ImVector<ImTextureID>   _TextureIdStack;    // [Internal]
     ImVector<ImVec2>        _Path;              // [Internal] current path building
+    ImVector<ImDrawVert>    _TextPagesVtx;      // [Internal] for AddText(): quads of glyphs stored in other texture pages of the font atlas, emitted after the text
+    ImVector<unsigned int>  _TextPagesQuadPage; // [Internal] for AddText(): page of each quad in _TextPagesVtx
     ImDrawCmd               _CmdHeader;         // [Internal] Template of active commands. Fields should match those of CmdBuffer.back().
     ImDrawListSplitter      _Splitter;          // [Internal] for channels api (note: prefer using your own persistent instance of ImDrawListSplitter!)
 
@@ -2121,6 +2489,8 @@ struct ImDrawList
     IMGUI_API void  PopClipRect();
     IMGUI_API void  PushTextureID(ImTextureID texture_id);
     IMGUI_API void  PopTextureID();
+    IMGUI_API void  SetCmdFlags(ImDrawCmdFlags flags);                          // Set ImDrawCmd::Flags of upcoming primitives (e.g. ImDrawCmdFlags_TextureSDF). Restore previous value after use.
+    inline ImDrawCmdFlags GetCmdFlags() const { return _CmdHeader.Flags; }
     inline ImVec2   GetClipRectMin() const { const ImVec4& cr = _ClipRectStack.back(); return ImVec2(cr.x, cr.y); }
     inline ImVec2   GetClipRectMax() const { const ImVec4& cr = _ClipRectStack.back(); return ImVec2(cr.z, cr.w); }
 
@@ -2248,6 +2618,9 @@ struct ImFontConfig
     unsigned int    RasterizerFlags;        // 0x00     // Settings for custom font rasterizer (e.g. ImGuiFreeType). Leave as zero if you aren't using one.
     float           RasterizerMultiply;     // 1.0f     // Brighten (>1.0f) or darken (<1.0f) font output. Brightening small fonts may be a good workaround to make them more readable.
     ImWchar         EllipsisChar;           // -1       // Explicitly specify unicode codepoint of ellipsis character. When fonts are being merged first specified ellipsis will be used.
+    bool            SignedDistanceField;    // false    // Rasterize glyphs as signed distance fields, so a single size can be drawn sharply at any scale (e.g. SetWindowFontScale()). Oversample/RasterizerMultiply are ignored. Requires renderer support for ImDrawCmdFlags_TextureSDF. All sources merged into a font need the same setting.
+    int             SDFPadding;             // 4        // Distance range in pixels around the glyph outline, for signed distance field glyphs. Larger values allow effects (outline, glow) but use more texture space.
+    bool            LazyRasterize;          // false    // Don't rasterize GlyphRanges in Build(): glyphs are rasterized on first use (text drawn with the current font, or ImFont::FindOrQueueGlyph()), in the space left in the texture (see TexDesiredWidth). Useful for huge ranges e.g. GetGlyphRangesChineseFull(). Requires the renderer back-end to honor ImFontAtlas::TexDirty.
 
     // [Internal]
     char            Name[40];               // Name (strictly to ease debugging)
@@ -2260,7 +2633,8 @@ struct ImFontConfig
 // (Note: some language parsers may fail to convert the 31+1 bitfield members, in this case maybe drop store a single u32 or we can rework this)
 struct ImFontGlyph
 {
-    unsigned int    Codepoint : 31;     // 0x0000..0xFFFF
+    unsigned int    Codepoint : 24;     // 0x0000..0x10FFFF
+    unsigned int    Page : 7;           // Texture page within ImFontAtlas (0 = main texture, see ImFontAtlas::TexMaxHeight)
     unsigned int    Visible : 1;        // Flag to allow early out when rendering
     float           AdvanceX;           // Distance to next character (= data from font + ImFontConfig::GlyphExtraSpacing.x baked in)
     float           X0, Y0, X1, Y1;     // Glyph corners
@@ -2305,6 +2679,15 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoBakedLines       = 1 << 2    // Don't build thick line textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
 };
 
+// Additional texture page of a multi-page ImFontAtlas. Same size as the main texture (TexWidth * TexHeight).
+struct ImFontAtlasTexPage
+{
+    unsigned char*  TexPixelsAlpha8;    // 1 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight
+    unsigned int*   TexPixelsRGBA32;    // 4 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight * 4
+    ImTextureID     TexID;              // User data to refer to the texture once it has been uploaded. Glyphs of a page without TexID are not rendered.
+    ImFontAtlasTexPage()                { TexPixelsAlpha8 = NULL; TexPixelsRGBA32 = NULL; TexID = (ImTextureID)NULL; }
+};
+
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
 //  - One or more fonts.
 //  - Custom graphics data needed to render the shapes needed by Dear ImGui.
@@ -2332,7 +2715,7 @@ struct ImFontAtlas
     IMGUI_API ImFont*           AddFontFromMemoryTTF(void* font_data, int font_size, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // Note: Transfer ownership of 'ttf_data' to ImFontAtlas! Will be deleted after destruction of the atlas. Set font_cfg->FontDataOwnedByAtlas=false to keep ownership of your data and it won't be freed.
     IMGUI_API ImFont*           AddFontFromMemoryCompressedTTF(const void* compressed_font_data, int compressed_font_size, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // 'compressed_font_data' still owned by caller. Compress with binary_to_compressed_c.cpp.
     IMGUI_API ImFont*           AddFontFromMemoryCompressedBase85TTF(const char* compressed_font_data_base85, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL);              // 'compressed_font_data_base85' still owned by caller. Compress with binary_to_compressed_c.cpp with -base85 parameter.
-    IMGUI_API void              ClearInputData();           // Clear input data (all ImFontConfig structures including sizes, TTF data, glyph ranges, etc.) = all the data used to build the texture and fonts.
+    IMGUI_API void              ClearInputData();           // Clear input data (all ImFontConfig structures including sizes, TTF data, glyph ranges, etc.) = all the data used to build the texture and fonts. Also stops ImFontConfig::LazyRasterize: missing glyphs will use the fallback glyph.
     IMGUI_API void              ClearTexData();             // Clear output texture data (CPU side). Saves RAM once the texture has been copied to graphics memory.
     IMGUI_API void              ClearFonts();               // Clear output font data (glyphs storage, UV coordinates).
     IMGUI_API void              Clear();                    // Clear all input and output.
@@ -2348,6 +2731,23 @@ struct ImFontAtlas
     bool                        IsBuilt() const             { return Fonts.Size > 0 && (TexPixelsAlpha8 != NULL || TexPixelsRGBA32 != NULL); }
     void                        SetTexID(ImTextureID id)    { TexID = id; }
 
+    // Multi-page atlas: when TexMaxHeight is set, glyphs which don't fit in the main texture are stored in additional pages of the same size.
+    // Page 0 is the main texture (GetTexData***, SetTexID). Upload every page and call SetTexPageID() for each of them.
+    // Text using glyphs from several pages is drawn with one draw command per page.
+    int                         GetTexPagesCount() const                { return 1 + TexPages.Size; }
+    IMGUI_API void              GetTexPageDataAsAlpha8(int page, unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);
+    IMGUI_API void              GetTexPageDataAsRGBA32(int page, unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);
+    ImTextureID                 GetTexPageID(int page) const            { return page == 0 ? TexID : TexPages[page - 1].TexID; }
+    void                        SetTexPageID(int page, ImTextureID id)  { if (page == 0) TexID = id; else TexPages[page - 1].TexID = id; }
+
+    // Build cache: save the output of Build() to a file and reload it on the next run, skipping TTF parsing, packing and rasterization.
+    // The file is keyed on font data, sizes, glyph ranges, ImFontConfig fields and custom rects: a stale cache is ignored and rebuilt.
+    // Call BuildWithCache() after adding your fonts and custom rects, before the GetTexData*** functions. Don't call ClearInputData() before it.
+    // Atlases using ImFontConfig::LazyRasterize are never cached.
+    IMGUI_API bool              BuildWithCache(const char* filename);   // Load from cache file if it matches current fonts, otherwise Build() and save cache file.
+    IMGUI_API bool              LoadBuildCache(const char* filename);   // Return false and leave atlas unbuilt if file is missing or doesn't match current fonts.
+    IMGUI_API bool              SaveBuildCache(const char* filename);
+
     //-------------------------------------------
     // Glyph Ranges
     //-------------------------------------------
@@ -2391,6 +2791,7 @@ struct ImFontAtlas
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0.
+    int                         TexMaxHeight;       // Maximum texture height before spilling glyphs into additional pages (see GetTexPagesCount()). Defaults to 0 (unlimited = single texture).
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
@@ -2404,10 +2805,13 @@ struct ImFontAtlas
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    ImVector<ImFontAtlasTexPage> TexPages;          // Additional texture pages (page 1 and more). Same size as the main texture.
+    bool                        TexDirty;           // Set when glyphs were added to TexPixels or TexPages after Build() (ImFontConfig::LazyRasterize). Renderer back-end needs to upload the textures again and clear it.
 
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
+    void*                       LazyBuildData;      // Packing state kept after Build() when using ImFontConfig::LazyRasterize. Released by ClearTexData() and ClearInputData().
 
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
@@ -2436,16 +2840,20 @@ struct ImFont
     ImWchar                     FallbackChar;       // 2     // in  // = '?'      // Replacement character if a glyph isn't found. Only set via SetFallbackChar()
     ImWchar                     EllipsisChar;       // 2     // out // = -1       // Character used for ellipsis rendering.
     bool                        DirtyLookupTables;  // 1     // out //
+    bool                        UseSDF;             // 1     // out // = false    // Glyphs are signed distance fields (ImFontConfig::SignedDistanceField). Text is drawn with ImDrawCmdFlags_TextureSDF.
     float                       Scale;              // 4     // in  // = 1.f      // Base font scale, multiplied by the per-window font scale which you can adjust with SetWindowFontScale()
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
     ImU8                        Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8]; // 2 bytes if ImWchar=ImWchar16, 34 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
+    ImVector<ImU32>             LazyGlyphsRequested;// 12-16 // out //            // 1-bit per codepoint already queued. Empty unless a source uses ImFontConfig::LazyRasterize.
+    ImVector<ImWchar>           LazyGlyphsQueue;    // 12-16 // out //            // Codepoints missed by FindOrQueueGlyph(), rasterized on next NewFrame() by ImFontAtlasBuildLazyGlyphs().
 
     // Methods
     IMGUI_API ImFont();
     IMGUI_API ~ImFont();
     IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;
     IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;
+    IMGUI_API const ImFontGlyph*FindOrQueueGlyph(ImWchar c);            // Same as FindGlyph(), and queue a missing glyph to be rasterized on next NewFrame() if a source uses ImFontConfig::LazyRasterize. Done by ImDrawList::AddText() when using the current font.
     float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
     bool                        IsLoaded() const                    { return ContainerAtlas != NULL; }
     const char*                 GetDebugName() const                { return ConfigData ? ConfigData->Name : "<unknown>"; }
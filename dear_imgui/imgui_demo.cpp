@@ -781,6 +781,48 @@ static void ShowDemoWindowWidgets()
                 ImGui::Indent(ImGui::GetTreeNodeToLabelSpacing());
             ImGui::TreePop();
         }
+        if (ImGui::TreeNode("Large tree (ImGuiTreeView)"))
+        {
+            HelpMarker(
+                "ImGuiTreeView keeps the list of visible nodes, so they can be clipped with ImGuiListClipper.\n"
+                "Here node N has nodes 8*N+1 to 8*N+8 as children: the cost of a frame doesn't depend on the size of the tree.");
+            struct Funcs
+            {
+                static int GetChildCount(void* user_data, int node)
+                {
+                    const int nodes_count = *(int*)user_data;
+                    if (node < 0)
+                        return 1;
+                    const int first = node * 8 + 1;
+                    return first >= nodes_count ? 0 : (nodes_count - first < 8) ? nodes_count - first : 8;
+                }
+                static int GetChild(void*, int node, int child_idx) { return node < 0 ? 0 : node * 8 + 1 + child_idx; }
+            };
+            static int nodes_count = 500000;
+            static ImGuiTreeView view;
+            view.GetChildCount = Funcs::GetChildCount;
+            view.GetChild = Funcs::GetChild;
+            view.UserData = &nodes_count;
+            if (ImGui::SliderInt("Nodes", &nodes_count, 1, 5000000))
+                view.Invalidate();
+            ImGui::Text("%d visible nodes", view.Rows.Size);
+            if (ImGui::BeginChild("##tree", ImVec2(-FLT_MIN, ImGui::GetTextLineHeightWithSpacing() * 12), true))
+            {
+                ImGui::BeginTreeView(&view);
+                ImGuiListClipper clipper;
+                clipper.Begin(view.Rows.Size);
+                while (clipper.Step())
+                    for (int row = clipper.DisplayStart; row < clipper.DisplayEnd && row < view.Rows.Size; row++)
+                    {
+                        char label[32];
+                        sprintf(label, "Node %d", view.Rows[row].Node);
+                        ImGui::TreeViewNode(&view, row, label);
+                    }
+                ImGui::EndTreeView();
+            }
+            ImGui::EndChild();
+            ImGui::TreePop();
+        }
         ImGui::TreePop();
     }
 
@@ -1063,6 +1105,33 @@ static void ShowDemoWindowWidgets()
             }
             ImGui::TreePop();
         }
+        if (ImGui::TreeNode("Selection State: Multiple Selection (large list)"))
+        {
+            HelpMarker(
+                "BeginMultiSelect()/EndMultiSelect() handle CTRL+Click, SHIFT+Click, keyboard navigation with SHIFT, "
+                "CTRL+A and box-selection by dragging from empty space.\n"
+                "The selection is stored as sorted ranges, so its cost depends on the number of ranges, not items.");
+            static ImGuiSelectionRanges selection;
+            const int items_count = 1000000;
+            ImGui::Text("Selected: %d items in %d ranges", selection.CalcSelectedCount(), selection.Bounds.Size / 2);
+            if (ImGui::BeginChild("##items", ImVec2(-FLT_MIN, ImGui::GetTextLineHeightWithSpacing() * 10), true))
+            {
+                ImGui::BeginMultiSelect(&selection, items_count);
+                ImGuiListClipper clipper;
+                clipper.Begin(items_count);
+                while (clipper.Step())
+                    for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+                    {
+                        char label[32];
+                        sprintf(label, "Object %07d", n);
+                        ImGui::SetNextItemSelectionIndex(n);
+                        ImGui::Selectable(label, false, 0, ImVec2(ImGui::GetFontSize() * 12, 0)); // Leave empty space on the right to start box-selection
+                    }
+                ImGui::EndMultiSelect();
+            }
+            ImGui::EndChild();
+            ImGui::TreePop();
+        }
         if (ImGui::TreeNode("Rendering more text into the same line"))
         {
             // Using the Selectable() override that takes "bool* p_selected" parameter,
@@ -1168,6 +1237,8 @@ static void ShowDemoWindowWidgets()
             ImGui::CheckboxFlags("ImGuiInputTextFlags_ReadOnly", (unsigned int*)&flags, ImGuiInputTextFlags_ReadOnly);
             ImGui::CheckboxFlags("ImGuiInputTextFlags_AllowTabInput", (unsigned int*)&flags, ImGuiInputTextFlags_AllowTabInput);
             ImGui::CheckboxFlags("ImGuiInputTextFlags_CtrlEnterForNewLine", (unsigned int*)&flags, ImGuiInputTextFlags_CtrlEnterForNewLine);
+            ImGui::CheckboxFlags("ImGuiInputTextFlags_RetainLineIndex", (unsigned int*)&flags, ImGuiInputTextFlags_RetainLineIndex); ImGui::SameLine(); HelpMarker("Keep a line index between frames, so very large buffers are only measured and rendered for their visible lines while inactive. Only appending to the buffer is allowed from your code.");
+            ImGui::CheckboxFlags("ImGuiInputTextFlags_IncrementalCopyBack", (unsigned int*)&flags, ImGuiInputTextFlags_IncrementalCopyBack); ImGui::SameLine(); HelpMarker("While editing, only copy the modified text back to the buffer every frame. The buffer must not be modified by your code while active.");
             ImGui::InputTextMultiline("##source", text, IM_ARRAYSIZE(text), ImVec2(-FLT_MIN, ImGui::GetTextLineHeight() * 16), flags);
             ImGui::TreePop();
         }
@@ -1365,6 +1436,22 @@ static void ShowDemoWindowWidgets()
         ImGui::PlotHistogram("Histogram", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
         ImGui::Separator();
 
+        // Use ImGuiPlotSeries for large or live data: the cost of plotting doesn't depend on the number of values displayed,
+        // so you can zoom and pan over millions of values.
+        static ImGuiPlotSeries series(1000000);
+        static int series_zoom_count = 1000000, series_pan = 0, series_sample = 0;
+        for (int n = 0; n < (series.Size() == 0 ? 500000 : animate ? 500 : 0); n++, series_sample++) // Append 30k values per second at 60 FPS. Once 1M values are stored, the oldest ones are overwritten.
+            series.PushBack(sinf(series_sample * 0.0001f) + sinf(series_sample * 0.37f) * 0.1f);
+        ImGui::SetNextItemWidth(200);
+        ImGui::SliderInt("Zoom", &series_zoom_count, 100, series.Size(), "%d values", ImGuiSliderFlags_Logarithmic);
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(200);
+        ImGui::SliderInt("Pan", &series_pan, 0, series.Size(), "%d values from end");
+        const int series_count = IM_MIN(series_zoom_count, series.Size());
+        const int series_start = IM_MAX(0, series.Size() - series_count - series_pan);
+        ImGui::PlotLines("Series", &series, series_start, series_count, NULL, FLT_MAX, FLT_MAX, ImVec2(0, 80));
+        ImGui::Separator();
+
         // Animate a simple progress bar
         static float progress = 0.0f, progress_dir = 1.0f;
         if (animate)
@@ -4019,11 +4106,13 @@ void ImGui::ShowStyleEditor(ImGuiStyle* ref)
                 NodeFont(font);
                 ImGui::PopID();
             }
-            if (ImGui::TreeNode("Atlas texture", "Atlas texture (%dx%d pixels)", atlas->TexWidth, atlas->TexHeight))
+            if (ImGui::TreeNode("Atlas texture", "Atlas texture (%dx%d pixels, %d page(s))", atlas->TexWidth, atlas->TexHeight, atlas->GetTexPagesCount()))
             {
                 ImVec4 tint_col = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
                 ImVec4 border_col = ImVec4(1.0f, 1.0f, 1.0f, 0.5f);
-                ImGui::Image(atlas->TexID, ImVec2((float)atlas->TexWidth, (float)atlas->TexHeight), ImVec2(0, 0), ImVec2(1, 1), tint_col, border_col);
+                for (int page = 0; page < atlas->GetTexPagesCount(); page++)
+                    if (page == 0 || atlas->GetTexPageID(page) != NULL)
+                        ImGui::Image(atlas->GetTexPageID(page), ImVec2((float)atlas->TexWidth, (float)atlas->TexHeight), ImVec2(0, 0), ImVec2(1, 1), tint_col, border_col);
                 ImGui::TreePop();
             }
 
@@ -4885,7 +4974,8 @@ static void ShowExampleAppLongText(bool* p_open)
     ImGui::Combo("Test type", &test_type,
         "Single call to TextUnformatted()\0"
         "Multiple calls to Text(), clipped\0"
-        "Multiple calls to Text(), not clipped (slow)\0");
+        "Multiple calls to Text(), not clipped (slow)\0"
+        "Multiple calls to Text(), variable heights, clipped\0");
     ImGui::Text("Buffer contents: %d lines, %d bytes", lines, log.size());
     if (ImGui::Button("Clear")) { log.clear(); lines = 0; }
     ImGui::SameLine();
@@ -4921,6 +5011,25 @@ static void ShowExampleAppLongText(bool* p_open)
             ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
         ImGui::PopStyleVar();
         break;
+    case 3:
+        {
+            // Items of different heights (every 10th line is taller) - demonstrate using ImGuiListClipper with ImGuiListClipperHeights.
+            // The clipper measures visible items and remembers their heights, items which were never visible use heights.DefaultHeight.
+            static ImGuiListClipperHeights heights;
+            ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+            ImGuiListClipper clipper;
+            clipper.Begin(lines, &heights);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                {
+                    if ((i % 10) == 0)
+                        ImGui::Text("%i The quick brown fox jumps over the lazy dog\n    (every 10th line is taller)", i);
+                    else
+                        ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
+                }
+            ImGui::PopStyleVar();
+            break;
+        }
     }
     ImGui::EndChild();
     ImGui::End();
@@ -15,6 +15,7 @@ Index of this file:
 // [SECTION] ImFontAtlas
 // [SECTION] ImFontAtlas glyph ranges helpers
 // [SECTION] ImFontGlyphRangesBuilder
+// [SECTION] ImFontAtlas build cache
 // [SECTION] ImFont
 // [SECTION] ImGui Internal Render Helpers
 // [SECTION] Decompression code
@@ -382,6 +383,7 @@ void ImDrawList::_ResetForNewFrame()
     IM_ASSERT(IM_OFFSETOF(ImDrawCmd, ClipRect) == 0);
     IM_ASSERT(IM_OFFSETOF(ImDrawCmd, TextureId) == sizeof(ImVec4));
     IM_ASSERT(IM_OFFSETOF(ImDrawCmd, VtxOffset) == sizeof(ImVec4) + sizeof(ImTextureID));
+    IM_ASSERT(IM_OFFSETOF(ImDrawCmd, Flags) == sizeof(ImVec4) + sizeof(ImTextureID) + sizeof(unsigned int));
 
     CmdBuffer.resize(0);
     IdxBuffer.resize(0);
@@ -410,11 +412,14 @@ void ImDrawList::_ClearFreeMemory()
     _ClipRectStack.clear();
     _TextureIdStack.clear();
     _Path.clear();
+    _TextPagesVtx.clear();
+    _TextPagesQuadPage.clear();
     _Splitter.ClearFreeMemory();
 }
 
 ImDrawList* ImDrawList::CloneOutput() const
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawList);
     ImDrawList* dst = IM_NEW(ImDrawList(_Data));
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
@@ -425,10 +430,12 @@ ImDrawList* ImDrawList::CloneOutput() const
 
 void ImDrawList::AddDrawCmd()
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawList);
     ImDrawCmd draw_cmd;
     draw_cmd.ClipRect = _CmdHeader.ClipRect;    // Same as calling ImDrawCmd_HeaderCopy()
     draw_cmd.TextureId = _CmdHeader.TextureId;
     draw_cmd.VtxOffset = _CmdHeader.VtxOffset;
+    draw_cmd.Flags = _CmdHeader.Flags;
     draw_cmd.IdxOffset = IdxBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
@@ -448,6 +455,7 @@ void ImDrawList::_PopUnusedDrawCmd()
 
 void ImDrawList::AddCallback(ImDrawCallback callback, void* callback_data)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawList);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     IM_ASSERT(curr_cmd->UserCallback == NULL);
     if (curr_cmd->ElemCount != 0)
@@ -461,10 +469,10 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* callback_data)
     AddDrawCmd(); // Force a new command after us (see comment below)
 }
 
-// Compare ClipRect, TextureId and VtxOffset with a single memcmp()
-#define ImDrawCmd_HeaderSize                        (IM_OFFSETOF(ImDrawCmd, VtxOffset) + sizeof(unsigned int))
-#define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)   (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TextureId, VtxOffset
-#define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)      (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TextureId, VtxOffset
+// Compare ClipRect, TextureId, VtxOffset and Flags with a single memcmp()
+#define ImDrawCmd_HeaderSize                        (IM_OFFSETOF(ImDrawCmd, Flags) + sizeof(ImDrawCmdFlags))
+#define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)   (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TextureId, VtxOffset, Flags
+#define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)      (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TextureId, VtxOffset, Flags
 
 // Our scheme may appears a bit unusual, basically we want the most-common calls AddLine AddRect etc. to not have to perform any check so we always have a command ready in the stack.
 // The cost of figuring out if a new command has to be added or if we can merge is paid in those Update** functions only.
@@ -494,7 +502,7 @@ void ImDrawList::_OnChangedTextureID()
 {
     // If current command is used with different settings we need to add a new command
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount != 0 && curr_cmd->TextureId != _CmdHeader.TextureId)
+    if (curr_cmd->ElemCount != 0 && (curr_cmd->TextureId != _CmdHeader.TextureId || curr_cmd->Flags != _CmdHeader.Flags))
     {
         AddDrawCmd();
         return;
@@ -510,6 +518,7 @@ void ImDrawList::_OnChangedTextureID()
     }
 
     curr_cmd->TextureId = _CmdHeader.TextureId;
+    curr_cmd->Flags = _CmdHeader.Flags;
 }
 
 void ImDrawList::_OnChangedVtxOffset()
@@ -530,6 +539,7 @@ void ImDrawList::_OnChangedVtxOffset()
 // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
 void ImDrawList::PushClipRect(ImVec2 cr_min, ImVec2 cr_max, bool intersect_with_current_clip_rect)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawList);
     ImVec4 cr(cr_min.x, cr_min.y, cr_max.x, cr_max.y);
     if (intersect_with_current_clip_rect)
     {
@@ -561,6 +571,7 @@ void ImDrawList::PopClipRect()
 
 void ImDrawList::PushTextureID(ImTextureID texture_id)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawList);
     _TextureIdStack.push_back(texture_id);
     _CmdHeader.TextureId = texture_id;
     _OnChangedTextureID();
@@ -573,11 +584,21 @@ void ImDrawList::PopTextureID()
     _OnChangedTextureID();
 }
 
+// Flags are a property of how the texture is sampled, so they share the texture change logic (same merging rules).
+void ImDrawList::SetCmdFlags(ImDrawCmdFlags flags)
+{
+    if (_CmdHeader.Flags == flags)
+        return;
+    _CmdHeader.Flags = flags;
+    _OnChangedTextureID();
+}
+
 // Reserve space for a number of vertices and indices.
 // You must finish filling your reserved data before calling PrimReserve() again, as it may reallocate or
 // submit the intermediate results. PrimUnreserve() can be used to release unused allocations.
 void ImDrawList::PrimReserve(int idx_count, int vtx_count)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawList);
     // Large mesh support (when enabled)
     IM_ASSERT_PARANOID(idx_count >= 0 && vtx_count >= 0);
     if (sizeof(ImDrawIdx) == 2 && (_VtxCurrentIdx + vtx_count >= (1 << 16)) && (Flags & ImDrawListFlags_AllowVtxOffset))
@@ -666,6 +687,7 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawList);
     if (points_count < 2)
         return;
 
@@ -921,6 +943,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
 // We intentionally avoid using ImVec2 and its math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_count, ImU32 col)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawList);
     if (points_count < 3)
         return;
 
@@ -1002,6 +1025,7 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
 
 void ImDrawList::PathArcToFast(const ImVec2& center, float radius, int a_min_of_12, int a_max_of_12)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawList);
     if (radius == 0.0f || a_min_of_12 > a_max_of_12)
     {
         _Path.push_back(center);
@@ -1025,6 +1049,7 @@ void ImDrawList::PathArcToFast(const ImVec2& center, float radius, int a_min_of_
 
 void ImDrawList::PathArcTo(const ImVec2& center, float radius, float a_min, float a_max, int num_segments)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawList);
     if (radius == 0.0f)
     {
         _Path.push_back(center);
@@ -1079,6 +1104,7 @@ static void PathBezierToCasteljau(ImVector<ImVec2>* path, float x1, float y1, fl
 
 void ImDrawList::PathBezierCurveTo(const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, int num_segments)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawList);
     ImVec2 p1 = _Path.back();
     if (num_segments == 0)
     {
@@ -1312,6 +1338,8 @@ void ImDrawList::AddBezierCurve(const ImVec2& p1, const ImVec2& p2, const ImVec2
     PathStroke(col, false, thickness);
 }
 
+static void ImFontRenderText(const ImFont* font, ImFont* queue_font, ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip); // See ImFont::RenderText()
+
 void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end, float wrap_width, const ImVec4* cpu_fine_clip_rect)
 {
     if ((col & IM_COL32_A_MASK) == 0)
@@ -1338,7 +1366,10 @@ void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos,
         clip_rect.z = ImMin(clip_rect.z, cpu_fine_clip_rect->z);
         clip_rect.w = ImMin(clip_rect.w, cpu_fine_clip_rect->w);
     }
-    font->RenderText(this, font_size, pos, col, clip_rect, text_begin, text_end, wrap_width, cpu_fine_clip_rect != NULL);
+
+    // Queue missing glyphs of the current font (owned by the context, which gives us non-const access to it) if it has lazily rasterized sources
+    ImFont* queue_font = (font == _Data->Font && font->LazyGlyphsRequested.Size > 0) ? _Data->Font : NULL;
+    ImFontRenderText(font, queue_font, this, font_size, pos, col, clip_rect, text_begin, text_end, wrap_width, cpu_fine_clip_rect != NULL);
 }
 
 void ImDrawList::AddText(const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end)
@@ -1426,6 +1457,7 @@ void ImDrawListSplitter::ClearFreeMemory()
 
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawList);
     IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
     int old_channels_count = _Channels.Size;
     if (old_channels_count < channels_count)
@@ -1456,8 +1488,15 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
     }
 }
 
+// Number of commands to skip at the start of a channel when merging: 1 when its first command is empty (merged into the previous channel)
+static inline int ImDrawChannel_FirstCmdSkip(const ImDrawChannel& ch)
+{
+    return (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.Data[0].ElemCount == 0 && ch._CmdBuffer.Data[0].UserCallback == NULL) ? 1 : 0;
+}
+
 void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_DrawList);
     // Note that we never use or rely on _Channels.Size because it is merely a buffer that we never shrink back to 0 to keep all sub-buffers ready for use.
     if (_Count <= 1)
         return;
@@ -1484,16 +1523,18 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
             if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
             {
                 // Merge previous channel last draw command with current channel first draw command if matching.
+                // The emptied command is skipped when copying commands below, instead of being erased from the channel.
                 last_cmd->ElemCount += next_cmd->ElemCount;
                 idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
+                next_cmd->ElemCount = 0;
             }
         }
-        if (ch._CmdBuffer.Size > 0)
+        const int cmd_skip = ImDrawChannel_FirstCmdSkip(ch);
+        if (ch._CmdBuffer.Size > cmd_skip)
             last_cmd = &ch._CmdBuffer.back();
-        new_cmd_buffer_count += ch._CmdBuffer.Size;
+        new_cmd_buffer_count += ch._CmdBuffer.Size - cmd_skip;
         new_idx_buffer_count += ch._IdxBuffer.Size;
-        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
+        for (int cmd_n = cmd_skip; cmd_n < ch._CmdBuffer.Size; cmd_n++)
         {
             ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
             idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
@@ -1508,7 +1549,8 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        const int cmd_skip = ImDrawChannel_FirstCmdSkip(ch);
+        if (int sz = ch._CmdBuffer.Size - cmd_skip) { memcpy(cmd_write, ch._CmdBuffer.Data + cmd_skip, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
         if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
     }
     draw_list->_IdxWritePtr = idx_write;
@@ -1664,6 +1706,9 @@ ImFontConfig::ImFontConfig()
     RasterizerFlags = 0x00;
     RasterizerMultiply = 1.0f;
     EllipsisChar = (ImWchar)-1;
+    SignedDistanceField = false;
+    SDFPadding = 4;
+    LazyRasterize = false;
     memset(Name, 0, sizeof(Name));
     DstFont = NULL;
 }
@@ -1707,6 +1752,8 @@ static const char FONT_ATLAS_DEFAULT_TEX_DATA_PIXELS[FONT_ATLAS_DEFAULT_TEX_DATA
     "                                                      -    XX           XX    -                             "
 };
 
+static void ImFontAtlasBuildClearLazyData(ImFontAtlas* atlas);
+
 static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3] =
 {
     // Pos ........ Size ......... Offset ......
@@ -1727,13 +1774,16 @@ ImFontAtlas::ImFontAtlas()
     TexID = (ImTextureID)NULL;
     TexDesiredWidth = 0;
     TexGlyphPadding = 1;
+    TexMaxHeight = 0;
 
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
     TexWidth = TexHeight = 0;
     TexUvScale = ImVec2(0.0f, 0.0f);
     TexUvWhitePixel = ImVec2(0.0f, 0.0f);
+    TexDirty = false;
     PackIdMouseCursors = PackIdLines = -1;
+    LazyBuildData = NULL;
 }
 
 ImFontAtlas::~ImFontAtlas()
@@ -1762,6 +1812,9 @@ void    ImFontAtlas::ClearInputData()
     ConfigData.clear();
     CustomRects.clear();
     PackIdMouseCursors = PackIdLines = -1;
+
+    // Lazy rasterization reads the TTF data and ImFontConfig entries we just released.
+    ImFontAtlasBuildClearLazyData(this);
 }
 
 void    ImFontAtlas::ClearTexData()
@@ -1773,6 +1826,16 @@ void    ImFontAtlas::ClearTexData()
         IM_FREE(TexPixelsRGBA32);
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
+    for (int page_n = 0; page_n < TexPages.Size; page_n++)
+    {
+        if (TexPages[page_n].TexPixelsAlpha8)
+            IM_FREE(TexPages[page_n].TexPixelsAlpha8);
+        if (TexPages[page_n].TexPixelsRGBA32)
+            IM_FREE(TexPages[page_n].TexPixelsRGBA32);
+    }
+    TexPages.clear();
+    TexDirty = false;
+    ImFontAtlasBuildClearLazyData(this);
 }
 
 void    ImFontAtlas::ClearFonts()
@@ -1792,6 +1855,7 @@ void    ImFontAtlas::Clear()
 
 void    ImFontAtlas::GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     // Build atlas on demand
     if (TexPixelsAlpha8 == NULL)
     {
@@ -1808,6 +1872,7 @@ void    ImFontAtlas::GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_wid
 
 void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     // Convert to RGBA32 format on demand
     // Although it is likely to be the most commonly used format, our font rendering is 1 channel / 8 bpp
     if (!TexPixelsRGBA32)
@@ -1830,8 +1895,49 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
     if (out_bytes_per_pixel) *out_bytes_per_pixel = 4;
 }
 
+void    ImFontAtlas::GetTexPageDataAsAlpha8(int page, unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
+{
+    if (page == 0)
+    {
+        GetTexDataAsAlpha8(out_pixels, out_width, out_height, out_bytes_per_pixel);
+        return;
+    }
+    IM_ASSERT(page > 0 && page < GetTexPagesCount());
+    *out_pixels = TexPages[page - 1].TexPixelsAlpha8;
+    if (out_width) *out_width = TexWidth;
+    if (out_height) *out_height = TexHeight;
+    if (out_bytes_per_pixel) *out_bytes_per_pixel = 1;
+}
+
+void    ImFontAtlas::GetTexPageDataAsRGBA32(int page, unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel)
+{
+    if (page == 0)
+    {
+        GetTexDataAsRGBA32(out_pixels, out_width, out_height, out_bytes_per_pixel);
+        return;
+    }
+
+    // Convert to RGBA32 format on demand
+    IM_ASSERT(page > 0 && page < GetTexPagesCount());
+    ImFontAtlasTexPage& tex_page = TexPages[page - 1];
+    if (!tex_page.TexPixelsRGBA32 && tex_page.TexPixelsAlpha8)
+    {
+        tex_page.TexPixelsRGBA32 = (unsigned int*)IM_ALLOC((size_t)TexWidth * (size_t)TexHeight * 4);
+        const unsigned char* src = tex_page.TexPixelsAlpha8;
+        unsigned int* dst = tex_page.TexPixelsRGBA32;
+        for (int n = TexWidth * TexHeight; n > 0; n--)
+            *dst++ = IM_COL32(255, 255, 255, (unsigned int)(*src++));
+    }
+
+    *out_pixels = (unsigned char*)tex_page.TexPixelsRGBA32;
+    if (out_width) *out_width = TexWidth;
+    if (out_height) *out_height = TexHeight;
+    if (out_bytes_per_pixel) *out_bytes_per_pixel = 4;
+}
+
 ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     IM_ASSERT(font_cfg->FontData != NULL && font_cfg->FontDataSize > 0);
     IM_ASSERT(font_cfg->SizePixels > 0.0f);
@@ -1855,6 +1961,11 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
 
     if (new_font_cfg.DstFont->EllipsisChar == (ImWchar)-1)
         new_font_cfg.DstFont->EllipsisChar = font_cfg->EllipsisChar;
+    if (new_font_cfg.MergeMode)
+        for (int cfg_n = 0; cfg_n < ConfigData.Size - 1; cfg_n++)
+            if (ConfigData[cfg_n].DstFont == new_font_cfg.DstFont)
+                IM_ASSERT(ConfigData[cfg_n].SignedDistanceField == new_font_cfg.SignedDistanceField && "Cannot merge regular and signed distance field sources into a same font!");
+    IM_ASSERT(!new_font_cfg.SignedDistanceField || new_font_cfg.SDFPadding > 0);
 
     // Invalidate texture
     ClearTexData();
@@ -1901,6 +2012,7 @@ ImFont* ImFontAtlas::AddFontDefault(const ImFontConfig* font_cfg_template)
 
 ImFont* ImFontAtlas::AddFontFromFileTTF(const char* filename, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     size_t data_size = 0;
     void* data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
@@ -1936,6 +2048,7 @@ ImFont* ImFontAtlas::AddFontFromMemoryTTF(void* ttf_data, int ttf_size, float si
 
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_data, int compressed_ttf_size, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     const unsigned int buf_decompressed_size = stb_decompress_length((const unsigned char*)compressed_ttf_data);
     unsigned char* buf_decompressed_data = (unsigned char*)IM_ALLOC(buf_decompressed_size);
     stb_decompress(buf_decompressed_data, (const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
@@ -1948,6 +2061,7 @@ ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_d
 
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedBase85TTF(const char* compressed_ttf_data_base85, float size_pixels, const ImFontConfig* font_cfg, const ImWchar* glyph_ranges)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     int compressed_ttf_size = (((int)strlen(compressed_ttf_data_base85) + 4) / 5) * 4;
     void* compressed_ttf = IM_ALLOC((size_t)compressed_ttf_size);
     Decode85((const unsigned char*)compressed_ttf_data_base85, (unsigned char*)compressed_ttf);
@@ -1958,6 +2072,7 @@ ImFont* ImFontAtlas::AddFontFromMemoryCompressedBase85TTF(const char* compressed
 
 int ImFontAtlas::AddCustomRectRegular(int width, int height)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     IM_ASSERT(width > 0 && width <= 0xFFFF);
     IM_ASSERT(height > 0 && height <= 0xFFFF);
     ImFontAtlasCustomRect r;
@@ -1969,6 +2084,7 @@ int ImFontAtlas::AddCustomRectRegular(int width, int height)
 
 int ImFontAtlas::AddCustomRectFontGlyph(ImFont* font, ImWchar id, int width, int height, float advance_x, const ImVec2& offset)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
 #ifdef IMGUI_USE_WCHAR32
     IM_ASSERT(id <= IM_UNICODE_CODEPOINT_MAX);
 #endif
@@ -2017,6 +2133,7 @@ bool ImFontAtlas::GetMouseCursorTexData(ImGuiMouseCursor cursor_type, ImVec2* ou
 
 bool    ImFontAtlas::Build()
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     return ImFontAtlasBuildWithStbTruetype(this);
 }
@@ -2063,6 +2180,128 @@ struct ImFontBuildDstData
     ImBitVector         GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+// Source font using ImFontConfig::LazyRasterize, kept after Build() to rasterize glyphs on demand
+struct ImFontLazySrcData
+{
+    stbtt_fontinfo      FontInfo;
+    int                 ConfigIndex;        // Index into atlas->ConfigData[]
+};
+
+// Rectangle packer for one texture page (same setup as stbtt_PackBegin())
+struct ImFontAtlasPagePacker
+{
+    stbrp_context           Context;
+    ImVector<stbrp_node>    Nodes;
+    ImFontAtlasPagePacker(int width, int height, int padding) { Nodes.resize(width - padding); stbrp_init_target(&Context, width - padding, height - padding, Nodes.Data, Nodes.Size); }
+};
+
+// Stored in atlas->LazyBuildData
+struct ImFontAtlasLazyBuildData
+{
+    ImFontAtlasPagePacker*      Packer;         // Packer state of the last page at the end of Build(), new glyphs are packed into the remaining space
+    int                         PackerPage;     // Texture page of Packer
+    ImVector<ImFontLazySrcData> Sources;
+};
+
+#define IM_FONT_ATLAS_PAGES_MAX     128         // Limited by ImFontGlyph::Page
+
+// Add a blank texture page of the same size as the main texture, return its index
+static int ImFontAtlasBuildAddTexPage(ImFontAtlas* atlas)
+{
+    IM_ASSERT(atlas->GetTexPagesCount() < IM_FONT_ATLAS_PAGES_MAX);
+    ImFontAtlasTexPage page;
+    page.TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
+    memset(page.TexPixelsAlpha8, 0, atlas->TexWidth * atlas->TexHeight);
+    atlas->TexPages.push_back(page);
+    return atlas->TexPages.Size;
+}
+
+// With a limited texture height, pack rectangles by chunks in their order (= codepoint order) rather than all at once (= sorted by height),
+// so the first glyphs of each source (e.g. Basic Latin) stay together in the first page and most text is drawn with a single texture.
+static void ImFontAtlasBuildPackRectsByChunks(stbrp_context* pack_context, stbrp_rect* rects, int rects_count)
+{
+    const int CHUNK_SIZE = 256;
+    for (int rect_n = 0; rect_n < rects_count; rect_n += CHUNK_SIZE)
+        stbrp_pack_rects(pack_context, rects + rect_n, ImMin(CHUNK_SIZE, rects_count - rect_n));
+}
+
+static unsigned char* ImFontAtlasBuildGetTexPagePixels(ImFontAtlas* atlas, int page)
+{
+    return (page == 0) ? atlas->TexPixelsAlpha8 : atlas->TexPages[page - 1].TexPixelsAlpha8;
+}
+
+// Setup the fields of a stbtt_pack_context used by stbtt_PackFontRangesRenderIntoRects(), rendering into a given texture page
+static void ImFontAtlasBuildInitRenderContext(ImFontAtlas* atlas, int page, stbtt_pack_context* spc)
+{
+    memset(spc, 0, sizeof(*spc));
+    spc->width = atlas->TexWidth;
+    spc->height = atlas->TexHeight;
+    spc->stride_in_bytes = atlas->TexWidth;
+    spc->padding = atlas->TexGlyphPadding;
+    spc->h_oversample = spc->v_oversample = 1;
+    spc->pixels = ImFontAtlasBuildGetTexPagePixels(atlas, page);
+}
+
+#define IM_FONT_SDF_ON_EDGE_VALUE   128         // Distance field value on the glyph outline (see ImDrawCmdFlags_TextureSDF)
+
+// Size of the rectangle to pack for a glyph, including padding (this is based on stbtt_PackFontRangesGatherRects)
+static void ImFontAtlasBuildCalcGlyphRectSize(ImFontAtlas* atlas, const ImFontConfig& cfg, const stbtt_fontinfo* font_info, float scale, int glyph_index_in_font, stbrp_rect* r)
+{
+    int x0, y0, x1, y1;
+    const int padding = atlas->TexGlyphPadding;
+    if (cfg.SignedDistanceField)
+    {
+        // Same box as stbtt_GetGlyphSDF(): no oversampling, extended by the distance range on each side. Empty glyphs have no bitmap.
+        stbtt_GetGlyphBitmapBoxSubpixel(font_info, glyph_index_in_font, scale, scale, 0.0f, 0.0f, &x0, &y0, &x1, &y1);
+        const int sdf_padding = (x0 == x1 || y0 == y1) ? 0 : cfg.SDFPadding;
+        r->w = (stbrp_coord)(x1 - x0 + sdf_padding * 2 + padding);
+        r->h = (stbrp_coord)(y1 - y0 + sdf_padding * 2 + padding);
+        return;
+    }
+    stbtt_GetGlyphBitmapBoxSubpixel(font_info, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+    r->w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
+    r->h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+}
+
+// Rasterize glyphs as signed distance fields into their packed rectangles, and fill 'packed_chars' for stbtt_GetPackedQuad().
+// This is the ImFontConfig::SignedDistanceField counterpart of stbtt_PackFontRangesRenderIntoRects(), rectangles which are not packed are skipped.
+static void ImFontAtlasBuildRenderSDFIntoRects(ImFontAtlas* atlas, unsigned char* pixels, const ImFontConfig& cfg, const stbtt_fontinfo* font_info, const int* codepoints, int count, const stbrp_rect* rects, stbtt_packedchar* packed_chars)
+{
+    const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(font_info, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(font_info, -cfg.SizePixels);
+    const float pixel_dist_scale = (float)IM_FONT_SDF_ON_EDGE_VALUE / cfg.SDFPadding;
+    for (int glyph_i = 0; glyph_i < count; glyph_i++)
+    {
+        const stbrp_rect& r = rects[glyph_i];
+        if (!r.was_packed)
+            continue;
+        const int glyph_index_in_font = stbtt_FindGlyphIndex(font_info, codepoints[glyph_i]);
+        int advance, lsb;
+        stbtt_GetGlyphHMetrics(font_info, glyph_index_in_font, &advance, &lsb);
+
+        stbtt_packedchar& pc = packed_chars[glyph_i];
+        memset(&pc, 0, sizeof(pc));
+        pc.xadvance = scale * advance;
+        pc.x0 = pc.x1 = (unsigned short)r.x;
+        pc.y0 = pc.y1 = (unsigned short)r.y;
+
+        int w = 0, h = 0, x_off = 0, y_off = 0;
+        unsigned char* sdf = stbtt_GetGlyphSDF(font_info, scale, glyph_index_in_font, cfg.SDFPadding, IM_FONT_SDF_ON_EDGE_VALUE, pixel_dist_scale, &w, &h, &x_off, &y_off);
+        if (sdf == NULL)
+            continue;
+        IM_ASSERT(w + atlas->TexGlyphPadding <= r.w && h + atlas->TexGlyphPadding <= r.h);
+        for (int y = 0; y < h; y++)
+            memcpy(pixels + r.x + (r.y + y) * atlas->TexWidth, sdf + y * w, (size_t)w);
+        stbtt_FreeSDF(sdf, font_info->userdata);
+
+        pc.x1 = (unsigned short)(r.x + w);
+        pc.y1 = (unsigned short)(r.y + h);
+        pc.xoff = (float)x_off;
+        pc.yoff = (float)y_off;
+        pc.xoff2 = (float)(x_off + w);
+        pc.yoff2 = (float)(y_off + h);
+    }
+}
+
 static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>* out)
 {
     IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
@@ -2129,6 +2368,7 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
     // 2. For every requested codepoint, check for their presence in the font data, and handle redundancy or overlaps between source fonts to avoid unused glyphs.
     int total_glyphs_count = 0;
+    int lazy_src_count = 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
@@ -2136,6 +2376,11 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp.GlyphsSet.Create(src_tmp.GlyphsHighest + 1);
         if (dst_tmp.GlyphsSet.Storage.empty())
             dst_tmp.GlyphsSet.Create(dst_tmp.GlyphsHighest + 1);
+        if (atlas->ConfigData[src_i].LazyRasterize) // Rasterized on first use by ImFontAtlasBuildLazyGlyphs()
+        {
+            lazy_src_count++;
+            continue;
+        }
 
         for (const ImWchar* src_range = src_tmp.SrcRanges; src_range[0] && src_range[1]; src_range += 2)
             for (unsigned int codepoint = src_range[0]; codepoint <= src_range[1]; codepoint++)
@@ -2201,17 +2446,13 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp.PackRange.h_oversample = (unsigned char)cfg.OversampleH;
         src_tmp.PackRange.v_oversample = (unsigned char)cfg.OversampleV;
 
-        // Gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
+        // Gather the sizes of all rectangles we will need to pack
         const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
-        const int padding = atlas->TexGlyphPadding;
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
         {
-            int x0, y0, x1, y1;
             const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
             IM_ASSERT(glyph_index_in_font != 0);
-            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+            ImFontAtlasBuildCalcGlyphRectSize(atlas, cfg, &src_tmp.FontInfo, scale, glyph_index_in_font, &src_tmp.Rects[glyph_i]);
             total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
         }
     }
@@ -2228,36 +2469,93 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
     // 5. Start packing
     // Pack our extra data rectangles first, so it will be on the upper-left corner of our texture (UV will have small values).
+    // With atlas->TexMaxHeight, the main texture is limited in height and glyphs which don't fit are packed into additional pages.
     const int TEX_HEIGHT_MAX = 1024 * 32;
-    stbtt_pack_context spc = {};
-    stbtt_PackBegin(&spc, NULL, atlas->TexWidth, TEX_HEIGHT_MAX, 0, atlas->TexGlyphPadding, NULL);
-    ImFontAtlasBuildPackCustomRects(atlas, spc.pack_info);
+    const int page_height_max = (atlas->TexMaxHeight > 0) ? ImMin(atlas->TexMaxHeight, TEX_HEIGHT_MAX) : TEX_HEIGHT_MAX;
+    ImVector<ImFontAtlasPagePacker*> page_packers;
+    page_packers.push_back(IM_NEW(ImFontAtlasPagePacker)(atlas->TexWidth, page_height_max, atlas->TexGlyphPadding));
+    ImFontAtlasBuildPackCustomRects(atlas, &page_packers[0]->Context);
 
     // 6. Pack each source font. No rendering yet, we are working with rectangles in an infinitely tall texture at this point.
+    ImVector<unsigned char> buf_rects_page; // Texture page of each packed rectangle in buf_rects[], 0xFF if not packed
+    buf_rects_page.resize(buf_rects.Size, 0xFF);
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
         if (src_tmp.GlyphsCount == 0)
             continue;
 
-        stbrp_pack_rects((stbrp_context*)spc.pack_info, src_tmp.Rects, src_tmp.GlyphsCount);
+        if (atlas->TexMaxHeight > 0)
+            ImFontAtlasBuildPackRectsByChunks(&page_packers[0]->Context, src_tmp.Rects, src_tmp.GlyphsCount);
+        else
+            stbrp_pack_rects(&page_packers[0]->Context, src_tmp.Rects, src_tmp.GlyphsCount);
 
         // Extend texture height and mark missing glyphs as non-packed so we won't render them.
         // FIXME: We are not handling packing failure here (would happen if we got off TEX_HEIGHT_MAX or if a single if larger than TexWidth?)
+        const int rects_offset = (int)(src_tmp.Rects - buf_rects.Data);
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
             if (src_tmp.Rects[glyph_i].was_packed)
+            {
                 atlas->TexHeight = ImMax(atlas->TexHeight, src_tmp.Rects[glyph_i].y + src_tmp.Rects[glyph_i].h);
+                buf_rects_page[rects_offset + glyph_i] = 0;
+            }
+    }
+
+    // Pack glyphs which didn't fit in the main texture into additional pages.
+    // We stop when a fresh page can't fit any of the remaining glyphs (larger than a page) or when running out of pages.
+    if (atlas->TexMaxHeight > 0)
+    {
+        ImVector<stbrp_rect> pending_rects;
+        for (int rect_n = 0; rect_n < buf_rects.Size; rect_n++)
+            if (buf_rects_page[rect_n] == 0xFF)
+            {
+                pending_rects.push_back(buf_rects[rect_n]);
+                pending_rects.back().id = rect_n;
+            }
+        while (pending_rects.Size > 0 && page_packers.Size < IM_FONT_ATLAS_PAGES_MAX)
+        {
+            ImFontAtlasPagePacker* packer = IM_NEW(ImFontAtlasPagePacker)(atlas->TexWidth, page_height_max, atlas->TexGlyphPadding);
+            ImFontAtlasBuildPackRectsByChunks(&packer->Context, pending_rects.Data, pending_rects.Size);
+            int pending_count = 0;
+            for (int n = 0; n < pending_rects.Size; n++)
+            {
+                const stbrp_rect& r = pending_rects[n];
+                if (!r.was_packed)
+                {
+                    pending_rects[pending_count++] = r;
+                    continue;
+                }
+                buf_rects[r.id].x = r.x;
+                buf_rects[r.id].y = r.y;
+                buf_rects[r.id].was_packed = 1;
+                buf_rects_page[r.id] = (unsigned char)page_packers.Size;
+            }
+            if (pending_count == pending_rects.Size)
+            {
+                IM_DELETE(packer);
+                break;
+            }
+            page_packers.push_back(packer);
+            pending_rects.resize(pending_count);
+        }
+        if (page_packers.Size > 1)
+            atlas->TexHeight = page_height_max;
     }
 
     // 7. Allocate texture
+    // With lazy sources we reserve at least a square texture: glyphs rasterized later are packed into the remaining space.
+    if (lazy_src_count > 0)
+        atlas->TexHeight = ImMax(atlas->TexHeight, atlas->TexWidth);
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
+    if (atlas->TexMaxHeight > 0)
+        atlas->TexHeight = ImMin(atlas->TexHeight, page_height_max);
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
     atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
     memset(atlas->TexPixelsAlpha8, 0, atlas->TexWidth * atlas->TexHeight);
-    spc.pixels = atlas->TexPixelsAlpha8;
-    spc.height = atlas->TexHeight;
+    for (int page_n = 1; page_n < page_packers.Size; page_n++)
+        ImFontAtlasBuildAddTexPage(atlas);
 
-    // 8. Render/rasterize font characters into the texture
+    // 8. Render/rasterize font characters into the texture(s)
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontConfig& cfg = atlas->ConfigData[src_i];
@@ -2265,36 +2563,69 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         if (src_tmp.GlyphsCount == 0)
             continue;
 
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
+        unsigned char multiply_table[256];
+        if (cfg.RasterizerMultiply != 1.0f && !cfg.SignedDistanceField)
+            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
 
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
+        // One pass per page: stbtt_PackFontRangesRenderIntoRects() skips rectangles which are not marked as packed.
+        const int rects_offset = (int)(src_tmp.Rects - buf_rects.Data);
+        for (int page_n = 0; page_n < page_packers.Size; page_n++)
         {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
+                src_tmp.Rects[glyph_i].was_packed = (buf_rects_page[rects_offset + glyph_i] == page_n);
+
+            stbtt_pack_context spc;
+            ImFontAtlasBuildInitRenderContext(atlas, page_n, &spc);
+            if (cfg.SignedDistanceField)
+                ImFontAtlasBuildRenderSDFIntoRects(atlas, spc.pixels, cfg, &src_tmp.FontInfo, src_tmp.GlyphsList.Data, src_tmp.GlyphsCount, src_tmp.Rects, src_tmp.PackedChars);
+            else
+                stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
+
+            // Apply multiply operator
+            if (cfg.RasterizerMultiply != 1.0f && !cfg.SignedDistanceField)
+            {
+                stbrp_rect* r = &src_tmp.Rects[0];
+                for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
+                    if (r->was_packed)
+                        ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, spc.pixels, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+            }
         }
         src_tmp.Rects = NULL;
     }
 
-    // End packing
-    stbtt_PackEnd(&spc);
+    // End packing, or keep the packer of the last page alive so lazy sources can pack new glyphs into the remaining space
+    if (lazy_src_count > 0)
+    {
+        ImFontAtlasLazyBuildData* lazy_data = IM_NEW(ImFontAtlasLazyBuildData)();
+        lazy_data->Packer = page_packers.back();
+        lazy_data->Packer->Context.height = atlas->TexHeight - atlas->TexGlyphPadding;
+        lazy_data->PackerPage = page_packers.Size - 1;
+        page_packers.pop_back();
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+            if (atlas->ConfigData[src_i].LazyRasterize)
+            {
+                ImFontLazySrcData lazy_src;
+                lazy_src.FontInfo = src_tmp_array[src_i].FontInfo;
+                lazy_src.ConfigIndex = src_i;
+                lazy_data->Sources.push_back(lazy_src);
+            }
+        atlas->LazyBuildData = lazy_data;
+    }
+    for (int page_n = 0; page_n < page_packers.Size; page_n++)
+        IM_DELETE(page_packers[page_n]);
+    page_packers.clear();
     buf_rects.clear();
 
     // 9. Setup ImFont and glyphs for runtime
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
         // When merging fonts with MergeMode=true:
         // - We can have multiple input fonts writing into a same destination font.
         // - dst_font->ConfigData is != from cfg which is our source configuration.
+        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
         ImFontConfig& cfg = atlas->ConfigData[src_i];
+        if (src_tmp.GlyphsCount == 0 && !cfg.LazyRasterize)
+            continue;
         ImFont* dst_font = cfg.DstFont;
 
         const float font_scale = stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels);
@@ -2316,9 +2647,22 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             float unused_x = 0.0f, unused_y = 0.0f;
             stbtt_GetPackedQuad(src_tmp.PackedChars, atlas->TexWidth, atlas->TexHeight, glyph_i, &unused_x, &unused_y, &q, 0);
             dst_font->AddGlyph(&cfg, (ImWchar)codepoint, q.x0 + font_off_x, q.y0 + font_off_y, q.x1 + font_off_x, q.y1 + font_off_y, q.s0, q.t0, q.s1, q.t1, pc.xadvance);
+            const unsigned char page = buf_rects_page[(int)(src_tmp.PackedChars - buf_packedchars.Data) + glyph_i];
+            if (page != 0xFF)
+                dst_font->Glyphs.back().Page = page;
         }
     }
 
+    // Allow FindOrQueueGlyph() to queue missing codepoints of fonts with lazy sources
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        if (atlas->ConfigData[src_i].LazyRasterize)
+        {
+            ImFont* dst_font = atlas->ConfigData[src_i].DstFont;
+            const int words_count = (src_tmp_array[src_i].GlyphsHighest + 32) >> 5;
+            if (dst_font->LazyGlyphsRequested.Size < words_count)
+                dst_font->LazyGlyphsRequested.resize(words_count, 0);
+        }
+
     // Cleanup temporary (ImVector doesn't honor destructor)
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
         src_tmp_array[src_i].~ImFontBuildSrcData();
@@ -2338,6 +2682,7 @@ void ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* f
         font->ContainerAtlas = atlas;
         font->Ascent = ascent;
         font->Descent = descent;
+        font->UseSDF = font_config->SignedDistanceField;
     }
     font->ConfigDataCount++;
 }
@@ -2501,6 +2846,207 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
     }
 }
 
+static void ImFontAtlasBuildClearLazyData(ImFontAtlas* atlas)
+{
+    if (ImFontAtlasLazyBuildData* lazy_data = (ImFontAtlasLazyBuildData*)atlas->LazyBuildData)
+    {
+        IM_DELETE(lazy_data->Packer);
+        IM_DELETE(lazy_data);
+        atlas->LazyBuildData = NULL;
+    }
+
+    // Without packing state no more glyphs can be added: stop queuing requests, FindOrQueueGlyph() will return the fallback glyph.
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+    {
+        atlas->Fonts[font_n]->LazyGlyphsRequested.clear();
+        atlas->Fonts[font_n]->LazyGlyphsQueue.clear();
+    }
+}
+
+static bool ImFontAtlasBuildRangesContain(const ImWchar* ranges, unsigned int c)
+{
+    for (; ranges[0]; ranges += 2)
+        if (c >= ranges[0] && c <= ranges[1])
+            return true;
+    return false;
+}
+
+// Register glyphs added since 'glyphs_begin' without rebuilding the whole lookup table
+static void ImFontBuildLookupTableIncremental(ImFont* font, int glyphs_begin)
+{
+    IM_ASSERT(font->Glyphs.Size < 0xFFFF); // -1 is reserved
+    for (int i = glyphs_begin; i < font->Glyphs.Size; i++)
+    {
+        const int codepoint = (int)font->Glyphs[i].Codepoint;
+        if (codepoint >= font->IndexLookup.Size)
+        {
+            const int old_size = font->IndexAdvanceX.Size;
+            font->GrowIndex(codepoint + 1);
+            for (int n = old_size; n < font->IndexAdvanceX.Size; n++)
+                font->IndexAdvanceX[n] = font->FallbackAdvanceX;
+        }
+        font->IndexAdvanceX[codepoint] = font->Glyphs[i].AdvanceX;
+        font->IndexLookup[codepoint] = (ImWchar)i;
+        const int page_n = codepoint / 4096;
+        font->Used4kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
+    }
+    font->DirtyLookupTables = false;
+
+    // Glyphs[] may have been reallocated. If the fallback glyph was just added, update advance of missing codepoints.
+    const float old_fallback_advance_x = font->FallbackAdvanceX;
+    font->FallbackGlyph = font->FindGlyphNoFallback(font->FallbackChar);
+    font->FallbackAdvanceX = font->FallbackGlyph ? font->FallbackGlyph->AdvanceX : 0.0f;
+    if (font->FallbackAdvanceX != old_fallback_advance_x)
+        for (int n = 0; n < font->IndexLookup.Size; n++)
+            if (font->IndexLookup[n] == (ImWchar)-1)
+                font->IndexAdvanceX[n] = font->FallbackAdvanceX;
+}
+
+// Pack, render and register glyphs of a lazy source into the current lazy page.
+// Glyphs which were packed are removed from 'codepoints', return their number.
+static int ImFontAtlasBuildLazyGlyphsIntoPage(ImFontAtlas* atlas, ImFontAtlasLazyBuildData* lazy_data, ImFontLazySrcData& src, ImFont* font, ImVector<int>* codepoints)
+{
+    ImFontConfig& cfg = atlas->ConfigData[src.ConfigIndex];
+    const int page = lazy_data->PackerPage;
+
+    // Gather sizes and pack (same as steps 4 and 6 of ImFontAtlasBuildWithStbTruetype)
+    ImVector<stbrp_rect> rects;
+    ImVector<stbtt_packedchar> packed_chars;
+    rects.resize(codepoints->Size);
+    packed_chars.resize(codepoints->Size);
+    memset(rects.Data, 0, (size_t)rects.size_in_bytes());
+    memset(packed_chars.Data, 0, (size_t)packed_chars.size_in_bytes());
+    const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src.FontInfo, -cfg.SizePixels);
+    for (int glyph_i = 0; glyph_i < codepoints->Size; glyph_i++)
+        ImFontAtlasBuildCalcGlyphRectSize(atlas, cfg, &src.FontInfo, scale, stbtt_FindGlyphIndex(&src.FontInfo, (*codepoints)[glyph_i]), &rects[glyph_i]);
+    stbrp_pack_rects(&lazy_data->Packer->Context, rects.Data, rects.Size);
+
+    // Render into texture (rects which were not packed are skipped)
+    stbtt_pack_range pack_range;
+    memset(&pack_range, 0, sizeof(pack_range));
+    pack_range.font_size = cfg.SizePixels;
+    pack_range.array_of_unicode_codepoints = codepoints->Data;
+    pack_range.num_chars = codepoints->Size;
+    pack_range.chardata_for_range = packed_chars.Data;
+    pack_range.h_oversample = (unsigned char)cfg.OversampleH;
+    pack_range.v_oversample = (unsigned char)cfg.OversampleV;
+    stbtt_pack_context spc;
+    ImFontAtlasBuildInitRenderContext(atlas, page, &spc);
+    if (cfg.SignedDistanceField)
+        ImFontAtlasBuildRenderSDFIntoRects(atlas, spc.pixels, cfg, &src.FontInfo, codepoints->Data, codepoints->Size, rects.Data, packed_chars.Data);
+    else
+        stbtt_PackFontRangesRenderIntoRects(&spc, &src.FontInfo, &pack_range, 1, rects.Data);
+
+    const bool multiply = (cfg.RasterizerMultiply != 1.0f && !cfg.SignedDistanceField);
+    unsigned char multiply_table[256];
+    if (multiply)
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+    unsigned int* pixels_rgba32 = (page == 0) ? atlas->TexPixelsRGBA32 : atlas->TexPages[page - 1].TexPixelsRGBA32;
+    for (int glyph_i = 0; glyph_i < rects.Size; glyph_i++)
+    {
+        const stbrp_rect& r = rects[glyph_i];
+        if (!r.was_packed)
+            continue;
+        if (multiply)
+            ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, spc.pixels, r.x, r.y, r.w, r.h, atlas->TexWidth * 1);
+        if (pixels_rgba32)
+            for (int y = r.y; y < r.y + r.h; y++)
+                for (int x = r.x; x < r.x + r.w; x++)
+                    pixels_rgba32[x + y * atlas->TexWidth] = IM_COL32(255, 255, 255, (unsigned int)spc.pixels[x + y * atlas->TexWidth]);
+    }
+
+    // Register glyphs (same as step 9 of ImFontAtlasBuildWithStbTruetype), keep the ones which didn't fit
+    const float font_off_x = cfg.GlyphOffset.x;
+    const float font_off_y = cfg.GlyphOffset.y + IM_ROUND(font->Ascent);
+    int packed_count = 0;
+    int pending_count = 0;
+    for (int glyph_i = 0; glyph_i < codepoints->Size; glyph_i++)
+    {
+        if (!rects[glyph_i].was_packed)
+        {
+            (*codepoints)[pending_count++] = (*codepoints)[glyph_i];
+            continue;
+        }
+        const stbtt_packedchar& pc = packed_chars[glyph_i];
+        stbtt_aligned_quad q;
+        float unused_x = 0.0f, unused_y = 0.0f;
+        stbtt_GetPackedQuad(packed_chars.Data, atlas->TexWidth, atlas->TexHeight, glyph_i, &unused_x, &unused_y, &q, 0);
+        font->AddGlyph(&cfg, (ImWchar)(*codepoints)[glyph_i], q.x0 + font_off_x, q.y0 + font_off_y, q.x1 + font_off_x, q.y1 + font_off_y, q.s0, q.t0, q.s1, q.t1, pc.xadvance);
+        font->Glyphs.back().Page = (unsigned int)page;
+        packed_count++;
+    }
+    codepoints->resize(pending_count);
+    return packed_count;
+}
+
+// Rasterize glyphs queued by ImFont::FindOrQueueGlyph() for fonts using ImFontConfig::LazyRasterize sources. Called by NewFrame().
+// New glyphs are packed into the space left by Build(), then into new texture pages, and atlas->TexDirty is set so the renderer can upload them again.
+// Glyphs on a new page are only rendered once the renderer has set its texture with SetTexPageID().
+void ImFontAtlasBuildLazyGlyphs(ImFontAtlas* atlas)
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
+    ImFontAtlasLazyBuildData* lazy_data = (ImFontAtlasLazyBuildData*)atlas->LazyBuildData;
+    if (lazy_data == NULL || atlas->TexPixelsAlpha8 == NULL)
+        return;
+    IM_ASSERT(!atlas->Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+
+    ImVector<int> codepoints;
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+    {
+        ImFont* font = atlas->Fonts[font_n];
+        if (font->LazyGlyphsQueue.empty())
+            continue;
+
+        const int glyphs_begin = font->Glyphs.Size;
+        for (int lazy_src_n = 0; lazy_src_n < lazy_data->Sources.Size; lazy_src_n++)
+        {
+            ImFontLazySrcData& src = lazy_data->Sources[lazy_src_n];
+            ImFontConfig& cfg = atlas->ConfigData[src.ConfigIndex];
+            if (cfg.DstFont != font)
+                continue;
+
+            // Claim queued codepoints provided by this source (earlier sources take precedence, as in Build())
+            const ImWchar* src_ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
+            codepoints.resize(0);
+            for (int queue_n = 0; queue_n < font->LazyGlyphsQueue.Size; queue_n++)
+            {
+                const ImWchar c = font->LazyGlyphsQueue[queue_n];
+                if (c == 0 || !ImFontAtlasBuildRangesContain(src_ranges, c) || !stbtt_FindGlyphIndex(&src.FontInfo, c))
+                    continue;
+                codepoints.push_back((int)c);
+                font->LazyGlyphsQueue[queue_n] = 0;
+            }
+            if (codepoints.empty())
+                continue;
+
+            // Pack into the current page, start a new page for glyphs which don't fit.
+            // Give up when a fresh page can't fit any of them (larger than a page) or when running out of pages: they keep using the fallback glyph.
+            bool fresh_page = false;
+            while (!codepoints.empty())
+            {
+                if (ImFontAtlasBuildLazyGlyphsIntoPage(atlas, lazy_data, src, font, &codepoints) > 0)
+                {
+                    fresh_page = false;
+                    continue;
+                }
+                if (fresh_page || atlas->GetTexPagesCount() >= IM_FONT_ATLAS_PAGES_MAX)
+                    break;
+                IM_DELETE(lazy_data->Packer);
+                lazy_data->PackerPage = ImFontAtlasBuildAddTexPage(atlas);
+                lazy_data->Packer = IM_NEW(ImFontAtlasPagePacker)(atlas->TexWidth, atlas->TexHeight, atlas->TexGlyphPadding);
+                fresh_page = true;
+            }
+        }
+        font->LazyGlyphsQueue.resize(0);
+
+        if (font->Glyphs.Size > glyphs_begin)
+        {
+            ImFontBuildLookupTableIncremental(font, glyphs_begin);
+            atlas->TexDirty = true;
+        }
+    }
+}
+
 // Retrieve list of range (2 int per range, values are inclusive)
 const ImWchar*   ImFontAtlas::GetGlyphRangesDefault()
 {
@@ -2758,6 +3304,280 @@ void ImFontGlyphRangesBuilder::BuildRanges(ImVector<ImWchar>* out_ranges)
     out_ranges->push_back(0);
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImFontAtlas build cache
+//-----------------------------------------------------------------------------
+// The cache file stores the output of Build() so the next run can skip TTF parsing, rect packing and rasterization.
+// Layout: header, TexUvWhitePixel, TexUvLines[], packed X/Y of each custom rect, then for each font: metrics + ImFontGlyph[], then the Alpha8 texture.
+// The key covers the font data, ImFontConfig fields, glyph ranges, custom rects and atlas settings. A cache with a different key is ignored.
+// Data is written in native layout and endianness: the file is only meant to be reused by the same build of the same application.
+//-----------------------------------------------------------------------------
+
+#define IM_FONT_ATLAS_CACHE_MAGIC       0x43464D49  // "IMFC"
+#define IM_FONT_ATLAS_CACHE_VERSION     2
+
+struct ImFontAtlasCacheHeader
+{
+    ImU32   Magic;
+    ImU32   FormatVersion;
+    ImU32   ImGuiVersion;
+    ImU32   Key;
+    int     TexWidth, TexHeight;
+    int     TexPagesCount;
+    int     FontsCount;
+    int     CustomRectsCount;
+};
+
+struct ImFontAtlasCacheFont
+{
+    float   FontSize;
+    float   Ascent, Descent;
+    int     MetricsTotalSurface;
+    int     GlyphsCount;
+    ImU32   FallbackChar;
+    ImU32   EllipsisChar;
+};
+
+template<typename T>
+static inline ImU32 ImFontAtlasCacheHash(const T& v, ImU32 seed) { return ImHashData(&v, sizeof(T), seed); }
+
+ImU32 ImFontAtlasBuildCalcCacheKey(ImFontAtlas* atlas)
+{
+    ImU32 key = ImFontAtlasCacheHash((int)sizeof(ImWchar), 0);
+    key = ImFontAtlasCacheHash(atlas->Flags, key);
+    key = ImFontAtlasCacheHash(atlas->TexDesiredWidth, key);
+    key = ImFontAtlasCacheHash(atlas->TexGlyphPadding, key);
+    key = ImFontAtlasCacheHash(atlas->TexMaxHeight, key);
+    for (int cfg_n = 0; cfg_n < atlas->ConfigData.Size; cfg_n++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[cfg_n];
+        IM_ASSERT(cfg.FontData != NULL && "Cannot compute the cache key after ClearInputData()!");
+        const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
+        int ranges_count = 0;
+        while (ranges[ranges_count] != 0)
+            ranges_count++;
+        key = ImHashData(cfg.FontData, (size_t)cfg.FontDataSize, key);
+        key = ImHashData(ranges, (size_t)ranges_count * sizeof(ImWchar), key);
+        key = ImFontAtlasCacheHash((int)(atlas->Fonts.find(cfg.DstFont) - atlas->Fonts.begin()), key);
+        key = ImFontAtlasCacheHash(cfg.FontNo, key);
+        key = ImFontAtlasCacheHash(cfg.SizePixels, key);
+        key = ImFontAtlasCacheHash(cfg.OversampleH, key);
+        key = ImFontAtlasCacheHash(cfg.OversampleV, key);
+        key = ImFontAtlasCacheHash(cfg.PixelSnapH, key);
+        key = ImFontAtlasCacheHash(cfg.GlyphExtraSpacing, key);
+        key = ImFontAtlasCacheHash(cfg.GlyphOffset, key);
+        key = ImFontAtlasCacheHash(cfg.GlyphMinAdvanceX, key);
+        key = ImFontAtlasCacheHash(cfg.GlyphMaxAdvanceX, key);
+        key = ImFontAtlasCacheHash(cfg.MergeMode, key);
+        key = ImFontAtlasCacheHash(cfg.RasterizerFlags, key);
+        key = ImFontAtlasCacheHash(cfg.RasterizerMultiply, key);
+        key = ImFontAtlasCacheHash(cfg.EllipsisChar, key);
+        key = ImFontAtlasCacheHash(cfg.SignedDistanceField, key);
+        key = ImFontAtlasCacheHash(cfg.SDFPadding, key);
+        key = ImFontAtlasCacheHash(cfg.LazyRasterize, key);
+    }
+    for (int rect_n = 0; rect_n < atlas->CustomRects.Size; rect_n++)
+    {
+        const ImFontAtlasCustomRect& r = atlas->CustomRects[rect_n];
+        key = ImFontAtlasCacheHash(r.Width, key);
+        key = ImFontAtlasCacheHash(r.Height, key);
+        key = ImFontAtlasCacheHash(r.GlyphID, key);
+        key = ImFontAtlasCacheHash(r.GlyphAdvanceX, key);
+        key = ImFontAtlasCacheHash(r.GlyphOffset, key);
+        key = ImFontAtlasCacheHash((int)(r.Font ? atlas->Fonts.find(r.Font) - atlas->Fonts.begin() : -1), key);
+    }
+    return key;
+}
+
+// Packing state of lazy sources can't be restored from a cache file
+static bool ImFontAtlasBuildHasLazySources(const ImFontAtlas* atlas)
+{
+    for (int cfg_n = 0; cfg_n < atlas->ConfigData.Size; cfg_n++)
+        if (atlas->ConfigData[cfg_n].LazyRasterize)
+            return true;
+    return false;
+}
+
+bool    ImFontAtlas::BuildWithCache(const char* filename)
+{
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    if (ConfigData.empty())
+        AddFontDefault();
+    if (LoadBuildCache(filename))
+        return true;
+    if (!Build())
+        return false;
+    SaveBuildCache(filename);
+    return true;
+}
+
+// Nothing is modified unless the whole file was read and validated, so the atlas can still be built normally on failure.
+bool    ImFontAtlas::LoadBuildCache(const char* filename)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    if (ImFontAtlasBuildHasLazySources(this))
+        return false;
+    ImFileHandle f = ImFileOpen(filename, "rb");
+    if (!f)
+        return false;
+
+    // Register default custom rects before hashing them, as Build() would do
+    ImFontAtlasBuildInit(this);
+
+    ImFontAtlasCacheHeader header;
+    bool ok = ImFileRead(&header, sizeof(header), 1, f) == 1;
+    ok = ok && header.Magic == IM_FONT_ATLAS_CACHE_MAGIC && header.FormatVersion == IM_FONT_ATLAS_CACHE_VERSION && header.ImGuiVersion == IMGUI_VERSION_NUM;
+    ok = ok && header.FontsCount == Fonts.Size && header.CustomRectsCount == CustomRects.Size && header.TexWidth > 0 && header.TexHeight > 0;
+    ok = ok && header.TexPagesCount >= 1 && header.TexPagesCount <= IM_FONT_ATLAS_PAGES_MAX;
+    ok = ok && header.Key == ImFontAtlasBuildCalcCacheKey(this);
+
+    ImVec2 uv_white_pixel;
+    ImVec4 uv_lines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];
+    ImVector<unsigned short> rects_pos;
+    ImVector<ImFontAtlasCacheFont> fonts;
+    ImVector<ImFontGlyph> glyphs;
+    ImVector<unsigned char*> pages_pixels;
+    if (ok)
+    {
+        rects_pos.resize(header.CustomRectsCount * 2);
+        fonts.resize(header.FontsCount);
+        ok = ok && ImFileRead(&uv_white_pixel, sizeof(uv_white_pixel), 1, f) == 1;
+        ok = ok && ImFileRead(uv_lines, sizeof(uv_lines), 1, f) == 1;
+        ok = ok && ImFileRead(rects_pos.Data, sizeof(unsigned short), (ImU64)rects_pos.Size, f) == (ImU64)rects_pos.Size;
+        for (int font_n = 0; ok && font_n < fonts.Size; font_n++)
+        {
+            ok = ImFileRead(&fonts[font_n], sizeof(ImFontAtlasCacheFont), 1, f) == 1 && fonts[font_n].GlyphsCount >= 0 && fonts[font_n].GlyphsCount < 0xFFFF;
+            if (!ok)
+                break;
+            const int glyphs_offset = glyphs.Size;
+            glyphs.resize(glyphs.Size + fonts[font_n].GlyphsCount);
+            ok = ImFileRead(glyphs.Data + glyphs_offset, sizeof(ImFontGlyph), (ImU64)fonts[font_n].GlyphsCount, f) == (ImU64)fonts[font_n].GlyphsCount;
+        }
+    }
+    for (int page_n = 0; ok && page_n < header.TexPagesCount; page_n++)
+    {
+        // Read textures straight into their final storage
+        const ImU64 pixels_count = (ImU64)header.TexWidth * (ImU64)header.TexHeight;
+        pages_pixels.push_back((unsigned char*)IM_ALLOC((size_t)pixels_count));
+        ok = ImFileRead(pages_pixels.back(), 1, pixels_count, f) == pixels_count;
+    }
+    ImFileClose(f);
+    if (!ok)
+    {
+        for (int page_n = 0; page_n < pages_pixels.Size; page_n++)
+            IM_FREE(pages_pixels[page_n]);
+        return false;
+    }
+
+    // Commit to atlas
+    ClearTexData();
+    TexID = (ImTextureID)NULL;
+    TexPixelsAlpha8 = pages_pixels[0];
+    for (int page_n = 1; page_n < pages_pixels.Size; page_n++)
+    {
+        ImFontAtlasTexPage page;
+        page.TexPixelsAlpha8 = pages_pixels[page_n];
+        TexPages.push_back(page);
+    }
+    TexWidth = header.TexWidth;
+    TexHeight = header.TexHeight;
+    TexUvScale = ImVec2(1.0f / TexWidth, 1.0f / TexHeight);
+    TexUvWhitePixel = uv_white_pixel;
+    memcpy(TexUvLines, uv_lines, sizeof(TexUvLines));
+    for (int rect_n = 0; rect_n < CustomRects.Size; rect_n++)
+    {
+        CustomRects[rect_n].X = rects_pos[rect_n * 2 + 0];
+        CustomRects[rect_n].Y = rects_pos[rect_n * 2 + 1];
+    }
+
+    const ImFontGlyph* src_glyphs = glyphs.Data;
+    for (int font_n = 0; font_n < Fonts.Size; font_n++)
+    {
+        const ImFontAtlasCacheFont& src = fonts[font_n];
+        ImFont* font = Fonts[font_n];
+        font->ClearOutputData();
+        font->FontSize = src.FontSize;
+        font->Ascent = src.Ascent;
+        font->Descent = src.Descent;
+        font->MetricsTotalSurface = src.MetricsTotalSurface;
+        font->FallbackChar = (ImWchar)src.FallbackChar;
+        font->EllipsisChar = (ImWchar)src.EllipsisChar;
+        font->ContainerAtlas = this;
+        font->ConfigData = NULL;
+        font->ConfigDataCount = 0;
+        for (int cfg_n = 0; cfg_n < ConfigData.Size; cfg_n++)
+            if (ConfigData[cfg_n].DstFont == font)
+            {
+                if (font->ConfigData == NULL)
+                    font->ConfigData = &ConfigData[cfg_n];
+                font->ConfigDataCount++;
+            }
+        font->UseSDF = font->ConfigData && font->ConfigData->SignedDistanceField;
+        font->Glyphs.resize(src.GlyphsCount);
+        if (src.GlyphsCount > 0)
+            memcpy(font->Glyphs.Data, src_glyphs, (size_t)src.GlyphsCount * sizeof(ImFontGlyph));
+        src_glyphs += src.GlyphsCount;
+        font->BuildLookupTable();
+    }
+    return true;
+}
+
+bool    ImFontAtlas::SaveBuildCache(const char* filename)
+{
+    IM_ASSERT(TexPixelsAlpha8 != NULL && TexWidth > 0 && TexHeight > 0 && "Atlas needs to be built before saving it to a cache file.");
+    if (TexPixelsAlpha8 == NULL || ImFontAtlasBuildHasLazySources(this))
+        return false;
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+
+    ImFontAtlasCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    header.Magic = IM_FONT_ATLAS_CACHE_MAGIC;
+    header.FormatVersion = IM_FONT_ATLAS_CACHE_VERSION;
+    header.ImGuiVersion = IMGUI_VERSION_NUM;
+    header.Key = ImFontAtlasBuildCalcCacheKey(this);
+    header.TexWidth = TexWidth;
+    header.TexHeight = TexHeight;
+    header.TexPagesCount = GetTexPagesCount();
+    header.FontsCount = Fonts.Size;
+    header.CustomRectsCount = CustomRects.Size;
+
+    ImVector<unsigned short> rects_pos;
+    rects_pos.resize(CustomRects.Size * 2);
+    for (int rect_n = 0; rect_n < CustomRects.Size; rect_n++)
+    {
+        rects_pos[rect_n * 2 + 0] = CustomRects[rect_n].X;
+        rects_pos[rect_n * 2 + 1] = CustomRects[rect_n].Y;
+    }
+
+    bool ok = ImFileWrite(&header, sizeof(header), 1, f) == 1;
+    ok = ok && ImFileWrite(&TexUvWhitePixel, sizeof(TexUvWhitePixel), 1, f) == 1;
+    ok = ok && ImFileWrite(TexUvLines, sizeof(TexUvLines), 1, f) == 1;
+    ok = ok && ImFileWrite(rects_pos.Data, sizeof(unsigned short), (ImU64)rects_pos.Size, f) == (ImU64)rects_pos.Size;
+    for (int font_n = 0; ok && font_n < Fonts.Size; font_n++)
+    {
+        const ImFont* font = Fonts[font_n];
+        ImFontAtlasCacheFont dst;
+        memset(&dst, 0, sizeof(dst));
+        dst.FontSize = font->FontSize;
+        dst.Ascent = font->Ascent;
+        dst.Descent = font->Descent;
+        dst.MetricsTotalSurface = font->MetricsTotalSurface;
+        dst.GlyphsCount = font->Glyphs.Size;
+        dst.FallbackChar = (ImU32)font->FallbackChar;
+        dst.EllipsisChar = (ImU32)font->EllipsisChar;
+        ok = ImFileWrite(&dst, sizeof(dst), 1, f) == 1;
+        ok = ok && ImFileWrite(font->Glyphs.Data, sizeof(ImFontGlyph), (ImU64)font->Glyphs.Size, f) == (ImU64)font->Glyphs.Size;
+    }
+    const ImU64 pixels_count = (ImU64)TexWidth * (ImU64)TexHeight;
+    for (int page_n = 0; ok && page_n < GetTexPagesCount(); page_n++)
+        ok = ImFileWrite(ImFontAtlasBuildGetTexPagePixels(this, page_n), 1, pixels_count, f) == pixels_count;
+    ok = ImFileClose(f) && ok;
+    return ok;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImFont
 //-----------------------------------------------------------------------------
@@ -2773,6 +3593,7 @@ ImFont::ImFont()
     ConfigData = NULL;
     ConfigDataCount = 0;
     DirtyLookupTables = false;
+    UseSDF = false;
     Scale = 1.0f;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
@@ -2794,12 +3615,16 @@ void    ImFont::ClearOutputData()
     FallbackGlyph = NULL;
     ContainerAtlas = NULL;
     DirtyLookupTables = true;
+    UseSDF = false;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
+    LazyGlyphsRequested.clear();
+    LazyGlyphsQueue.clear();
 }
 
 void ImFont::BuildLookupTable()
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     int max_codepoint = 0;
     for (int i = 0; i != Glyphs.Size; i++)
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
@@ -2875,6 +3700,7 @@ void ImFont::SetFallbackChar(ImWchar c)
 
 void ImFont::GrowIndex(int new_size)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     IM_ASSERT(IndexAdvanceX.Size == IndexLookup.Size);
     if (new_size <= IndexLookup.Size)
         return;
@@ -2887,6 +3713,7 @@ void ImFont::GrowIndex(int new_size)
 // 'cfg' is not necessarily == 'this->ConfigData' because multiple source fonts+configs can be used to build one target font.
 void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_FontAtlas);
     if (cfg != NULL)
     {
         // Clamp & recenter if needed
@@ -2910,6 +3737,7 @@ void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, floa
     Glyphs.resize(Glyphs.Size + 1);
     ImFontGlyph& glyph = Glyphs.back();
     glyph.Codepoint = (unsigned int)codepoint;
+    glyph.Page = 0;
     glyph.Visible = (x0 != x1) && (y0 != y1);
     glyph.X0 = x0;
     glyph.Y0 = y0;
@@ -2963,6 +3791,19 @@ const ImFontGlyph* ImFont::FindGlyphNoFallback(ImWchar c) const
     return &Glyphs.Data[i];
 }
 
+// Queue a missing codepoint once, ImFontAtlasBuildLazyGlyphs() will rasterize it if a lazy source provides it.
+const ImFontGlyph* ImFont::FindOrQueueGlyph(ImWchar c)
+{
+    if (const ImFontGlyph* glyph = FindGlyphNoFallback(c))
+        return glyph;
+    if (c != 0 && (int)(c >> 5) < LazyGlyphsRequested.Size && !(LazyGlyphsRequested.Data[c >> 5] & ((ImU32)1 << (c & 31))))
+    {
+        LazyGlyphsRequested.Data[c >> 5] |= (ImU32)1 << (c & 31);
+        LazyGlyphsQueue.push_back(c);
+    }
+    return FallbackGlyph;
+}
+
 const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const char* text_end, float wrap_width) const
 {
     // Simple word-wrapping for English, not full-featured. Please submit failing cases!
@@ -3161,15 +4002,29 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     const ImFontGlyph* glyph = FindGlyph(c);
     if (!glyph || !glyph->Visible)
         return;
+    ImTextureID page_texture_id = (glyph->Page != 0) ? ContainerAtlas->GetTexPageID(glyph->Page) : (ImTextureID)NULL;
+    if (glyph->Page != 0 && page_texture_id == (ImTextureID)NULL)
+        return;
     float scale = (size >= 0.0f) ? (size / FontSize) : 1.0f;
     pos.x = IM_FLOOR(pos.x);
     pos.y = IM_FLOOR(pos.y);
+    const ImDrawCmdFlags backup_cmd_flags = draw_list->GetCmdFlags();
+    if (UseSDF)
+        draw_list->SetCmdFlags(backup_cmd_flags | ImDrawCmdFlags_TextureSDF);
+    if (glyph->Page != 0)
+        draw_list->PushTextureID(page_texture_id);
     draw_list->PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(pos.x + glyph->X0 * scale, pos.y + glyph->Y0 * scale), ImVec2(pos.x + glyph->X1 * scale, pos.y + glyph->Y1 * scale), ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
+    if (glyph->Page != 0)
+        draw_list->PopTextureID();
+    if (UseSDF)
+        draw_list->SetCmdFlags(backup_cmd_flags);
 }
 
-void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip) const
+// Missing glyphs are queued in 'queue_font' (== font) when not NULL, see ImFont::FindOrQueueGlyph()
+static void ImFontRenderText(const ImFont* font, ImFont* queue_font, ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip)
 {
+    IM_ASSERT(queue_font == NULL || queue_font == font);
     if (!text_end)
         text_end = text_begin + strlen(text_begin); // ImGui:: functions generally already provides a valid text_end, so this is merely to handle direct calls.
 
@@ -3181,8 +4036,8 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     if (y > clip_rect.w)
         return;
 
-    const float scale = size / FontSize;
-    const float line_height = FontSize * scale;
+    const float scale = size / font->FontSize;
+    const float line_height = font->FontSize * scale;
     const bool word_wrap_enabled = (wrap_width > 0.0f);
     const char* word_wrap_eol = NULL;
 
@@ -3213,6 +4068,13 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     if (s == text_end)
         return;
 
+    // Glyphs stored in other texture pages of the atlas (see ImFontAtlas::TexMaxHeight) are collected during the same pass, then emitted with one draw command per page.
+    // Pages without a texture yet (added by ImFontAtlasBuildLazyGlyphs() during this frame) are skipped.
+    const ImDrawCmdFlags backup_cmd_flags = draw_list->GetCmdFlags();
+    if (font->UseSDF)
+        draw_list->SetCmdFlags(backup_cmd_flags | ImDrawCmdFlags_TextureSDF);
+    IM_ASSERT(draw_list->_TextPagesQuadPage.Size == 0);
+
     // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
     const int vtx_count_max = (int)(text_end - s) * 4;
     const int idx_count_max = (int)(text_end - s) * 6;
@@ -3230,7 +4092,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
             // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
             if (!word_wrap_eol)
             {
-                word_wrap_eol = CalcWordWrapPositionA(scale, s, text_end, wrap_width - (x - pos.x));
+                word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width - (x - pos.x));
                 if (word_wrap_eol == s) // Wrap_width is too small to fit anything. Force displaying 1 character to minimize the height discontinuity.
                     word_wrap_eol++;    // +1 may not be a character start point in UTF-8 but it's ok because we use s >= word_wrap_eol below
             }
@@ -3278,7 +4140,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                 continue;
         }
 
-        const ImFontGlyph* glyph = FindGlyph((ImWchar)c);
+        const ImFontGlyph* glyph = queue_font ? queue_font->FindOrQueueGlyph((ImWchar)c) : font->FindGlyph((ImWchar)c);
         if (glyph == NULL)
             continue;
 
@@ -3328,18 +4190,28 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                     }
                 }
 
-                // We are NOT calling PrimRectUV() here because non-inlined causes too much overhead in a debug builds. Inlined here:
+                // Glyphs of other pages are set aside (without indices) and emitted below
+                ImDrawVert* quad_vtx = vtx_write;
+                if (glyph->Page != 0)
+                {
+                    draw_list->_TextPagesQuadPage.push_back(glyph->Page);
+                    draw_list->_TextPagesVtx.resize(draw_list->_TextPagesVtx.Size + 4);
+                    quad_vtx = draw_list->_TextPagesVtx.Data + draw_list->_TextPagesVtx.Size - 4;
+                }
+                else
                 {
                     idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
                     idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
-                    vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
-                    vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
-                    vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
-                    vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
                     vtx_write += 4;
                     vtx_current_idx += 4;
                     idx_write += 6;
                 }
+
+                // We are NOT calling PrimRectUV() here because non-inlined causes too much overhead in a debug builds. Inlined here:
+                quad_vtx[0].pos.x = x1; quad_vtx[0].pos.y = y1; quad_vtx[0].col = col; quad_vtx[0].uv.x = u1; quad_vtx[0].uv.y = v1;
+                quad_vtx[1].pos.x = x2; quad_vtx[1].pos.y = y1; quad_vtx[1].col = col; quad_vtx[1].uv.x = u2; quad_vtx[1].uv.y = v1;
+                quad_vtx[2].pos.x = x2; quad_vtx[2].pos.y = y2; quad_vtx[2].col = col; quad_vtx[2].uv.x = u2; quad_vtx[2].uv.y = v2;
+                quad_vtx[3].pos.x = x1; quad_vtx[3].pos.y = y2; quad_vtx[3].col = col; quad_vtx[3].uv.x = u1; quad_vtx[3].uv.y = v2;
             }
         }
         x += char_width;
@@ -3352,6 +4224,55 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     draw_list->_VtxWritePtr = vtx_write;
     draw_list->_IdxWritePtr = idx_write;
     draw_list->_VtxCurrentIdx = vtx_current_idx;
+
+    // Emit the glyphs set aside, in increasing page order. Only a few pages are used by any given text.
+    const int page_quads_count = draw_list->_TextPagesQuadPage.Size;
+    for (unsigned int page = 1; page_quads_count > 0; )
+    {
+        int quads_count = 0;
+        unsigned int next_page = 0;
+        for (int quad_n = 0; quad_n < page_quads_count; quad_n++)
+        {
+            const unsigned int quad_page = draw_list->_TextPagesQuadPage.Data[quad_n];
+            if (quad_page == page)
+                quads_count++;
+            else if (quad_page > page && (next_page == 0 || quad_page < next_page))
+                next_page = quad_page;
+        }
+        ImTextureID page_texture_id = quads_count ? font->ContainerAtlas->GetTexPageID((int)page) : (ImTextureID)NULL;
+        if (page_texture_id != (ImTextureID)NULL)
+        {
+            draw_list->PushTextureID(page_texture_id);
+            draw_list->PrimReserve(quads_count * 6, quads_count * 4);
+            for (int quad_n = 0; quad_n < page_quads_count; quad_n++)
+            {
+                if (draw_list->_TextPagesQuadPage.Data[quad_n] != page)
+                    continue;
+                const ImDrawIdx idx = (ImDrawIdx)draw_list->_VtxCurrentIdx;
+                ImDrawIdx* page_idx_write = draw_list->_IdxWritePtr;
+                page_idx_write[0] = idx; page_idx_write[1] = (ImDrawIdx)(idx+1); page_idx_write[2] = (ImDrawIdx)(idx+2);
+                page_idx_write[3] = idx; page_idx_write[4] = (ImDrawIdx)(idx+2); page_idx_write[5] = (ImDrawIdx)(idx+3);
+                memcpy(draw_list->_VtxWritePtr, &draw_list->_TextPagesVtx.Data[quad_n * 4], sizeof(ImDrawVert) * 4);
+                draw_list->_VtxWritePtr += 4;
+                draw_list->_VtxCurrentIdx += 4;
+                draw_list->_IdxWritePtr += 6;
+            }
+            draw_list->PopTextureID();
+        }
+        if (next_page == 0)
+            break;
+        page = next_page;
+    }
+    draw_list->_TextPagesVtx.resize(0);
+    draw_list->_TextPagesQuadPage.resize(0);
+
+    if (font->UseSDF)
+        draw_list->SetCmdFlags(backup_cmd_flags);
+}
+
+void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip) const
+{
+    ImFontRenderText(this, NULL, draw_list, size, pos, col, clip_rect, text_begin, text_end, wrap_width, cpu_fine_clip);
 }
 
 //-----------------------------------------------------------------------------
@@ -11,6 +11,9 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: DirectX9: Render draw commands flagged ImDrawCmdFlags_TextureSDF (signed distance field fonts) with an alpha ramp around the glyph edge.
+//  2026-10-19: DirectX9: Create one texture per page of multi-page font atlases (io.Fonts->GetTexPagesCount()).
+//  2026-10-19: DirectX9: Upload font texture again when io.Fonts->TexDirty is set (glyphs added by ImFontConfig::LazyRasterize).
 //  2019-05-29: DirectX9: Added support for large mesh (64K+ vertices), enable ImGuiBackendFlags_RendererHasVtxOffset flag.
 //  2019-04-30: DirectX9: Added support for special ImDrawCallback_ResetRenderState callback to reset render state.
 //  2019-03-29: Misc: Fixed erroneous assert in ImGui_ImplDX9_InvalidateDeviceObjects().
@@ -35,8 +38,11 @@ static LPDIRECT3DDEVICE9        g_pd3dDevice = NULL;
 static LPDIRECT3DVERTEXBUFFER9  g_pVB = NULL;
 static LPDIRECT3DINDEXBUFFER9   g_pIB = NULL;
 static LPDIRECT3DTEXTURE9       g_FontTexture = NULL;
+static ImVector<LPDIRECT3DTEXTURE9> g_FontPageTextures;     // Additional pages of a multi-page font atlas (page 1 and more)
 static int                      g_VertexBufferSize = 5000, g_IndexBufferSize = 10000;
 
+static bool ImGui_ImplDX9_UpdateFontsTexture();
+
 struct CUSTOMVERTEX
 {
     float    pos[3];
@@ -76,6 +82,8 @@ static void ImGui_ImplDX9_SetupRenderState(ImDrawData* draw_data)
     g_pd3dDevice->SetTextureStageState(0, D3DTSS_ALPHAOP, D3DTOP_MODULATE);
     g_pd3dDevice->SetTextureStageState(0, D3DTSS_ALPHAARG1, D3DTA_TEXTURE);
     g_pd3dDevice->SetTextureStageState(0, D3DTSS_ALPHAARG2, D3DTA_DIFFUSE);
+    g_pd3dDevice->SetTextureStageState(1, D3DTSS_COLOROP, D3DTOP_DISABLE);
+    g_pd3dDevice->SetTextureStageState(1, D3DTSS_ALPHAOP, D3DTOP_DISABLE);
     g_pd3dDevice->SetSamplerState(0, D3DSAMP_MINFILTER, D3DTEXF_LINEAR);
     g_pd3dDevice->SetSamplerState(0, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR);
 
@@ -101,6 +109,32 @@ static void ImGui_ImplDX9_SetupRenderState(ImDrawData* draw_data)
     }
 }
 
+// Fixed-pipeline rendering of signed distance field glyphs (ImDrawCmdFlags_TextureSDF), without requiring pixel shaders:
+// - Stage 0: alpha = texture - 0.375
+// - Stage 1: alpha = stage0 * diffuse * 4
+// Which gives a linear ramp from the distance values 0.375 to 0.625 (about one texel of the base font size on each side of the edge with the default SDFPadding).
+static void ImGui_ImplDX9_SetupSDFRenderState(bool enable)
+{
+    if (enable)
+    {
+        g_pd3dDevice->SetRenderState(D3DRS_TEXTUREFACTOR, D3DCOLOR_ARGB(0x60, 0xFF, 0xFF, 0xFF));
+        g_pd3dDevice->SetTextureStageState(0, D3DTSS_ALPHAOP, D3DTOP_SUBTRACT);
+        g_pd3dDevice->SetTextureStageState(0, D3DTSS_ALPHAARG2, D3DTA_TFACTOR);
+        g_pd3dDevice->SetTextureStageState(1, D3DTSS_COLOROP, D3DTOP_SELECTARG1);
+        g_pd3dDevice->SetTextureStageState(1, D3DTSS_COLORARG1, D3DTA_CURRENT);
+        g_pd3dDevice->SetTextureStageState(1, D3DTSS_ALPHAOP, D3DTOP_MODULATE4X);
+        g_pd3dDevice->SetTextureStageState(1, D3DTSS_ALPHAARG1, D3DTA_CURRENT);
+        g_pd3dDevice->SetTextureStageState(1, D3DTSS_ALPHAARG2, D3DTA_DIFFUSE);
+    }
+    else
+    {
+        g_pd3dDevice->SetTextureStageState(0, D3DTSS_ALPHAOP, D3DTOP_MODULATE);
+        g_pd3dDevice->SetTextureStageState(0, D3DTSS_ALPHAARG2, D3DTA_DIFFUSE);
+        g_pd3dDevice->SetTextureStageState(1, D3DTSS_COLOROP, D3DTOP_DISABLE);
+        g_pd3dDevice->SetTextureStageState(1, D3DTSS_ALPHAOP, D3DTOP_DISABLE);
+    }
+}
+
 // Render function.
 // (this used to be set in io.RenderDrawListsFn and called by ImGui::Render(), but you can now call this directly from your main loop)
 void ImGui_ImplDX9_RenderDrawData(ImDrawData* draw_data)
@@ -109,6 +143,11 @@ void ImGui_ImplDX9_RenderDrawData(ImDrawData* draw_data)
     if (draw_data->DisplaySize.x <= 0.0f || draw_data->DisplaySize.y <= 0.0f)
         return;
 
+    // Upload glyphs rasterized on demand during this frame. The texture size doesn't change so draw commands can keep using the same TexID.
+    // New pages get their texture here, their glyphs are rendered from the next frame.
+    if (g_FontTexture && ImGui::GetIO().Fonts->TexDirty)
+        ImGui_ImplDX9_UpdateFontsTexture();
+
     // Create and grow buffers if needed
     if (!g_pVB || g_VertexBufferSize < draw_data->TotalVtxCount)
     {
@@ -178,6 +217,7 @@ void ImGui_ImplDX9_RenderDrawData(ImDrawData* draw_data)
     int global_vtx_offset = 0;
     int global_idx_offset = 0;
     ImVec2 clip_off = draw_data->DisplayPos;
+    bool sdf_enabled = false;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
@@ -189,12 +229,23 @@ void ImGui_ImplDX9_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplDX9_SetupRenderState(draw_data);
+                    sdf_enabled = false;
+                }
                 else
+                {
                     pcmd->UserCallback(cmd_list, pcmd);
+                }
             }
             else
             {
+                const bool sdf = (pcmd->Flags & ImDrawCmdFlags_TextureSDF) != 0;
+                if (sdf != sdf_enabled)
+                {
+                    ImGui_ImplDX9_SetupSDFRenderState(sdf);
+                    sdf_enabled = sdf;
+                }
                 const RECT r = { (LONG)(pcmd->ClipRect.x - clip_off.x), (LONG)(pcmd->ClipRect.y - clip_off.y), (LONG)(pcmd->ClipRect.z - clip_off.x), (LONG)(pcmd->ClipRect.w - clip_off.y) };
                 const LPDIRECT3DTEXTURE9 texture = (LPDIRECT3DTEXTURE9)pcmd->TextureId;
                 g_pd3dDevice->SetTexture(0, texture);
@@ -246,16 +297,68 @@ static bool ImGui_ImplDX9_CreateFontsTexture()
     g_FontTexture = NULL;
     if (g_pd3dDevice->CreateTexture(width, height, 1, D3DUSAGE_DYNAMIC, D3DFMT_A8R8G8B8, D3DPOOL_DEFAULT, &g_FontTexture, NULL) < 0)
         return false;
-    D3DLOCKED_RECT tex_locked_rect;
-    if (g_FontTexture->LockRect(0, &tex_locked_rect, NULL, 0) != D3D_OK)
-        return false;
-    for (int y = 0; y < height; y++)
-        memcpy((unsigned char*)tex_locked_rect.pBits + tex_locked_rect.Pitch * y, pixels + (width * bytes_per_pixel) * y, (width * bytes_per_pixel));
-    g_FontTexture->UnlockRect(0);
 
     // Store our identifier
     io.Fonts->TexID = (ImTextureID)g_FontTexture;
 
+    // Create textures of additional pages and upload all pages
+    return ImGui_ImplDX9_UpdateFontsTexture();
+}
+
+// Copy atlas pixels into the existing textures (also used to upload glyphs added after the initial build)
+static bool ImGui_ImplDX9_UpdateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    const int pages_count = io.Fonts->GetTexPagesCount();
+
+    // Release textures of pages the atlas doesn't have anymore (e.g. rebuilt with fewer pages)
+    for (int n = pages_count - 1; n < g_FontPageTextures.Size; n++)
+        g_FontPageTextures[n]->Release();
+    if (g_FontPageTextures.Size > pages_count - 1)
+        g_FontPageTextures.resize(pages_count - 1);
+
+    for (int page = 0; page < pages_count; page++)
+    {
+        unsigned char* pixels;
+        int width, height, bytes_per_pixel;
+        io.Fonts->GetTexPageDataAsRGBA32(page, &pixels, &width, &height, &bytes_per_pixel);
+
+        if (page > 0)
+        {
+            // Recreate the texture of a page whose size changed (atlas rebuilt), create textures of new pages
+            D3DSURFACE_DESC desc;
+            if (page <= g_FontPageTextures.Size && g_FontPageTextures[page - 1]->GetLevelDesc(0, &desc) == D3D_OK && ((int)desc.Width != width || (int)desc.Height != height))
+            {
+                g_FontPageTextures[page - 1]->Release();
+                g_FontPageTextures[page - 1] = NULL;
+                if (g_pd3dDevice->CreateTexture(width, height, 1, D3DUSAGE_DYNAMIC, D3DFMT_A8R8G8B8, D3DPOOL_DEFAULT, &g_FontPageTextures[page - 1], NULL) < 0)
+                {
+                    for (int n = page; n < g_FontPageTextures.Size; n++)
+                        g_FontPageTextures[n]->Release();
+                    g_FontPageTextures.resize(page - 1);
+                    return false;
+                }
+            }
+            else if (page > g_FontPageTextures.Size)
+            {
+                LPDIRECT3DTEXTURE9 page_texture = NULL;
+                if (g_pd3dDevice->CreateTexture(width, height, 1, D3DUSAGE_DYNAMIC, D3DFMT_A8R8G8B8, D3DPOOL_DEFAULT, &page_texture, NULL) < 0)
+                    return false;
+                g_FontPageTextures.push_back(page_texture);
+            }
+            io.Fonts->SetTexPageID(page, (ImTextureID)g_FontPageTextures[page - 1]);
+        }
+
+        LPDIRECT3DTEXTURE9 texture = (page == 0) ? g_FontTexture : g_FontPageTextures[page - 1];
+        D3DLOCKED_RECT tex_locked_rect;
+        if (texture->LockRect(0, &tex_locked_rect, NULL, 0) != D3D_OK)
+            return false;
+        for (int y = 0; y < height; y++)
+            memcpy((unsigned char*)tex_locked_rect.pBits + tex_locked_rect.Pitch * y, pixels + (width * bytes_per_pixel) * y, (width * bytes_per_pixel));
+        texture->UnlockRect(0);
+    }
+    io.Fonts->TexDirty = false;
+
     return true;
 }
 
@@ -275,6 +378,13 @@ void ImGui_ImplDX9_InvalidateDeviceObjects()
     if (g_pVB) { g_pVB->Release(); g_pVB = NULL; }
     if (g_pIB) { g_pIB->Release(); g_pIB = NULL; }
     if (g_FontTexture) { g_FontTexture->Release(); g_FontTexture = NULL; ImGui::GetIO().Fonts->TexID = NULL; } // We copied g_pFontTextureView to io.Fonts->TexID so let's clear that as well.
+    for (int n = 0; n < g_FontPageTextures.Size; n++)
+    {
+        g_FontPageTextures[n]->Release();
+        if (n + 1 < ImGui::GetIO().Fonts->GetTexPagesCount())
+            ImGui::GetIO().Fonts->SetTexPageID(n + 1, NULL);
+    }
+    g_FontPageTextures.clear();
 }
 
 void ImGui_ImplDX9_NewFrame()
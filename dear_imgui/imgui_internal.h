@@ -95,18 +95,24 @@ struct ImGuiColumns;                // Storage data for a columns set
 struct ImGuiContext;                // Main Dear ImGui context
 struct ImGuiDataTypeInfo;           // Type information associated to a ImGuiDataType enum
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
+struct ImGuiIDHashCache;            // Per-window memo of label hashes computed by GetID()
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
+struct ImGuiInputTextLineCache;     // Line index of an inactive multi-line text input, kept between frames
 struct ImGuiLastItemDataBackup;     // Backup and restore IsItemHovered() internal data
 struct ImGuiMenuColumns;            // Simple column measurement, currently used for MenuItem() only
 struct ImGuiNavMoveResult;          // Result of a gamepad/keyboard directional navigation move query result
 struct ImGuiNextWindowData;         // Storage for SetNextWindow** functions
+struct ImGuiMultiSelectTempData;    // Temporary storage for the BeginMultiSelect()/EndMultiSelect() scope being submitted
 struct ImGuiNextItemData;           // Storage for SetNextItem** functions
+struct ImGuiPlotSource;             // Values source for PlotEx()
 struct ImGuiPopupData;              // Storage for current popup stack
 struct ImGuiSettingsHandler;        // Storage for one type registered in the .ini file
 struct ImGuiStyleMod;               // Stacked style modifier, backup of modified data so we can restore it
 struct ImGuiTabBar;                 // Storage for a tab bar
 struct ImGuiTabItem;                // Storage for a tab item (within a tab bar)
+struct ImGuiTextLineIndex;          // Line starts and cached line widths of a text buffer (used by InputTextEx)
 struct ImGuiWindow;                 // Storage for one window
+struct ImGuiWindowHitGrid;          // Spatial index over windows rectangles, for hit-testing
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame)
 struct ImGuiWindowSettings;         // Storage for a window .ini settings (we keep one of those even if the actual window wasn't instanced during this session)
 
@@ -144,7 +150,7 @@ namespace ImStb
 #undef STB_TEXTEDIT_STRING
 #undef STB_TEXTEDIT_CHARTYPE
 #define STB_TEXTEDIT_STRING             ImGuiInputTextState
-#define STB_TEXTEDIT_CHARTYPE           ImWchar
+#define STB_TEXTEDIT_CHARTYPE           char
 #define STB_TEXTEDIT_GETWIDTH_NEWLINE   (-1.0f)
 #define STB_TEXTEDIT_UNDOSTATECOUNT     99
 #define STB_TEXTEDIT_UNDOCHARCOUNT      999
@@ -167,6 +173,19 @@ namespace ImStb
 #define IMGUI_DEBUG_LOG_POPUP(...)      ((void)0)       // Disable log
 #define IMGUI_DEBUG_LOG_NAV(...)        ((void)0)       // Disable log
 
+// Memory Tracking: account MemAlloc() calls made within the current scope to a ImGuiMemTag (innermost scope wins)
+#ifdef IMGUI_ENABLE_MEMORY_TRACKING
+struct ImGuiMemTagScope
+{
+    ImGuiMemTag BackupTag;
+    ImGuiMemTagScope(ImGuiMemTag tag)   { BackupTag = ImGui::MemSetTag(tag); }
+    ~ImGuiMemTagScope()                 { ImGui::MemSetTag(BackupTag); }
+};
+#define IM_MEMTAG_SCOPE(_TAG)           ImGuiMemTagScope im_memtag_scope(_TAG)
+#else
+#define IM_MEMTAG_SCOPE(_TAG)           ((void)0)
+#endif
+
 // Static Asserts
 #if (__cplusplus >= 201100)
 #define IM_STATIC_ASSERT(_COND)         static_assert(_COND, "")
@@ -246,6 +265,7 @@ namespace ImStb
 // Helpers: Hashing
 IMGUI_API ImU32         ImHashData(const void* data, size_t data_size, ImU32 seed = 0);
 IMGUI_API ImU32         ImHashStr(const char* data, size_t data_size = 0, ImU32 seed = 0);
+IMGUI_API ImU32         ImHashLabel(const ImGuiLabelHash& label, ImU32 seed = 0);
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
 static inline ImU32     ImHash(const void* data, int size, ImU32 seed = 0) { return size ? ImHashData(data, (size_t)size, seed) : ImHashStr((const char*)data, 0, seed); } // [moved to ImHashStr/ImHashData in 1.68]
 #endif
@@ -284,6 +304,7 @@ static inline bool      ImCharIsBlankW(unsigned int c)  { return c == ' ' || c =
 
 // Helpers: UTF-8 <> wchar conversions
 IMGUI_API int           ImTextStrToUtf8(char* buf, int buf_size, const ImWchar* in_text, const ImWchar* in_text_end);      // return output UTF-8 bytes count
+IMGUI_API int           ImTextCharToUtf8(char* buf, int buf_size, unsigned int c);                                         // write one character. return output UTF-8 bytes count (0 if it doesn't fit)
 IMGUI_API int           ImTextCharFromUtf8(unsigned int* out_char, const char* in_text, const char* in_text_end);          // read one character. return input UTF-8 bytes count
 IMGUI_API int           ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const char* in_text_end, const char** in_remaining = NULL);   // return input UTF-8 bytes count
 IMGUI_API int           ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end);                            // return number of UTF-8 code-points (NOT bytes count)
@@ -496,10 +517,10 @@ struct IMGUI_API ImPool
     T*          GetOrAddByKey(ImGuiID key)          { int* p_idx = Map.GetIntRef(key, -1); if (*p_idx != -1) return &Buf[*p_idx]; *p_idx = FreeIdx; return Add(); }
     bool        Contains(const T* p) const          { return (p >= Buf.Data && p < Buf.Data + Buf.Size); }
     void        Clear()                             { for (int n = 0; n < Map.Data.Size; n++) { int idx = Map.Data[n].val_i; if (idx != -1) Buf[idx].~T(); } Map.Clear(); Buf.clear(); FreeIdx = 0; }
-    T*          Add()                               { int idx = FreeIdx; if (idx == Buf.Size) { Buf.resize(Buf.Size + 1); FreeIdx++; } else { FreeIdx = *(int*)&Buf[idx]; } IM_PLACEMENT_NEW(&Buf[idx]) T(); return &Buf[idx]; }
+    T*          Add()                               { IM_MEMTAG_SCOPE(ImGuiMemTag_Pool); int idx = FreeIdx; if (idx == Buf.Size) { Buf.resize(Buf.Size + 1); FreeIdx++; } else { FreeIdx = *(int*)&Buf[idx]; } IM_PLACEMENT_NEW(&Buf[idx]) T(); return &Buf[idx]; }
     void        Remove(ImGuiID key, const T* p)     { Remove(key, GetIndex(p)); }
     void        Remove(ImGuiID key, ImPoolIdx idx)  { Buf[idx].~T(); *(int*)&Buf[idx] = FreeIdx; FreeIdx = idx; Map.SetInt(key, -1); }
-    void        Reserve(int capacity)               { Buf.reserve(capacity); Map.Data.reserve(capacity); }
+    void        Reserve(int capacity)               { IM_MEMTAG_SCOPE(ImGuiMemTag_Pool); Buf.reserve(capacity); Map.Data.reserve(capacity); }
     int         GetSize() const                     { return Buf.Size; }
 };
 
@@ -516,7 +537,7 @@ struct IMGUI_API ImChunkStream
     void    clear()                     { Buf.clear(); }
     bool    empty() const               { return Buf.Size == 0; }
     int     size() const                { return Buf.Size; }
-    T*      alloc_chunk(size_t sz)      { size_t HDR_SZ = 4; sz = ((HDR_SZ + sz) + 3u) & ~3u; int off = Buf.Size; Buf.resize(off + (int)sz); ((int*)(void*)(Buf.Data + off))[0] = (int)sz; return (T*)(void*)(Buf.Data + off + (int)HDR_SZ); }
+    T*      alloc_chunk(size_t sz)      { IM_MEMTAG_SCOPE(ImGuiMemTag_Settings); size_t HDR_SZ = 4; sz = ((HDR_SZ + sz) + 3u) & ~3u; int off = Buf.Size; Buf.resize(off + (int)sz); ((int*)(void*)(Buf.Data + off))[0] = (int)sz; return (T*)(void*)(Buf.Data + off + (int)HDR_SZ); }
     T*      begin()                     { size_t HDR_SZ = 4; if (!Buf.Data) return NULL; return (T*)(void*)(Buf.Data + HDR_SZ); }
     T*      next_chunk(T* p)            { size_t HDR_SZ = 4; IM_ASSERT(p >= begin() && p < end()); p = (T*)(void*)((char*)(void*)p + chunk_size(p)); if (p == (T*)(void*)((char*)end() + HDR_SZ)) return (T*)0; IM_ASSERT(p < end()); return p; }
     int     chunk_size(const T* p)      { return ((const int*)p)[-1]; }
@@ -525,6 +546,32 @@ struct IMGUI_API ImChunkStream
     T*      ptr_from_offset(int off)    { IM_ASSERT(off >= 4 && off < Buf.Size); return (T*)(void*)(Buf.Data + off); }
 };
 
+// Helper: ImLinearAllocator
+// Linear (bump) allocator: allocations are carved out of large blocks and all released at once with Reset().
+// Regular blocks are kept across Reset() so a steady state doesn't touch the heap. Requests larger than BlockSize get a dedicated block, freed on Reset().
+// This is used for transient per-frame allocations, see ImGui::MemAllocFrame().
+struct IMGUI_API ImLinearAllocator
+{
+    ImVector<char*> Blocks;             // Regular blocks of BlockSize bytes
+    ImVector<char*> LargeBlocks;        // Dedicated blocks for requests larger than BlockSize (prefixed with their size)
+    int             CurrentBlock;       // Index of block we are allocating from
+    size_t          CurrentOffset;      // Offset of next allocation within Blocks[CurrentBlock]
+    size_t          BlockSize;
+    int             AllocCount;         // Statistics since last Reset()
+    size_t          AllocBytes;
+    const char*     AddrMin;            // Address range spanning all blocks, so Contains() rejects most pointers without scanning the blocks
+    const char*     AddrMax;
+
+    ImLinearAllocator()     { CurrentBlock = 0; CurrentOffset = 0; BlockSize = 64 * 1024; AllocCount = 0; AllocBytes = 0; AddrMin = AddrMax = NULL; }
+    ~ImLinearAllocator()    { ClearFreeMemory(); }
+    void*           Alloc(size_t size);     // Returned memory is aligned on 16 bytes
+    void            Reset();
+    void            ClearFreeMemory();
+    bool            Contains(const void* ptr) const;
+    void            AddAddrRange(const char* p, size_t size) { if (AddrMin == NULL || p < AddrMin) AddrMin = p; if (AddrMax == NULL || p + size > AddrMax) AddrMax = p + size; }
+    size_t          GetReservedBytes() const { return (size_t)Blocks.Size * BlockSize; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList support
 //-----------------------------------------------------------------------------
@@ -847,17 +894,54 @@ struct IMGUI_API ImGuiMenuColumns
     float       CalcExtraSpace(float avail_w) const;
 };
 
+// Line starts of a text buffer, with lazily measured line widths.
+// InputTextEx() keeps one in sync with its edit buffer from the STB_TEXTEDIT_INSERTCHARS/DELETECHARS callbacks,
+// so locating the cursor/selection and measuring the text height doesn't require scanning the whole buffer every frame.
+// Entries are stored with a gap at the line of the last edit, entries after the gap being offsets from the end of the text:
+// an edit only converts the entries between the previously and currently edited lines instead of offsetting every following line.
+struct IMGUI_API ImGuiTextLineIndex
+{
+    ImVector<int>           Starts;                 // Offset of the first character of each line. Entries after the gap store (TextLen - offset).
+    ImVector<float>         Widths;                 // Width of each line excluding its '\n' (< 0.0f: not measured yet). Same layout as Starts[].
+    int                     LineCount;              // Has at least one line once built
+    int                     GapLine;                // Lines >= GapLine are stored after the gap
+    int                     TextLen;
+    ImFont*                 WidthsFont;             // Font and size Widths[] were measured with
+    float                   WidthsFontSize;
+
+    ImGuiTextLineIndex()    { LineCount = GapLine = TextLen = 0; WidthsFont = NULL; WidthsFontSize = 0.0f; }
+    void        Clear()                         { Starts.clear(); Widths.clear(); LineCount = GapLine = TextLen = 0; WidthsFont = NULL; }
+    int         GetLineCount() const            { return LineCount; }
+    int         GetLineStart(int line) const    { return (line < GapLine) ? Starts.Data[line] : TextLen - Starts.Data[line + Starts.Size - LineCount]; }
+    int         GetLineEnd(int line) const      { return (line + 1 < LineCount) ? GetLineStart(line + 1) - 1 : TextLen; } // Offset of the line's '\n', or TextLen for the last line
+    void        Build(const char* text, int text_len);
+    int         FindLine(int pos) const;                                    // Return line containing byte offset 'pos'. O(log lines).
+    void        OnInsertChars(int pos, const char* new_text, int new_text_len);
+    void        OnDeleteChars(int pos, int len);
+    float       GetLineWidth(int line, const char* text);                   // Measure with the current font, cached. [text + GetLineStart(line), text + GetLineEnd(line)) needs to be valid.
+    void        MoveGap(int line);
+};
+
 // Internal state of the currently focused/edited text input box
 // For a given item ID, access with ImGui::GetInputTextState()
+// All positions (cursor, selection, undo records) are byte offsets in the UTF-8 text.
+// The edit buffer is a gap buffer: TextA holds [0,GapPos), then all the spare capacity, then [GapPos,CurLenA) and a zero-terminator.
+// Typing only moves the bytes between two edit positions. Use GetChar()/GetTextRange() to read it.
 struct IMGUI_API ImGuiInputTextState
 {
     ImGuiID                 ID;                     // widget id owning the text state
-    int                     CurLenW, CurLenA;       // we need to maintain our buffer length in both UTF-8 and wchar format. UTF-8 length is valid even if TextA is not.
-    ImVector<ImWchar>       TextW;                  // edit buffer, we need to persist but can't guarantee the persistence of the user-provided buffer. so we copy into own buffer.
-    ImVector<char>          TextA;                  // temporary UTF8 buffer for callbacks and other operations. this is not updated in every code-path! size=capacity.
+    int                     CurLenA;                // length of the text in bytes
+    ImVector<char>          TextA;                  // edit buffer (UTF-8, with a gap), we need to persist but can't guarantee the persistence of the user-provided buffer. so we copy into own buffer. size=capacity+1.
+    int                     GapPos;                 // position of the gap in the edit buffer (position of the last edit)
     ImVector<char>          InitialTextA;           // backup of end-user buffer at the time of focus (in UTF-8, unaltered)
-    bool                    TextAIsValid;           // temporary UTF8 buffer is not initially valid before we make the widget active (until then we pull the data from user argument)
+    ImVector<char>          CallbackTextBackup;     // copy of the text as of the last user callback, to record its modifications in the undo state. Only the modified range is copied before each callback.
+    ImGuiTextLineIndex      LineIndex;              // line starts of the text, updated incrementally on edits
     int                     BufCapacityA;           // end-user buffer capacity
+    int                     BufSyncedLen;           // length of the text in the end-user buffer when we last copied to it
+    int                     BufDirtyBegin;          // text modified since we last copied to the end-user buffer: [BufDirtyBegin, CurLenA - BufDirtyTail) (-1: unmodified)
+    int                     BufDirtyTail;
+    int                     CallbackTextBackupDirtyBegin; // text modified since CallbackTextBackup was updated: [CallbackTextBackupDirtyBegin, CurLenA - CallbackTextBackupDirtyTail) (-1: unmodified)
+    int                     CallbackTextBackupDirtyTail;
     float                   ScrollX;                // horizontal scrolling/offset
     ImStb::STB_TexteditState Stb;                   // state for stb_textedit.h
     float                   CursorAnim;             // timer for cursor blink, reset on every user action so the cursor reappears immediately
@@ -868,19 +952,67 @@ struct IMGUI_API ImGuiInputTextState
     ImGuiInputTextCallback  UserCallback;           // "
     void*                   UserCallbackData;       // "
 
-    ImGuiInputTextState()                   { memset(this, 0, sizeof(*this)); }
-    void        ClearText()                 { CurLenW = CurLenA = 0; TextW[0] = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); }
+    ImGuiInputTextState()                   { memset(this, 0, sizeof(*this)); BufDirtyBegin = CallbackTextBackupDirtyBegin = -1; }
+    void        ClearText()                 { SetText("", 0); CursorClamp(); }
+    void        ClearFreeMemory()           { TextA.clear(); InitialTextA.clear(); CallbackTextBackup.clear(); LineIndex.Clear(); }
     int         GetUndoAvailCount() const   { return Stb.undostate.undo_point; }
     int         GetRedoAvailCount() const   { return STB_TEXTEDIT_UNDOSTATECOUNT - Stb.undostate.redo_point; }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
+    void        OnCharPressed(unsigned int c); // Insert a character (encoded to UTF-8)
+
+    // Text storage
+    int         GetGapLen() const           { return TextA.Size - 1 - CurLenA; }
+    char        GetChar(int pos) const      { return TextA.Data[pos < GapPos ? pos : pos + GetGapLen()]; }
+    const char* GetTextRange(int begin, int end);                   // Return 'text' so that [text + begin, text + end) is contiguous, moving the gap out of the range if needed
+    const char* GetText()                   { return GetTextRange(0, CurLenA); } // Zero-terminated
+    void        SetText(const char* text, int text_len);            // Replace the whole text (not undoable), keeping the capacity
+    void        MoveGap(int pos);
+    void        MarkBufDirty(int begin, int tail) { MarkRangeDirty(&BufDirtyBegin, &BufDirtyTail, begin, tail); MarkRangeDirty(&CallbackTextBackupDirtyBegin, &CallbackTextBackupDirtyTail, begin, tail); } // Text was modified in [begin, CurLenA - tail)
+    void        UpdateCallbackTextBackup();                         // Copy the text modified since the last call into CallbackTextBackup. The gap must be at the end.
+    static void MarkRangeDirty(int* dirty_begin, int* dirty_tail, int begin, int tail) { *dirty_tail = (*dirty_begin < 0) ? tail : ImMin(*dirty_tail, tail); *dirty_begin = (*dirty_begin < 0) ? begin : ImMin(*dirty_begin, begin); }
 
     // Cursor & Selection
     void        CursorAnimReset()           { CursorAnim = -0.30f; }                                   // After a user-input the cursor stays on for a while without blinking
-    void        CursorClamp()               { Stb.cursor = ImMin(Stb.cursor, CurLenW); Stb.select_start = ImMin(Stb.select_start, CurLenW); Stb.select_end = ImMin(Stb.select_end, CurLenW); }
+    void        CursorClamp()               { Stb.cursor = ImMin(Stb.cursor, CurLenA); Stb.select_start = ImMin(Stb.select_start, CurLenA); Stb.select_end = ImMin(Stb.select_end, CurLenA); }
     bool        HasSelection() const        { return Stb.select_start != Stb.select_end; }
     void        ClearSelection()            { Stb.select_start = Stb.select_end = Stb.cursor; }
-    void        SelectAll()                 { Stb.select_start = 0; Stb.cursor = Stb.select_end = CurLenW; Stb.has_preferred_x = 0; }
+    void        SelectAll()                 { Stb.select_start = 0; Stb.cursor = Stb.select_end = CurLenA; Stb.has_preferred_x = 0; }
+};
+
+// Line index of an inactive InputTextMultiline() using ImGuiInputTextFlags_RetainLineIndex, kept between frames
+struct ImGuiInputTextLineCache
+{
+    ImGuiID                 ID;
+    const char*             Buf;                    // User buffer the index was built for (a different pointer triggers a rebuild)
+    int                     TextLen;                // Length of the indexed text. Text appended past it is indexed on the next frame (-1: rebuild)
+    float                   LastTimeUsed;           // Garbage collected after io.ConfigWindowsMemoryCompactTimer
+    bool                    EditedByWidget;         // Text was edited while active: take over the index of the edit state instead of rebuilding
+    ImGuiTextLineIndex      LineIndex;
+
+    ImGuiInputTextLineCache() { ID = 0; Buf = NULL; TextLen = -1; LastTimeUsed = 0.0f; EditedByWidget = false; }
+};
+
+// Values source for PlotEx(): up to two contiguous spans read in place (e.g. the two halves of a ring buffer), a getter function, or a range of a ImGuiPlotSeries
+struct IMGUI_API ImGuiPlotSource
+{
+    const float*            Spans[2];               // Values are read from Spans[0] then Spans[1]
+    int                     SpansCount[2];
+    int                     Stride;                 // Byte stride between values of a span
+    float                   (*ValuesGetter)(void* data, int idx);   // When set, used instead of Spans
+    void*                   ValuesGetterData;
+    const ImGuiPlotSeries*  Series;                 // When set, used instead of Spans
+    int                     ValuesOffset;           // ValuesGetter, Series: index of the first value to display
+    int                     ValuesCount;
+
+    ImGuiPlotSource()       { memset(this, 0, sizeof(*this)); }
+    void        InitSpans(const float* values0, int count0, const float* values1, int count1, int stride);
+    void        InitRing(const float* values, int count, int offset, int stride) { offset = count > 0 ? offset % count : 0; InitSpans((const float*)(const void*)((const unsigned char*)values + (size_t)offset * stride), count - offset, values, offset, stride); }
+    void        InitGetter(float (*values_getter)(void* data, int idx), void* data, int count, int offset) { ValuesGetter = values_getter; ValuesGetterData = data; ValuesCount = count; ValuesOffset = offset; }
+    void        InitSeries(const ImGuiPlotSeries* series, int offset, int count) { Series = series; ValuesCount = count; ValuesOffset = offset; }
+    float       GetValue(int idx) const;
+    void        CalcMinMax(int idx_begin, int idx_end, float* io_min, float* io_max) const;   // Ignore NaN values
+    void        CalcColumnsMinMax(ImVec2* out_columns, int columns_count) const;                // Split values in columns, see ImGuiPlotSeries::CalcColumnsMinMax()
+    float       CalcMean(int idx_begin, int idx_end) const;                                     // Ignore NaN values, 0.0f if none
 };
 
 // Storage for current popup stack
@@ -951,7 +1083,8 @@ enum ImGuiNextItemDataFlags_
 {
     ImGuiNextItemDataFlags_None     = 0,
     ImGuiNextItemDataFlags_HasWidth = 1 << 0,
-    ImGuiNextItemDataFlags_HasOpen  = 1 << 1
+    ImGuiNextItemDataFlags_HasOpen  = 1 << 1,
+    ImGuiNextItemDataFlags_HasSelectionIndex = 1 << 2
 };
 
 struct ImGuiNextItemData
@@ -961,6 +1094,7 @@ struct ImGuiNextItemData
     ImGuiID                     FocusScopeId;   // Set by SetNextItemMultiSelectData() (!= 0 signify value has been set, so it's an alternate version of HasSelectionData, we don't use Flags for this because they are cleared too early. This is mostly used for debugging)
     ImGuiCond                   OpenCond;
     bool                        OpenVal;        // Set by SetNextItemOpen()
+    int                         SelectionIndex; // Set by SetNextItemSelectionIndex()
 
     ImGuiNextItemData()         { memset(this, 0, sizeof(*this)); }
     inline void ClearFlags()    { Flags = ImGuiNextItemDataFlags_None; } // Also cleared manually by ItemAdd()!
@@ -981,6 +1115,29 @@ struct ImGuiPtrOrIndex
     ImGuiPtrOrIndex(int index)  { Ptr = NULL; Index = index; }
 };
 
+// Spatial index used by FindHoveredWindow() to only hit-test windows overlapping the mouse position.
+// The display area is split into uniform cells, each listing the windows whose (padded) OuterRectClipped overlaps it.
+// Windows refresh their cells from Begin() when their rectangle changes. Inactive windows are left in place and filtered at query time.
+struct ImGuiWindowHitGridCell
+{
+    ImVector<ImGuiWindow*>  Windows;
+};
+
+struct ImGuiWindowHitGrid
+{
+    ImVec2                  Origin;         // Position of the top-left corner of cell (0,0)
+    ImVec2                  CellSize;
+    ImVec2ih                CellCount;
+    ImVec2                  DisplaySize;    // io.DisplaySize used to setup the grid
+    ImVec2                  Padding;        // Padding added to window rectangles when registering them: >= any padding used by hit-testing
+    ImVector<ImGuiWindowHitGridCell> Cells;
+    bool                    OrderDirty;     // g.Windows[] was reordered since ImGuiWindow::HitGridOrder was last refreshed
+
+    ImGuiWindowHitGrid()    { Origin = CellSize = DisplaySize = Padding = ImVec2(0.0f, 0.0f); CellCount = ImVec2ih(0, 0); OrderDirty = true; }
+    ~ImGuiWindowHitGrid()   { ClearFreeMemory(); }
+    void                    ClearFreeMemory() { for (int n = 0; n < Cells.Size; n++) Cells[n].Windows.clear(); Cells.clear(); CellCount = ImVec2ih(0, 0); OrderDirty = true; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Columns support
 //-----------------------------------------------------------------------------
@@ -1000,10 +1157,13 @@ struct ImGuiColumnData
 {
     float               OffsetNorm;         // Column start offset, normalized 0.0 (far left) -> 1.0 (far right)
     float               OffsetNormBeforeResize;
+    float               OffsetX;            // Column start offset from window->Pos.x, resolved from OffsetNorm by BeginColumns() and SetColumnOffset()
+    float               ContentMaxX;        // Right-most position of the contents submitted in the column this frame (CursorMaxPos.x)
+    bool                DrawOverflow;       // Vertices were drawn outside of ClipRect this frame, on a side which isn't clipped by the host
     ImGuiColumnsFlags   Flags;              // Not exposed
     ImRect              ClipRect;
 
-    ImGuiColumnData()   { OffsetNorm = OffsetNormBeforeResize = 0.0f; Flags = ImGuiColumnsFlags_None; }
+    ImGuiColumnData()   { OffsetNorm = OffsetNormBeforeResize = OffsetX = 0.0f; ContentMaxX = -FLT_MAX; DrawOverflow = false; Flags = ImGuiColumnsFlags_None; }
 };
 
 struct ImGuiColumns
@@ -1021,6 +1181,7 @@ struct ImGuiColumns
     ImRect              HostInitialClipRect;    // Backup of ClipRect at the time of BeginColumns()
     ImRect              HostBackupClipRect;     // Backup of ClipRect during PushColumnsBackground()/PopColumnsBackground()
     ImRect              HostBackupParentWorkRect;//Backup of WorkRect at the time of BeginColumns()
+    int                 DrawVtxStart;           // Size of the window draw list VtxBuffer when the channel of the current column was last made current
     ImVector<ImGuiColumnData> Columns;
     ImDrawListSplitter  Splitter;
 
@@ -1037,6 +1198,7 @@ struct ImGuiColumns
         LineMinY = LineMaxY = 0.0f;
         HostCursorPosY = 0.0f;
         HostCursorMaxPosX = 0.0f;
+        DrawVtxStart = 0;
         Columns.clear();
     }
 };
@@ -1045,9 +1207,26 @@ struct ImGuiColumns
 // [SECTION] Multi-select support
 //-----------------------------------------------------------------------------
 
-#ifdef IMGUI_HAS_MULTI_SELECT
-// <this is filled in 'range_select' branch>
-#endif // #ifdef IMGUI_HAS_MULTI_SELECT
+// Temporary storage for the BeginMultiSelect()/EndMultiSelect() scope being submitted
+struct IMGUI_API ImGuiMultiSelectTempData
+{
+    ImGuiID                 ID;
+    ImGuiSelectionRanges*   Selection;
+    int                     ItemsCount;
+    ImGuiMultiSelectFlags   Flags;
+    ImGuiWindow*            Window;
+    bool                    KeyCtrl;            // CTRL, or Super with io.ConfigMacOSXBehaviors
+    bool                    KeyShift;
+
+    // Box-selection in 1D: the selected items are the ones between the start line [0] and the mouse line [1].
+    // Items are found while being submitted: the start line is measured on the first frame, when it is still visible, and the mouse line is kept in the visible area.
+    bool                    BoxSelectActive;
+    float                   BoxSelectY[2];      // Absolute position of the start line and mouse line
+    int                     BoxSelectFirst[2];  // First item whose bottom is below BoxSelectY[n], ItemsCount if none
+    int                     BoxSelectLast[2];   // Last item whose top is above BoxSelectY[n], -1 if none
+
+    ImGuiMultiSelectTempData()  { memset(this, 0, sizeof(*this)); }
+};
 
 //-----------------------------------------------------------------------------
 // [SECTION] Docking support
@@ -1094,6 +1273,8 @@ struct ImGuiSettingsHandler
     void        (*ReadLineFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, void* entry, const char* line); // Read: Called for every line of text within an ini entry
     void        (*ApplyAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler);                                // Read: Called after reading (in registration order)
     void        (*WriteAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);      // Write: Output every entries into 'out_buf'
+    void        (*ReadBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, void* entry, const void* data, size_t data_size); // Read: Optional. Called with the payload of a binary entry written by WriteAllBinaryFn, after ReadOpenFn
+    void        (*WriteAllBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf); // Write: Optional. Output every entries using SettingsBinaryAppendEntry(), when io.IniSavingBinary is set. Otherwise the lines written by WriteAllFn are stored.
     void*       UserData;
 
     ImGuiSettingsHandler() { memset(this, 0, sizeof(*this)); }
@@ -1128,6 +1309,8 @@ struct ImGuiContext
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
     ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Windows, sorted in focus order, back to front. (FIXME: We could only store root windows here! Need to sort out the Docking equivalent which is RootWindowDockStop and is unfortunately a little more dynamic)
     ImVector<ImGuiWindow*>  WindowsTempSortBuffer;              // Temporary buffer used in EndFrame() to reorder windows so parents are kept before their child
+    bool                    WindowsSortDirty;                   // Set when g.Windows[] was modified (window created, brought to front/back), so EndFrame() needs to sort it again
+    ImGuiWindowHitGrid      WindowsHitGrid;                     // Spatial index over windows rectangles, used by FindHoveredWindow()
     ImVector<ImGuiWindow*>  CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
@@ -1264,6 +1447,20 @@ struct ImGuiContext
     ImVector<unsigned char> DragDropPayloadBufHeap;             // We don't expose the ImVector<> directly, ImGuiPayload only holds pointer+size
     unsigned char           DragDropPayloadBufLocal[16];        // Local buffer for small payloads
 
+    // Multi-select
+    ImGuiMultiSelectTempData    MultiSelectTempData;
+    ImGuiMultiSelectTempData*   CurrentMultiSelect;             // Scope between BeginMultiSelect() and EndMultiSelect(), NULL if none
+    ImGuiID                     BoxSelectId;                    // Scope being box-selected
+    ImVec2                      BoxSelectStartPosRel;           // Box-selection start, relative to window->Pos and including scrolling
+    int                         BoxSelectStartFirst;            // ImGuiMultiSelectTempData::BoxSelectFirst[0] when it was measured, -2 before
+    int                         BoxSelectStartLast;
+    ImGuiSelectionRanges        BoxSelectInitial;               // Selection when box-selection started, box-selected items are added to it
+
+    // Tree views
+    ImGuiTreeView*              CurrentTreeView;                // Scope between BeginTreeView() and EndTreeView(), NULL if none
+    ImVector<ImGuiTreeViewRow>  TreeViewNewRows;                // Rows of the descendants of a node being opened
+    ImVector<int>               TreeViewStack;                  // Node, next child index and children count of the ancestors of the node being visited
+
     // Tab bars
     ImGuiTabBar*                    CurrentTabBar;
     ImPool<ImGuiTabBar>             TabBars;
@@ -1273,6 +1470,7 @@ struct ImGuiContext
     // Widget state
     ImVec2                  LastValidMousePos;
     ImGuiInputTextState     InputTextState;
+    ImVector<ImGuiInputTextLineCache*> InputTextLineCaches;     // For InputTextMultiline() using ImGuiInputTextFlags_RetainLineIndex
     ImFont                  InputTextPasswordFont;
     ImGuiID                 TempInputId;                        // Temporary text input when CTRL+clicking on a slider, etc.
     ImGuiColorEditFlags     ColorEditOptions;                   // Store user options for color edit widgets
@@ -1287,6 +1485,14 @@ struct ImGuiContext
     float                   DragSpeedDefaultRatio;              // If speed == 0.0f, uses (max-min) * DragSpeedDefaultRatio
     float                   ScrollbarClickDeltaToGrabCenter;    // Distance between mouse and center of grab box, normalized in parent space. Use storage?
     int                     TooltipOverrideCount;
+    ImVector<ImVec2>        PlotColumns;                        // PlotEx() scratch buffer: min/max of the values falling in each pixel column
+    ImVector<float>         PlotColumnsMean;                    // PlotEnvelopeEx() scratch buffer: mean of the values falling in each pixel column
+    ImVector<const char*>   ComboStringItems;                   // Combo() with a "item1\0item2\0" string: items of the open combo
+    ImGuiID                 TypeAheadWindowId;                  // Combo(), ListBox(): window where TypeAheadBuf[] was typed
+    double                  TypeAheadTime;                      // Time of the last typed character
+    char                    TypeAheadBuf[64];                   // Characters typed to find an item (UTF-8)
+    int                     TypeAheadItem;                      // Index of the last item found, to continue searching from it while it has focus
+    ImGuiID                 TypeAheadItemId;
     ImVector<char>          ClipboardHandlerData;               // If no custom clipboard handler is defined
     ImVector<ImGuiID>       MenusIdSubmittedThisFrame;          // A list of menu IDs that were rendered at least once
 
@@ -1301,6 +1507,7 @@ struct ImGuiContext
     ImGuiTextBuffer         SettingsIniData;                    // In memory .ini settings
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
+    ImGuiStorage                        SettingsWindowsMap;     // Map window settings ID to (offset + 1) into SettingsWindows, for FindWindowSettings()
 
     // Capture/Logging
     bool                    LogEnabled;                         // Currently capturing
@@ -1325,6 +1532,11 @@ struct ImGuiContext
     int                     WantCaptureKeyboardNextFrame;
     int                     WantTextInputNextFrame;
     char                    TempBuffer[1024 * 3 + 1];           // Temporary text buffer
+    ImLinearAllocator       FrameArena;                         // Transient allocations made with MemAllocFrame(), released by NewFrame()
+    int                     FrameAllocCount;                    // Number of MemAlloc() calls since last NewFrame() (copied to io.MetricsFrameAllocations)
+    size_t                  FrameAllocBytes;
+    size_t                  GcTransientBytes;                   // Bytes held by window draw list buffers as of last NewFrame(), included in the global total compared to io.ConfigWindowsMemoryBudget
+    size_t                  GcReclaimedBytesTotal;              // Bytes released by garbage collection of window buffers since context creation
 
     ImGuiContext(ImFontAtlas* shared_font_atlas) : BackgroundDrawList(&DrawListSharedData), ForegroundDrawList(&DrawListSharedData)
     {
@@ -1342,6 +1554,7 @@ struct ImGuiContext
         TestEngine = NULL;
 
         WindowsActiveCount = 0;
+        WindowsSortDirty = true;
         CurrentWindow = NULL;
         HoveredWindow = NULL;
         HoveredRootWindow = NULL;
@@ -1428,6 +1641,13 @@ struct ImGuiContext
         DragDropHoldJustPressedId = 0;
         memset(DragDropPayloadBufLocal, 0, sizeof(DragDropPayloadBufLocal));
 
+        CurrentMultiSelect = NULL;
+        BoxSelectId = 0;
+        BoxSelectStartPosRel = ImVec2(0.0f, 0.0f);
+        BoxSelectStartFirst = BoxSelectStartLast = -2;
+
+        CurrentTreeView = NULL;
+
         CurrentTabBar = NULL;
 
         LastValidMousePos = ImVec2(0.0f, 0.0f);
@@ -1442,6 +1662,11 @@ struct ImGuiContext
         DragSpeedDefaultRatio = 1.0f / 100.0f;
         ScrollbarClickDeltaToGrabCenter = 0.0f;
         TooltipOverrideCount = 0;
+        TypeAheadWindowId = 0;
+        TypeAheadTime = 0.0;
+        TypeAheadBuf[0] = 0;
+        TypeAheadItem = -1;
+        TypeAheadItemId = 0;
 
         PlatformImePos = PlatformImeLastPos = ImVec2(FLT_MAX, FLT_MAX);
         PlatformLocaleDecimalPoint = '.';
@@ -1465,6 +1690,9 @@ struct ImGuiContext
         FramerateSecPerFrameAccum = 0.0f;
         WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
         memset(TempBuffer, 0, sizeof(TempBuffer));
+        FrameAllocCount = 0;
+        FrameAllocBytes = 0;
+        GcTransientBytes = GcReclaimedBytesTotal = 0;
     }
 };
 
@@ -1563,6 +1791,39 @@ struct IMGUI_API ImGuiWindowTempData
     }
 };
 
+// Per-window memo of the hashes computed by ImGuiWindow::GetID() for labels.
+// A window generally submits the same labels with the same seeds in the same order every frame, so we record the sequence of
+// (seed, label pointer) -> ID of the previous frame and compare each call with the entry at the same position: on a hit we skip
+// ImHashStr() and the memory accesses are sequential. A copy of each label is compared too, so a reused buffer (e.g. sprintf()
+// output) whose contents changed is just a miss. When the sequence changes (e.g. an item was added), the following calls miss for
+// one frame while the new sequence gets recorded.
+struct ImGuiIDHashCacheEntry
+{
+    const char*             Str;                // Label pointer as passed to GetID(), NULL if the label wasn't memoized
+    ImGuiID                 Seed;
+    ImGuiID                 ID;
+    int                     StrLen;
+    int                     StrOffset;          // Offset of our copy of the label in ImGuiIDHashCache::Strings[]
+};
+
+struct IMGUI_API ImGuiIDHashCache
+{
+    ImVector<ImGuiIDHashCacheEntry> Entries;    // Calls to GetID() for labels, in submission order
+    ImVector<char>          Strings;            // Zero-terminated copies of the labels
+    int                     Cursor;             // Position of the next call in Entries[]
+    int                     StringsCompactSize; // Strings.Size after the last compaction, to notice when copies of labels which are not used anymore are piling up
+    const char*             RecentStr[16];      // Recently copied labels, so entries with the same label pointer but different seeds share the copy
+    int                     RecentStrLen[16];
+    int                     RecentStrOffset[16];
+
+    ImGuiIDHashCache()      { Cursor = StringsCompactSize = 0; memset(RecentStr, 0, sizeof(RecentStr)); }
+    void                    Clear() { Entries.clear(); Strings.clear(); Cursor = StringsCompactSize = 0; memset(RecentStr, 0, sizeof(RecentStr)); }
+    size_t                  GetMemorySize() const { return (size_t)Entries.Capacity * sizeof(ImGuiIDHashCacheEntry) + (size_t)Strings.Capacity; }
+    void                    NewFrame();         // Called on the first Begin() of the frame
+    ImGuiID                 GetID(const char* str, const char* str_end, ImGuiID seed); // Same value as ImHashStr(str, str_end ? str_end - str : 0, seed)
+    int                     AddString(const char* key, const char* str, int str_len);
+};
+
 // Storage for one window
 struct IMGUI_API ImGuiWindow
 {
@@ -1601,6 +1862,10 @@ struct IMGUI_API ImGuiWindow
     short                   BeginCount;                         // Number of Begin() during the current frame (generally 0 or 1, 1+ if appending via multiple Begin/End pairs)
     short                   BeginOrderWithinParent;             // Order within immediate parent window, if we are a child window. Otherwise 0.
     short                   BeginOrderWithinContext;            // Order within entire imgui context. This is mostly used for debugging submission order related issues.
+    short                   SortBeginOrderWithinParent;         // Value of BeginOrderWithinParent/ParentWindow/Active/Flags when g.Windows[] was last sorted by EndFrame().
+    ImGuiWindow*            SortParentWindow;                   // If none of those changed for any window, the order is unchanged and sorting is skipped.
+    ImGuiWindowFlags        SortFlags;
+    bool                    SortActive;
     ImGuiID                 PopupId;                            // ID in the popup stack when this window is used as a popup/menu (because we use generic Name/ID for recycling)
     ImS8                    AutoFitFramesX, AutoFitFramesY;
     ImS8                    AutoFitChildAxises;
@@ -1615,6 +1880,7 @@ struct IMGUI_API ImGuiWindow
     ImVec2                  SetWindowPosPivot;                  // store window pivot for positioning. ImVec2(0, 0) when positioning from top-left corner; ImVec2(0.5f, 0.5f) for centering; ImVec2(1, 1) for bottom right.
 
     ImVector<ImGuiID>       IDStack;                            // ID stack. ID are hashes seeded with the value at the top of the stack. (In theory this should be in the TempData structure)
+    ImGuiIDHashCache        IDHashCache;                        // Memo of GetID() results for labels, to avoid rehashing the same labels every frame
     ImGuiWindowTempData     DC;                                 // Temporary per-window data, reset at the beginning of the frame. This used to be called ImGuiDrawContext, hence the "DC" variable name.
 
     // The best way to understand what those rectangles are is to use the 'Metrics -> Tools -> Show windows rectangles' viewer.
@@ -1628,6 +1894,9 @@ struct IMGUI_API ImGuiWindow
     ImRect                  ContentRegionRect;                  // FIXME: This is currently confusing/misleading. It is essentially WorkRect but not handling of scrolling. We currently rely on it as right/bottom aligned sizing operation need some size to rely on.
     ImVec2ih                HitTestHoleSize;                    // Define an optional rectangular hole where mouse will pass-through the window.
     ImVec2ih                HitTestHoleOffset;
+    ImVec2ih                HitGridCellMin;                     // Range of g.WindowsHitGrid cells this window is registered in (none if Min > Max)
+    ImVec2ih                HitGridCellMax;
+    int                     HitGridOrder;                       // Index in g.Windows[], refreshed by FindHoveredWindow() when the order changed.
 
     int                     LastFrameActive;                    // Last frame number the window was Active.
     float                   LastTimeActive;                     // Last timestamp the window was Active (using float as we don't need high precision there)
@@ -1651,6 +1920,11 @@ struct IMGUI_API ImGuiWindow
     bool                    MemoryCompacted;                    // Set when window extraneous data have been garbage collected
     int                     MemoryDrawListIdxCapacity;          // Backup of last idx/vtx count, so when waking up the window we can preallocate and avoid iterative alloc/copy
     int                     MemoryDrawListVtxCapacity;
+    float                   MemoryDrawListIdxAverage;           // Moving average of idx/vtx count (over io.ConfigWindowsMemoryShrinkTimer), used to shrink buffers of active windows after a spike
+    float                   MemoryDrawListVtxAverage;
+    int                     MemoryDrawListIdxPeak;              // Peak idx/vtx count since last shrink check
+    int                     MemoryDrawListVtxPeak;
+    float                   MemoryShrinkTimer;                  // Time accumulated since last shrink check
 
 public:
     ImGuiWindow(ImGuiContext* context, const char* name);
@@ -1658,9 +1932,11 @@ public:
 
     ImGuiID     GetID(const char* str, const char* str_end = NULL);
     ImGuiID     GetID(const void* ptr);
+    ImGuiID     GetID(const ImGuiLabelHash& label);
     ImGuiID     GetID(int n);
     ImGuiID     GetIDNoKeepAlive(const char* str, const char* str_end = NULL);
     ImGuiID     GetIDNoKeepAlive(const void* ptr);
+    ImGuiID     GetIDNoKeepAlive(const ImGuiLabelHash& label);
     ImGuiID     GetIDNoKeepAlive(int n);
     ImGuiID     GetIDFromRectangle(const ImRect& r_abs);
 
@@ -1827,6 +2103,7 @@ namespace ImGui
     IMGUI_API ImGuiWindowSettings*  FindWindowSettings(ImGuiID id);
     IMGUI_API ImGuiWindowSettings*  FindOrCreateWindowSettings(const char* name);
     IMGUI_API ImGuiSettingsHandler* FindSettingsHandler(const char* type_name);
+    IMGUI_API void                  SettingsBinaryAppendEntry(ImGuiTextBuffer* buf, ImGuiSettingsHandler* handler, const char* name, const void* payload, size_t payload_size);
 
     // Scrolling
     IMGUI_API void          SetNextWindowScroll(const ImVec2& scroll); // Use -1.0f on one axis to leave as-is
@@ -1978,6 +2255,8 @@ namespace ImGui
     // Widgets
     IMGUI_API void          TextEx(const char* text, const char* text_end = NULL, ImGuiTextFlags flags = 0);
     IMGUI_API bool          ButtonEx(const char* label, const ImVec2& size_arg = ImVec2(0, 0), ImGuiButtonFlags flags = 0);
+    IMGUI_API bool          ButtonEx(ImGuiID id, const char* label, const ImVec2& size_arg, ImGuiButtonFlags flags);   // With an ID computed by the caller
+    IMGUI_API bool          CheckboxEx(ImGuiID id, const char* label, bool* v);
     IMGUI_API bool          CloseButton(ImGuiID id, const ImVec2& pos);
     IMGUI_API bool          CollapseButton(ImGuiID id, const ImVec2& pos);
     IMGUI_API bool          ArrowButtonEx(const char* str_id, ImGuiDir dir, ImVec2 size_arg, ImGuiButtonFlags flags = 0);
@@ -1988,6 +2267,7 @@ namespace ImGui
     IMGUI_API ImGuiID       GetWindowScrollbarID(ImGuiWindow* window, ImGuiAxis axis);
     IMGUI_API ImGuiID       GetWindowResizeID(ImGuiWindow* window, int n); // 0..3: corners, 4..7: borders
     IMGUI_API void          SeparatorEx(ImGuiSeparatorFlags flags);
+    IMGUI_API int           TypeAheadFindItem(int items_count, int current_item, bool (*items_getter)(void* data, int idx, const char** out_text), void* data); // Index of the item matching the characters typed in the current window, -1 if none
 
     // Widgets low-level behaviors
     IMGUI_API bool          ButtonBehavior(const ImRect& bb, ImGuiID id, bool* out_hovered, bool* out_held, ImGuiButtonFlags flags = 0);
@@ -1997,6 +2277,7 @@ namespace ImGui
     IMGUI_API bool          TreeNodeBehavior(ImGuiID id, ImGuiTreeNodeFlags flags, const char* label, const char* label_end = NULL);
     IMGUI_API bool          TreeNodeBehaviorIsOpen(ImGuiID id, ImGuiTreeNodeFlags flags = 0);                     // Consume previous SetNextItemOpen() data, if any. May return true when logging
     IMGUI_API void          TreePushOverrideID(ImGuiID id);
+    IMGUI_API bool          MultiSelectItemFooter(ImGuiID id, int item_idx, const ImRect& bb, bool pressed);   // Update the selection for an item submitted after SetNextItemSelectionIndex(). Return its selected state.
 
     // Template functions are instantiated in imgui_widgets.cpp for a finite number of types.
     // To use them externally (for custom widget) you may need an "extern template" statement in your code in order to link to existing instances and silence Clang warnings (see #2036).
@@ -2029,6 +2310,8 @@ namespace ImGui
 
     // Plot
     IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size);
+    IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotSource& source, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size);
+    IMGUI_API int           PlotEnvelopeEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotEnvelope* envelope, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size); // Return the number of pixel columns, -1 if clipped
 
     // Shade functions (write over already created vertices)
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
@@ -2037,6 +2320,8 @@ namespace ImGui
     // Garbage collection
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API size_t        GcShrinkTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API size_t        GcGetTransientWindowBuffersSize(ImGuiWindow* window);
 
     // Debug Tools
     inline void             DebugDrawItemRect(ImU32 col = IM_COL32(255,0,0,255))    { ImGuiContext& g = *GImGui; ImGuiWindow* window = g.CurrentWindow; GetForegroundDrawList(window)->AddRect(window->DC.LastItemRect.Min, window->DC.LastItemRect.Max, col); }
@@ -2050,6 +2335,8 @@ IMGUI_API void              ImFontAtlasBuildInit(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent);
 IMGUI_API void              ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque);
 IMGUI_API void              ImFontAtlasBuildFinish(ImFontAtlas* atlas);
+IMGUI_API ImU32             ImFontAtlasBuildCalcCacheKey(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasBuildLazyGlyphs(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasBuildRender1bppRectFromString(ImFontAtlas* atlas, int atlas_x, int atlas_y, int w, int h, const char* in_str, char in_marker_char, unsigned char in_marker_pixel_value);
 IMGUI_API void              ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void              ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
@@ -18,6 +18,7 @@ Index of this file:
 // [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
 // [SECTION] Widgets: TreeNode, CollapsingHeader, etc.
 // [SECTION] Widgets: Selectable
+// [SECTION] Widgets: Multi-select
 // [SECTION] Widgets: ListBox
 // [SECTION] Widgets: PlotLines, PlotHistogram
 // [SECTION] Widgets: Value helpers
@@ -81,6 +82,8 @@ Index of this file:
 // Data
 //-------------------------------------------------------------------------
 
+static const float          TYPE_AHEAD_TIMEOUT = 1.00f;    // Combo(), ListBox(): time after which typed characters start a new search
+
 // Those MIN/MAX values are not define because we need to point to them
 static const signed char    IM_S8_MIN  = -128;
 static const signed char    IM_S8_MAX  = 127;
@@ -115,7 +118,9 @@ static const ImU64          IM_U64_MAX = (2ULL * 9223372036854775807LL + 1);
 // For InputTextEx()
 static bool             InputTextFilterCharacter(unsigned int* p_char, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* user_data);
 static int              InputTextCalcTextLenAndLineCount(const char* text_begin, const char** out_text_end);
-static ImVec2           InputTextCalcTextSizeW(const ImWchar* text_begin, const ImWchar* text_end, const ImWchar** remaining = NULL, ImVec2* out_offset = NULL, bool stop_on_new_line = false);
+static ImVec2           InputTextCalcTextSize(const char* text_begin, const char* text_end, const char** remaining = NULL, ImVec2* out_offset = NULL, bool stop_on_new_line = false);
+static ImGuiInputTextLineCache* InputTextUpdateLineCache(ImGuiID id, const char* buf, int buf_size);
+static void             InputTextRenderVisibleLines(ImDrawList* draw_list, const ImRect& clip_rect, const ImVec2& pos, ImU32 col, const char* text, const ImGuiTextLineIndex& line_index, ImGuiInputTextState* state = NULL);
 
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Text, etc.
@@ -654,6 +659,15 @@ bool ImGui::ButtonBehavior(const ImRect& bb, ImGuiID id, bool* out_hovered, bool
 }
 
 bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return ButtonEx(window->GetID(label), label, size_arg, flags);
+}
+
+// Same as above with an ID computed by the caller, e.g. from a label hashed at compile-time with IM_LABEL()
+bool ImGui::ButtonEx(ImGuiID id, const char* label, const ImVec2& size_arg, ImGuiButtonFlags flags)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -661,7 +675,6 @@ bool ImGui::ButtonEx(const char* label, const ImVec2& size_arg, ImGuiButtonFlags
 
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
-    const ImGuiID id = window->GetID(label);
     const ImVec2 label_size = CalcTextSize(label, NULL, true);
 
     ImVec2 pos = window->DC.CursorPos;
@@ -709,6 +722,27 @@ bool ImGui::SmallButton(const char* label)
     return pressed;
 }
 
+bool ImGui::Button(const ImGuiLabelHash& label, const ImVec2& size_arg)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return ButtonEx(window->GetID(label), label.Label, size_arg, ImGuiButtonFlags_None);
+}
+
+bool ImGui::SmallButton(const ImGuiLabelHash& label)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    ImGuiContext& g = *GImGui;
+    float backup_padding_y = g.Style.FramePadding.y;
+    g.Style.FramePadding.y = 0.0f;
+    bool pressed = ButtonEx(window->GetID(label), label.Label, ImVec2(0, 0), ImGuiButtonFlags_AlignTextBaseLine);
+    g.Style.FramePadding.y = backup_padding_y;
+    return pressed;
+}
+
 // Tip: use ImGui::PushID()/PopID() to push indices or pointers in the ID stack.
 // Then you can keep 'str_id' empty or the same for all your buttons (instead of creating a string based on a non-string id)
 bool ImGui::InvisibleButton(const char* str_id, const ImVec2& size_arg, ImGuiButtonFlags flags)
@@ -1042,6 +1076,22 @@ bool ImGui::ImageButton(ImTextureID user_texture_id, const ImVec2& size, const I
 }
 
 bool ImGui::Checkbox(const char* label, bool* v)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return CheckboxEx(window->GetID(label), label, v);
+}
+
+bool ImGui::Checkbox(const ImGuiLabelHash& label, bool* v)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return CheckboxEx(window->GetID(label), label.Label, v);
+}
+
+bool ImGui::CheckboxEx(ImGuiID id, const char* label, bool* v)
 {
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
@@ -1049,7 +1099,6 @@ bool ImGui::Checkbox(const char* label, bool* v)
 
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
-    const ImGuiID id = window->GetID(label);
     const ImVec2 label_size = CalcTextSize(label, NULL, true);
 
     const float square_sz = GetFrameHeight();
@@ -1485,6 +1534,7 @@ void ImGui::ShrinkWidths(ImGuiShrinkWidthItem* items, int count, float width_exc
 //-------------------------------------------------------------------------
 // - BeginCombo()
 // - EndCombo()
+// - TypeAheadFindItem() [Internal]
 // - Combo()
 //-------------------------------------------------------------------------
 
@@ -1618,25 +1668,132 @@ static bool Items_ArrayGetter(void* data, int idx, const char** out_text)
     return true;
 }
 
-// Getter for the old Combo() API: "item1\0item2\0item3\0"
-static bool Items_SingleStringGetter(void* data, int idx, const char** out_text)
+// Find item 'idx' in a "item1\0item2\0item3\0" string. Return NULL if there are not enough items.
+static const char* Items_SingleStringFind(const char* items_separated_by_zeros, int idx)
 {
-    // FIXME-OPT: we could pre-compute the indices to fasten this. But only 1 active combo means the waste is limited.
-    const char* items_separated_by_zeros = (const char*)data;
-    int items_count = 0;
     const char* p = items_separated_by_zeros;
-    while (*p)
+    for (int n = 0; *p; n++)
     {
-        if (idx == items_count)
-            break;
+        if (n == idx)
+            return p;
         p += strlen(p) + 1;
-        items_count++;
     }
-    if (!*p)
-        return false;
-    if (out_text)
-        *out_text = p;
-    return true;
+    return NULL;
+}
+
+// Find the next item whose text starts with the characters typed in the current window, for Combo() and ListBox().
+// Typing a character again (e.g. "aaa") cycles through the items starting with it, otherwise the current item is kept as long as it matches.
+// Searching is O(items_count) but only happens on the frames where characters are typed.
+int ImGui::TypeAheadFindItem(int items_count, int current_item, bool (*items_getter)(void*, int, const char**), void* data)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    if (window->Appearing && g.TypeAheadWindowId == window->ID) // Combo popups are recycled
+        g.TypeAheadWindowId = 0;
+    if (g.IO.InputQueueCharacters.Size == 0 || g.NavWindow != window || g.ActiveId != 0 || g.IO.KeyCtrl || g.IO.KeyAlt || g.IO.KeySuper || items_count <= 0)
+        return -1;
+
+    // Append typed characters to the search buffer, restarting the search after a pause
+    char* buf = g.TypeAheadBuf;
+    int buf_len = (g.TypeAheadWindowId == window->ID && g.Time - g.TypeAheadTime <= TYPE_AHEAD_TIMEOUT) ? (int)strlen(buf) : 0;
+    const int buf_len_prev = buf_len;
+    for (int n = 0; n < g.IO.InputQueueCharacters.Size; n++)
+    {
+        const unsigned int c = (unsigned int)g.IO.InputQueueCharacters[n];
+        if (c < 0x20 || c == 0x7F || (c == ' ' && buf_len == 0))
+            continue;
+        char c_utf8[5];
+        const int c_len = ImTextCharToUtf8(c_utf8, IM_ARRAYSIZE(c_utf8), c);
+        if (buf_len + c_len >= IM_ARRAYSIZE(g.TypeAheadBuf))
+            break;
+        memcpy(buf + buf_len, c_utf8, (size_t)c_len);
+        buf_len += c_len;
+    }
+    buf[buf_len] = 0;
+    if (buf_len == buf_len_prev)
+        return -1;
+    g.TypeAheadWindowId = window->ID;
+    g.TypeAheadTime = g.Time;
+
+    // Same character typed repeatedly: search for that character only, starting after the current item
+    unsigned int c0;
+    const int c0_len = ImTextCharFromUtf8(&c0, buf, buf + buf_len);
+    bool cycle = (buf_len % c0_len) == 0;
+    for (int n = c0_len; n < buf_len && cycle; n += c0_len)
+        cycle = (ImStrnicmp(buf + n, buf, (size_t)c0_len) == 0);
+    const int match_len = cycle ? c0_len : buf_len;
+    const int search_start = (current_item < 0 || current_item >= items_count) ? 0 : cycle ? current_item + 1 : current_item;
+    for (int n = 0; n < items_count; n++)
+    {
+        const int idx = (search_start + n) % items_count;
+        const char* item_text;
+        if (items_getter(data, idx, &item_text) && ImStrnicmp(item_text, buf, (size_t)match_len) == 0)
+            return idx;
+    }
+    return -1;
+}
+
+// Item to start the next type-ahead search from: the last match while it has keyboard focus, otherwise the current item
+static int TypeAheadGetSearchItem(int current_item)
+{
+    ImGuiContext& g = *GImGui;
+    if (g.NavWindow == g.CurrentWindow && g.NavId != 0 && g.NavId == g.TypeAheadItemId)
+        return g.TypeAheadItem;
+    return current_item;
+}
+
+// Move keyboard focus to the last item and scroll to it, following a TypeAheadFindItem() match
+static void TypeAheadFocusLastItem(int item_idx)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGui::SetFocusID(window->DC.LastItemId, window);
+    g.NavDisableHighlight = false;
+    g.NavDisableMouseHover = g.NavMousePosDirty = true;
+    ImGui::ScrollToBringRectIntoView(window, window->DC.LastItemRect);
+    g.TypeAheadItem = item_idx;
+    g.TypeAheadItemId = window->DC.LastItemId;
+}
+
+// Display the items of a Combo() popup, using the clipper so the cost doesn't depend on the number of items.
+// The current item is always submitted on the appearing frame so SetItemDefaultFocus() can focus and scroll to it.
+static bool ComboItems(int* current_item, bool (*items_getter)(void*, int, const char**), void* data, int items_count)
+{
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    const int type_ahead_item = ImGui::TypeAheadFindItem(items_count, TypeAheadGetSearchItem(*current_item), items_getter, data);
+    bool value_changed = false;
+    ImGuiListClipper clipper;
+    clipper.Begin(items_count, ImGui::GetTextLineHeightWithSpacing());
+    if (window->Appearing)
+        clipper.ForceDisplayRangeByIndices(*current_item, *current_item + 1);
+    if (type_ahead_item >= 0)
+        clipper.ForceDisplayRangeByIndices(type_ahead_item, type_ahead_item + 1);
+    while (clipper.Step())
+        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+        {
+            ImGui::PushID((void*)(intptr_t)i);
+            const bool item_selected = (i == *current_item);
+            const char* item_text;
+            if (!items_getter(data, i, &item_text))
+                item_text = "*Unknown item*";
+            if (ImGui::Selectable(item_text, item_selected))
+            {
+                value_changed = true;
+                *current_item = i;
+            }
+            if (item_selected)
+                ImGui::SetItemDefaultFocus();
+            if (i == type_ahead_item)
+                TypeAheadFocusLastItem(i);
+            ImGui::PopID();
+        }
+
+    // Only the visible items contribute to the width of the popup: don't let it shrink while scrolling
+    if (!window->Appearing)
+        window->DC.CursorMaxPos.x = ImMax(window->DC.CursorMaxPos.x, window->DC.CursorStartPos.x + window->ContentSize.x);
+
+    ImGui::EndCombo();
+    return value_changed;
 }
 
 // Old API, prefer using BeginCombo() nowadays if you can.
@@ -1656,28 +1813,7 @@ bool ImGui::Combo(const char* label, int* current_item, bool (*items_getter)(voi
     if (!BeginCombo(label, preview_value, ImGuiComboFlags_None))
         return false;
 
-    // Display items
-    // FIXME-OPT: Use clipper (but we need to disable it on the appearing frame to make sure our call to SetItemDefaultFocus() is processed)
-    bool value_changed = false;
-    for (int i = 0; i < items_count; i++)
-    {
-        PushID((void*)(intptr_t)i);
-        const bool item_selected = (i == *current_item);
-        const char* item_text;
-        if (!items_getter(data, i, &item_text))
-            item_text = "*Unknown item*";
-        if (Selectable(item_text, item_selected))
-        {
-            value_changed = true;
-            *current_item = i;
-        }
-        if (item_selected)
-            SetItemDefaultFocus();
-        PopID();
-    }
-
-    EndCombo();
-    return value_changed;
+    return ComboItems(current_item, items_getter, data, items_count);
 }
 
 // Combo box helper allowing to pass an array of strings.
@@ -1688,17 +1824,22 @@ bool ImGui::Combo(const char* label, int* current_item, const char* const items[
 }
 
 // Combo box helper allowing to pass all items in a single string literal holding multiple zero-terminated items "item1\0item2\0"
+// While closed, only the preview item is looked up. While open, the items are indexed once per frame into g.ComboStringItems[].
 bool ImGui::Combo(const char* label, int* current_item, const char* items_separated_by_zeros, int height_in_items)
 {
-    int items_count = 0;
-    const char* p = items_separated_by_zeros;       // FIXME-OPT: Avoid computing this, or at least only when combo is open
-    while (*p)
-    {
-        p += strlen(p) + 1;
-        items_count++;
-    }
-    bool value_changed = Combo(label, current_item, Items_SingleStringGetter, (void*)items_separated_by_zeros, items_count, height_in_items);
-    return value_changed;
+    ImGuiContext& g = *GImGui;
+    const char* preview_value = (*current_item >= 0) ? Items_SingleStringFind(items_separated_by_zeros, *current_item) : NULL;
+    if (height_in_items != -1 && !(g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasSizeConstraint))
+        SetNextWindowSizeConstraints(ImVec2(0, 0), ImVec2(FLT_MAX, CalcMaxPopupHeightFromItemCount(height_in_items)));
+    if (!BeginCombo(label, preview_value, ImGuiComboFlags_None))
+        return false;
+
+    // The string may change from frame to frame at the same address, so we don't keep the index across frames
+    ImVector<const char*>& items = g.ComboStringItems;
+    items.resize(0);
+    for (const char* p = items_separated_by_zeros; *p; p += strlen(p) + 1)
+        items.push_back(p);
+    return ComboItems(current_item, Items_ArrayGetter, (void*)items.Data, items.Size);
 }
 
 //-------------------------------------------------------------------------
@@ -3454,19 +3595,77 @@ bool ImGui::InputTextWithHint(const char* label, const char* hint, char* buf, si
 
 static int InputTextCalcTextLenAndLineCount(const char* text_begin, const char** out_text_end)
 {
-    int line_count = 0;
-    const char* s = text_begin;
-    while (char c = *s++) // We are only matching for \n so we can ignore UTF-8 decoding
-        if (c == '\n')
-            line_count++;
-    s--;
-    if (s[0] != '\n' && s[0] != '\r')
+    int line_count = 1;
+    const char* text_end = text_begin + strlen(text_begin);
+    for (const char* s = text_begin; (s = (const char*)memchr(s, '\n', (size_t)(text_end - s))) != NULL; s++) // We are only matching for \n so we can ignore UTF-8 decoding
         line_count++;
-    *out_text_end = s;
+    *out_text_end = text_end;
     return line_count;
 }
 
-static ImVec2 InputTextCalcTextSizeW(const ImWchar* text_begin, const ImWchar* text_end, const ImWchar** remaining, ImVec2* out_offset, bool stop_on_new_line)
+static ImGuiInputTextLineCache* InputTextFindLineCache(ImGuiID id)
+{
+    ImGuiContext& g = *GImGui;
+    for (int n = 0; n < g.InputTextLineCaches.Size; n++)
+        if (g.InputTextLineCaches[n]->ID == id)
+            return g.InputTextLineCaches[n];
+    return NULL;
+}
+
+// Update the line index kept between frames for an inactive InputTextMultiline() using ImGuiInputTextFlags_RetainLineIndex.
+// Only the text appended since last frame is scanned: other modifications of the buffer are not detected.
+static ImGuiInputTextLineCache* InputTextUpdateLineCache(ImGuiID id, const char* buf, int buf_size)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiInputTextLineCache* cache = InputTextFindLineCache(id);
+    if (cache == NULL)
+    {
+        cache = IM_NEW(ImGuiInputTextLineCache)();
+        cache->ID = id;
+        g.InputTextLineCaches.push_back(cache);
+    }
+    cache->LastTimeUsed = (float)g.Time;
+
+    ImGuiInputTextState* state = &g.InputTextState;
+    if (cache->EditedByWidget && state->ID == id && state->CurLenA < buf_size)
+    {
+        // The widget copied its edit buffer into 'buf' when it was last edited, its index is up to date
+        cache->LineIndex = state->LineIndex;
+        cache->Buf = buf;
+        cache->TextLen = state->CurLenA;
+    }
+    else if (cache->EditedByWidget || cache->Buf != buf || cache->TextLen < 0 || cache->TextLen >= buf_size)
+    {
+        cache->Buf = buf;
+        cache->TextLen = (int)strlen(buf);
+        cache->LineIndex.Build(buf, cache->TextLen);
+    }
+    cache->EditedByWidget = false;
+
+    if (buf[cache->TextLen] != 0)
+    {
+        const int appended_len = (int)strlen(buf + cache->TextLen);
+        cache->LineIndex.OnInsertChars(cache->TextLen, buf + cache->TextLen, appended_len);
+        cache->TextLen += appended_len;
+    }
+    return cache;
+}
+
+// Render the lines of an indexed multi-line text which overlap 'clip_rect'. Read the text from the edit buffer of 'state' if provided.
+static void InputTextRenderVisibleLines(ImDrawList* draw_list, const ImRect& clip_rect, const ImVec2& pos, ImU32 col, const char* text, const ImGuiTextLineIndex& line_index, ImGuiInputTextState* state)
+{
+    ImGuiContext& g = *GImGui;
+    const int line_count = line_index.GetLineCount();
+    const int line_first = ImClamp((int)((clip_rect.Min.y - pos.y) / g.FontSize), 0, line_count - 1);
+    const int line_last = ImClamp((int)((clip_rect.Max.y - pos.y) / g.FontSize), line_first, line_count - 1);
+    const int text_begin = line_index.GetLineStart(line_first);
+    const int text_end = line_index.GetLineEnd(line_last);
+    if (state)
+        text = state->GetTextRange(text_begin, text_end);
+    draw_list->AddText(g.Font, g.FontSize, ImVec2(pos.x, pos.y + line_first * g.FontSize), col, text + text_begin, text + text_end);
+}
+
+static ImVec2 InputTextCalcTextSize(const char* text_begin, const char* text_end, const char** remaining, ImVec2* out_offset, bool stop_on_new_line)
 {
     ImGuiContext& g = *GImGui;
     ImFont* font = g.Font;
@@ -3476,10 +3675,14 @@ static ImVec2 InputTextCalcTextSizeW(const ImWchar* text_begin, const ImWchar* t
     ImVec2 text_size = ImVec2(0, 0);
     float line_width = 0.0f;
 
-    const ImWchar* s = text_begin;
+    const char* s = text_begin;
     while (s < text_end)
     {
-        unsigned int c = (unsigned int)(*s++);
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImMax(ImTextCharFromUtf8(&c, s, text_end), 1);
         if (c == '\n')
         {
             text_size.x = ImMax(text_size.x, line_width);
@@ -3511,84 +3714,412 @@ static ImVec2 InputTextCalcTextSizeW(const ImWchar* text_begin, const ImWchar* t
     return text_size;
 }
 
-// Wrapper for stb_textedit.h to edit text (our wrapper is for: statically sized buffer, single-line, wchar characters. InputText converts between UTF-8 and wchar)
+// Length of the well-formed UTF-8 sequence starting at 's' (RFC 3629, any code point up to U+10FFFF), 0 if malformed.
+// This doesn't depend on IM_UNICODE_CODEPOINT_MAX: the edit buffer keeps characters which don't fit in ImWchar as they are.
+static int InputTextUtf8SequenceLen(const char* s, const char* s_end)
+{
+    const unsigned int c = (unsigned char)s[0];
+    if (c < 0x80)
+        return 1;
+    int len;
+    unsigned int c1_min = 0x80, c1_max = 0xBF;
+    if (c >= 0xC2 && c <= 0xDF)         { len = 2; }
+    else if (c >= 0xE0 && c <= 0xEF)    { len = 3; if (c == 0xE0) c1_min = 0xA0; else if (c == 0xED) c1_max = 0x9F; }   // Overlong, surrogates
+    else if (c >= 0xF0 && c <= 0xF4)    { len = 4; if (c == 0xF0) c1_min = 0x90; else if (c == 0xF4) c1_max = 0x8F; }   // Overlong, > U+10FFFF
+    else                                return 0;
+    if (s_end - s < len)
+        return 0;
+    const unsigned int c1 = (unsigned char)s[1];
+    if (c1 < c1_min || c1 > c1_max)
+        return 0;
+    for (int i = 2; i < len; i++)
+        if (((unsigned char)s[i] & 0xC0) != 0x80)
+            return 0;
+    return len;
+}
+
+// Return the length of the longest prefix of 'text' which is well-formed UTF-8.
+static int InputTextCalcValidUtf8Len(const char* text, int text_len)
+{
+    const char* text_end = text + text_len;
+    for (const char* s = text; s < text_end; )
+    {
+        // Skip ASCII 8 bytes at a time, large buffers are validated on activation
+        ImU64 ascii8;
+        if (text_end - s >= 8 && (memcpy(&ascii8, s, 8), (ascii8 & 0x8080808080808080ULL) == 0))
+        {
+            s += 8;
+            continue;
+        }
+        const int n = InputTextUtf8SequenceLen(s, text_end);
+        if (n == 0)
+            return (int)(s - text);
+        s += n;
+    }
+    return text_len;
+}
+
+// The edit buffer only ever holds whole characters. Return 'text' when it is well-formed UTF-8 (the common case), otherwise a copy in 'out'
+// where each byte which doesn't start a well-formed sequence is replaced with U+FFFD, truncated to 'max_len' bytes on a character boundary.
+// On return, *io_len is the length of the returned text and *out_valid_len the length of the prefix which was left untouched.
+static const char* InputTextSanitizeUtf8(const char* text, int* io_len, int max_len, ImVector<char>* out, int* out_valid_len)
+{
+    const int text_len = *io_len;
+    const int valid_len = InputTextCalcValidUtf8Len(text, ImMin(text_len, max_len));
+    *out_valid_len = valid_len;
+    if (valid_len == text_len)
+        return text;
+
+    out->resize(0);
+    out->reserve(ImMin(text_len + 16, max_len));
+    out->resize(valid_len);
+    memcpy(out->Data, text, (size_t)valid_len);
+    const char* text_end = text + text_len;
+    for (const char* s = text + valid_len; s < text_end; )
+    {
+        int n = InputTextUtf8SequenceLen(s, text_end);
+        const char* seq = s;
+        s += ImMax(n, 1);
+        if (n == 0)
+        {
+            seq = "\xEF\xBF\xBD";
+            n = 3;
+        }
+        if (out->Size + n > max_len)
+            break;
+        for (int i = 0; i < n; i++)
+            out->push_back(seq[i]);
+    }
+    *io_len = out->Size;
+    return out->Data;
+}
+
+// Compare the text of the edit buffer with the zero-terminated 'buf', reading both sides of the gap in place rather than moving it
+static bool InputTextBufferEquals(const ImGuiInputTextState* state, const char* buf, int buf_size)
+{
+    const int text_len = state->CurLenA;
+    const int gap_pos = state->GapPos;
+    if (text_len >= buf_size || buf[text_len] != 0)
+        return false;
+    const char* text = state->TextA.Data;
+    return memcmp(buf, text, (size_t)gap_pos) == 0 && memcmp(buf + gap_pos, text + gap_pos + state->GetGapLen(), (size_t)(text_len - gap_pos)) == 0;
+}
+
+// Copy the text of the edit buffer to 'buf', truncated to buf_size - 1 bytes and zero-terminated, without moving the gap
+static void InputTextCopyToBuffer(const ImGuiInputTextState* state, char* buf, int buf_size)
+{
+    if (buf_size <= 0)
+        return;
+    const int copy_len = ImMin(state->CurLenA, buf_size - 1);
+    const int before_gap_len = ImMin(copy_len, state->GapPos);
+    memcpy(buf, state->TextA.Data, (size_t)before_gap_len);
+    memcpy(buf + before_gap_len, state->TextA.Data + state->GapPos + state->GetGapLen(), (size_t)(copy_len - before_gap_len));
+    buf[copy_len] = 0;
+}
+
+void ImGuiTextLineIndex::Build(const char* text, int text_len)
+{
+    Starts.resize(0);
+    Starts.push_back(0);
+    for (const char* s = text; (s = (const char*)memchr(s, '\n', (size_t)(text + text_len - s))) != NULL; )
+        Starts.push_back((int)(++s - text));
+    Widths.resize(Starts.Size);
+    for (int n = 0; n < Widths.Size; n++)
+        Widths[n] = -1.0f;
+    LineCount = GapLine = Starts.Size;
+    TextLen = text_len;
+}
+
+int ImGuiTextLineIndex::FindLine(int pos) const
+{
+    IM_ASSERT(LineCount > 0);
+    int lo = 0, hi = LineCount - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) >> 1;
+        if (GetLineStart(mid) <= pos)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+// Move the gap before 'line', converting the entries we move over
+void ImGuiTextLineIndex::MoveGap(int line)
+{
+    const int gap_len = Starts.Size - LineCount;
+    for (; GapLine < line; GapLine++)
+    {
+        Starts[GapLine] = TextLen - Starts[GapLine + gap_len];
+        Widths[GapLine] = Widths[GapLine + gap_len];
+    }
+    for (; GapLine > line; GapLine--)
+    {
+        Starts[GapLine - 1 + gap_len] = TextLen - Starts[GapLine - 1];
+        Widths[GapLine - 1 + gap_len] = Widths[GapLine - 1];
+    }
+}
+
+void ImGuiTextLineIndex::OnInsertChars(int pos, const char* new_text, int new_text_len)
+{
+    // Lines after the edited one are stored after the gap: they don't need to be offset
+    const int line = FindLine(pos);
+    MoveGap(line + 1);
+    Widths[line] = -1.0f;
+    TextLen += new_text_len;
+
+    // Add a line start before the gap for each '\n' of the inserted text
+    int new_lines = 0;
+    for (const char* s = new_text; (s = (const char*)memchr(s, '\n', (size_t)(new_text + new_text_len - s))) != NULL; s++)
+        new_lines++;
+    if (new_lines == 0)
+        return;
+    const int gap_len = Starts.Size - LineCount;
+    if (gap_len < new_lines)
+    {
+        // Grow the gap
+        const int after_gap_count = LineCount - GapLine;
+        const int new_size = ImMax(LineCount + new_lines, Starts.Size + Starts.Size / 2); // Based on Size, not Capacity, which Build() keeps
+        Starts.resize(new_size);
+        Widths.resize(new_size);
+        memmove(Starts.Data + new_size - after_gap_count, Starts.Data + GapLine + gap_len, (size_t)after_gap_count * sizeof(int));
+        memmove(Widths.Data + new_size - after_gap_count, Widths.Data + GapLine + gap_len, (size_t)after_gap_count * sizeof(float));
+    }
+    for (const char* s = new_text; (s = (const char*)memchr(s, '\n', (size_t)(new_text + new_text_len - s))) != NULL; GapLine++)
+    {
+        Starts[GapLine] = pos + (int)(++s - new_text);
+        Widths[GapLine] = -1.0f;
+    }
+    LineCount += new_lines;
+}
+
+void ImGuiTextLineIndex::OnDeleteChars(int pos, int len)
+{
+    // Lines starting within (pos, pos+len] had their '\n' deleted: they are the first entries after the gap
+    const int line = FindLine(pos);
+    const int removed = FindLine(pos + len) - line;
+    MoveGap(line + 1);
+    Widths[line] = -1.0f;
+    LineCount -= removed;
+    TextLen -= len;
+}
+
+float ImGuiTextLineIndex::GetLineWidth(int line, const char* text)
+{
+    ImGuiContext& g = *GImGui;
+    if (WidthsFont != g.Font || WidthsFontSize != g.FontSize)
+    {
+        WidthsFont = g.Font;
+        WidthsFontSize = g.FontSize;
+        for (int n = 0; n < Widths.Size; n++)
+            Widths[n] = -1.0f;
+    }
+    float& w = Widths[(line < GapLine) ? line : line + Starts.Size - LineCount];
+    if (w < 0.0f)
+        w = InputTextCalcTextSize(text + GetLineStart(line), text + GetLineEnd(line), NULL, NULL, true).x;
+    return w;
+}
+
+const char* ImGuiInputTextState::GetTextRange(int begin, int end)
+{
+    if (begin < GapPos && GapPos < end)
+        MoveGap((GapPos - begin < end - GapPos) ? begin : end);
+    return (GapPos <= begin && begin < end) ? TextA.Data + GetGapLen() : TextA.Data;
+}
+
+void ImGuiInputTextState::SetText(const char* text, int text_len)
+{
+    if (TextA.Size < text_len + 1)
+        TextA.resize(text_len + 1);
+    memcpy(TextA.Data, text, (size_t)text_len);
+    TextA[text_len] = 0;
+    TextA[TextA.Size - 1] = 0;
+    CurLenA = GapPos = text_len;
+    LineIndex.Build(TextA.Data, text_len);
+    MarkBufDirty(0, 0);
+}
+
+void ImGuiInputTextState::UpdateCallbackTextBackup()
+{
+    IM_ASSERT(GapPos == CurLenA);
+    const int old_len = CallbackTextBackup.Size - 1;
+    if (old_len < 0)
+    {
+        CallbackTextBackup.resize(CurLenA + 1);
+        memcpy(CallbackTextBackup.Data, TextA.Data, (size_t)CurLenA);
+    }
+    else if (CallbackTextBackupDirtyBegin >= 0)
+    {
+        // Same as the incremental copy to the end-user buffer: move the unmodified tail in place, copy the modified range
+        const int begin = CallbackTextBackupDirtyBegin;
+        const int tail = CallbackTextBackupDirtyTail;
+        if (CurLenA > old_len)
+            CallbackTextBackup.resize(CurLenA + 1);
+        if (CurLenA != old_len)
+            memmove(CallbackTextBackup.Data + CurLenA - tail, CallbackTextBackup.Data + old_len - tail, (size_t)tail);
+        memcpy(CallbackTextBackup.Data + begin, TextA.Data + begin, (size_t)(CurLenA - tail - begin));
+        CallbackTextBackup.resize(CurLenA + 1);
+    }
+    CallbackTextBackup[CurLenA] = 0;
+    CallbackTextBackupDirtyBegin = -1;
+}
+
+void ImGuiInputTextState::MoveGap(int pos)
+{
+    IM_ASSERT(pos >= 0 && pos <= CurLenA);
+    const int gap_len = GetGapLen();
+    if (pos < GapPos)
+        memmove(TextA.Data + pos + gap_len, TextA.Data + pos, (size_t)(GapPos - pos));
+    else if (pos > GapPos)
+        memmove(TextA.Data + GapPos, TextA.Data + GapPos + gap_len, (size_t)(pos - GapPos));
+    GapPos = pos;
+    if (gap_len > 0)
+        TextA[GapPos] = 0; // So GetText() is zero-terminated when the gap is at the end
+}
+
+// Wrapper for stb_textedit.h to edit text (our wrapper is for: statically sized buffer, single-line, UTF-8 characters)
+// Indices passed to and from stb_textedit are byte offsets in the UTF-8 buffer: we provide the functions to step over whole characters.
 namespace ImStb
 {
 
-static int     STB_TEXTEDIT_STRINGLEN(const STB_TEXTEDIT_STRING* obj)                             { return obj->CurLenW; }
-static ImWchar STB_TEXTEDIT_GETCHAR(const STB_TEXTEDIT_STRING* obj, int idx)                      { return obj->TextW[idx]; }
-static float   STB_TEXTEDIT_GETWIDTH(STB_TEXTEDIT_STRING* obj, int line_start_idx, int char_idx)  { ImWchar c = obj->TextW[line_start_idx + char_idx]; if (c == '\n') return STB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *GImGui; return g.Font->GetCharAdvance(c) * (g.FontSize / g.Font->FontSize); }
-static int     STB_TEXTEDIT_KEYTOTEXT(int key)                                                    { return key >= 0x200000 ? 0 : key; }
-static ImWchar STB_TEXTEDIT_NEWLINE = '\n';
+// Decode the character at 'idx' without moving the gap of the edit buffer
+static int     InputTextGetCharAt(const STB_TEXTEDIT_STRING* obj, int idx, unsigned int* out_char)
+{
+    char s[4];
+    const int n = ImMin(obj->CurLenA - idx, 4);
+    for (int i = 0; i < n; i++)
+        s[i] = obj->GetChar(idx + i);
+    return ImTextCharFromUtf8(out_char, s, s + n);
+}
+
+static int     STB_TEXTEDIT_STRINGLEN(const STB_TEXTEDIT_STRING* obj)                             { return obj->CurLenA; }
+static char    STB_TEXTEDIT_GETCHAR(const STB_TEXTEDIT_STRING* obj, int idx)                      { return obj->GetChar(idx); }
+static float   STB_TEXTEDIT_GETWIDTH(STB_TEXTEDIT_STRING* obj, int line_start_idx, int char_idx)
+{
+    const char first_byte = obj->GetChar(line_start_idx + char_idx);
+    if ((first_byte & 0xC0) == 0x80)
+        return 0.0f; // Not the first byte of a character
+    if (first_byte == '\n')
+        return STB_TEXTEDIT_GETWIDTH_NEWLINE;
+    unsigned int c;
+    InputTextGetCharAt(obj, line_start_idx + char_idx, &c);
+    ImGuiContext& g = *GImGui;
+    return g.Font->GetCharAdvance((ImWchar)c) * (g.FontSize / g.Font->FontSize);
+}
+static int     STB_TEXTEDIT_KEYTOTEXT(int key)                                                    { return key >= 0x80 ? 0 : key; } // Non-ASCII characters are inserted with OnCharPressed()
+static char    STB_TEXTEDIT_NEWLINE = '\n';
 static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, STB_TEXTEDIT_STRING* obj, int line_start_idx)
 {
-    const ImWchar* text = obj->TextW.Data;
-    const ImWchar* text_remaining = NULL;
-    const ImVec2 size = InputTextCalcTextSizeW(text + line_start_idx, text + obj->CurLenW, &text_remaining, NULL, true);
+    ImGuiContext& g = *GImGui;
+    ImGuiTextLineIndex* line_index = &obj->LineIndex;
+    const int line = line_index->FindLine(line_start_idx);
+    const int line_end = line_index->GetLineEnd(line);
+    const char* text = obj->GetTextRange(line_start_idx, line_end);
     r->x0 = 0.0f;
-    r->x1 = size.x;
-    r->baseline_y_delta = size.y;
+    if (line_index->GetLineStart(line) == line_start_idx)
+        r->x1 = line_index->GetLineWidth(line, text);
+    else
+        r->x1 = InputTextCalcTextSize(text + line_start_idx, text + line_end, NULL, NULL, true).x;
+    r->baseline_y_delta = g.FontSize;
     r->ymin = 0.0f;
-    r->ymax = size.y;
-    r->num_chars = (int)(text_remaining - (text + line_start_idx));
+    r->ymax = g.FontSize;
+    r->num_chars = ImMin(line_end + 1, obj->CurLenA) - line_start_idx;
+}
+
+static int STB_TEXTEDIT_GETNEXTCHARINDEX_IMPL(STB_TEXTEDIT_STRING* obj, int idx)
+{
+    if (idx >= obj->CurLenA)
+        return idx + 1;
+    unsigned int c;
+    return idx + ImMax(InputTextGetCharAt(obj, idx, &c), 1);
+}
+
+static int STB_TEXTEDIT_GETPREVCHARINDEX_IMPL(STB_TEXTEDIT_STRING* obj, int idx)
+{
+    idx--;
+    while (idx > 0 && (obj->GetChar(idx) & 0xC0) == 0x80)
+        idx--;
+    return idx;
+}
+
+static void STB_TEXTEDIT_SEEKROW_BY_Y_IMPL(STB_TEXTEDIT_STRING* obj, float y, int* row_start, float* row_y)
+{
+    ImGuiContext& g = *GImGui;
+    const int line = ImClamp((int)(y / g.FontSize), 0, obj->LineIndex.GetLineCount() - 1);
+    *row_start = obj->LineIndex.GetLineStart(line);
+    *row_y = line * g.FontSize;
+}
+
+static void STB_TEXTEDIT_SEEKROW_BY_CHAR_IMPL(STB_TEXTEDIT_STRING* obj, int n, int* row_start, int* prev_row_start, float* row_y)
+{
+    ImGuiContext& g = *GImGui;
+    const int line = obj->LineIndex.FindLine(n);
+    *row_start = obj->LineIndex.GetLineStart(line);
+    *prev_row_start = (line > 0) ? obj->LineIndex.GetLineStart(line - 1) : 0;
+    *row_y = line * g.FontSize;
 }
 
+#define STB_TEXTEDIT_GETNEXTCHARINDEX   STB_TEXTEDIT_GETNEXTCHARINDEX_IMPL
+#define STB_TEXTEDIT_GETPREVCHARINDEX   STB_TEXTEDIT_GETPREVCHARINDEX_IMPL
+#define STB_TEXTEDIT_SEEKROW_BY_Y       STB_TEXTEDIT_SEEKROW_BY_Y_IMPL
+#define STB_TEXTEDIT_SEEKROW_BY_CHAR    STB_TEXTEDIT_SEEKROW_BY_CHAR_IMPL
+
+static unsigned int get_char_at(STB_TEXTEDIT_STRING* obj, int idx)              { unsigned int c = 0; if (idx < obj->CurLenA) InputTextGetCharAt(obj, idx, &c); return c; }
 static bool is_separator(unsigned int c)                                        { return ImCharIsBlankW(c) || c==',' || c==';' || c=='(' || c==')' || c=='{' || c=='}' || c=='[' || c==']' || c=='|'; }
-static int  is_word_boundary_from_right(STB_TEXTEDIT_STRING* obj, int idx)      { return idx > 0 ? (is_separator(obj->TextW[idx - 1]) && !is_separator(obj->TextW[idx]) ) : 1; }
-static int  STB_TEXTEDIT_MOVEWORDLEFT_IMPL(STB_TEXTEDIT_STRING* obj, int idx)   { idx--; while (idx >= 0 && !is_word_boundary_from_right(obj, idx)) idx--; return idx < 0 ? 0 : idx; }
+static int  is_word_boundary_from_right(STB_TEXTEDIT_STRING* obj, int idx)      { return idx > 0 ? (is_separator(get_char_at(obj, STB_TEXTEDIT_GETPREVCHARINDEX(obj, idx))) && !is_separator(get_char_at(obj, idx)) ) : 1; }
+static int  STB_TEXTEDIT_MOVEWORDLEFT_IMPL(STB_TEXTEDIT_STRING* obj, int idx)   { idx = STB_TEXTEDIT_GETPREVCHARINDEX(obj, idx); while (idx >= 0 && !is_word_boundary_from_right(obj, idx)) idx = STB_TEXTEDIT_GETPREVCHARINDEX(obj, idx); return idx < 0 ? 0 : idx; }
 #ifdef __APPLE__    // FIXME: Move setting to IO structure
-static int  is_word_boundary_from_left(STB_TEXTEDIT_STRING* obj, int idx)       { return idx > 0 ? (!is_separator(obj->TextW[idx - 1]) && is_separator(obj->TextW[idx]) ) : 1; }
-static int  STB_TEXTEDIT_MOVEWORDRIGHT_IMPL(STB_TEXTEDIT_STRING* obj, int idx)  { idx++; int len = obj->CurLenW; while (idx < len && !is_word_boundary_from_left(obj, idx)) idx++; return idx > len ? len : idx; }
+static int  is_word_boundary_from_left(STB_TEXTEDIT_STRING* obj, int idx)       { return idx > 0 ? (!is_separator(get_char_at(obj, STB_TEXTEDIT_GETPREVCHARINDEX(obj, idx))) && is_separator(get_char_at(obj, idx)) ) : 1; }
+static int  STB_TEXTEDIT_MOVEWORDRIGHT_IMPL(STB_TEXTEDIT_STRING* obj, int idx)  { idx = STB_TEXTEDIT_GETNEXTCHARINDEX(obj, idx); int len = obj->CurLenA; while (idx < len && !is_word_boundary_from_left(obj, idx)) idx = STB_TEXTEDIT_GETNEXTCHARINDEX(obj, idx); return idx > len ? len : idx; }
 #else
-static int  STB_TEXTEDIT_MOVEWORDRIGHT_IMPL(STB_TEXTEDIT_STRING* obj, int idx)  { idx++; int len = obj->CurLenW; while (idx < len && !is_word_boundary_from_right(obj, idx)) idx++; return idx > len ? len : idx; }
+static int  STB_TEXTEDIT_MOVEWORDRIGHT_IMPL(STB_TEXTEDIT_STRING* obj, int idx)  { idx = STB_TEXTEDIT_GETNEXTCHARINDEX(obj, idx); int len = obj->CurLenA; while (idx < len && !is_word_boundary_from_right(obj, idx)) idx = STB_TEXTEDIT_GETNEXTCHARINDEX(obj, idx); return idx > len ? len : idx; }
 #endif
 #define STB_TEXTEDIT_MOVEWORDLEFT   STB_TEXTEDIT_MOVEWORDLEFT_IMPL    // They need to be #define for stb_textedit.h
 #define STB_TEXTEDIT_MOVEWORDRIGHT  STB_TEXTEDIT_MOVEWORDRIGHT_IMPL
 
+// Edits happen at the gap of the edit buffer: we only move the bytes between the previous and the current edit position
 static void STB_TEXTEDIT_DELETECHARS(STB_TEXTEDIT_STRING* obj, int pos, int n)
 {
-    ImWchar* dst = obj->TextW.Data + pos;
-
-    // We maintain our buffer length in both UTF-8 and wchar formats
     obj->Edited = true;
-    obj->CurLenA -= ImTextCountUtf8BytesFromStr(dst, dst + n);
-    obj->CurLenW -= n;
-
-    // Offset remaining text (FIXME-OPT: Use memmove)
-    const ImWchar* src = obj->TextW.Data + pos + n;
-    while (ImWchar c = *src++)
-        *dst++ = c;
-    *dst = '\0';
+    obj->MarkBufDirty(pos, obj->CurLenA - pos - n);
+    obj->LineIndex.OnDeleteChars(pos, n);
+    obj->MoveGap(pos);
+    obj->CurLenA -= n; // Extend the gap over the deleted bytes
+    obj->TextA[obj->GapPos] = '\0';
 }
 
-static bool STB_TEXTEDIT_INSERTCHARS(STB_TEXTEDIT_STRING* obj, int pos, const ImWchar* new_text, int new_text_len)
+static bool STB_TEXTEDIT_INSERTCHARS(STB_TEXTEDIT_STRING* obj, int pos, const char* new_text, int new_text_len)
 {
     const bool is_resizable = (obj->UserFlags & ImGuiInputTextFlags_CallbackResize) != 0;
-    const int text_len = obj->CurLenW;
+    const int text_len = obj->CurLenA;
     IM_ASSERT(pos <= text_len);
 
-    const int new_text_len_utf8 = ImTextCountUtf8BytesFromStr(new_text, new_text + new_text_len);
-    if (!is_resizable && (new_text_len_utf8 + obj->CurLenA + 1 > obj->BufCapacityA))
+    if (!is_resizable && (new_text_len + text_len + 1 > obj->BufCapacityA))
         return false;
 
-    // Grow internal buffer if needed
-    if (new_text_len + text_len + 1 > obj->TextW.Size)
+    obj->MoveGap(pos);
+
+    // Grow internal buffer if needed, moving the text after the gap to the end
+    if (new_text_len > obj->GetGapLen())
     {
         if (!is_resizable)
             return false;
-        IM_ASSERT(text_len < obj->TextW.Size);
-        obj->TextW.resize(text_len + ImClamp(new_text_len * 4, 32, ImMax(256, new_text_len)) + 1);
+        const int after_gap_len = text_len - pos;
+        const int old_size = obj->TextA.Size;
+        obj->TextA.resize(text_len + ImClamp(new_text_len * 4, 32, ImMax(256, new_text_len)) + 1);
+        memmove(obj->TextA.Data + obj->TextA.Size - 1 - after_gap_len, obj->TextA.Data + old_size - 1 - after_gap_len, (size_t)after_gap_len);
+        obj->TextA[obj->TextA.Size - 1] = '\0';
     }
 
-    ImWchar* text = obj->TextW.Data;
-    if (pos != text_len)
-        memmove(text + pos + new_text_len, text + pos, (size_t)(text_len - pos) * sizeof(ImWchar));
-    memcpy(text + pos, new_text, (size_t)new_text_len * sizeof(ImWchar));
-
+    memcpy(obj->TextA.Data + pos, new_text, (size_t)new_text_len);
     obj->Edited = true;
-    obj->CurLenW += new_text_len;
-    obj->CurLenA += new_text_len_utf8;
-    obj->TextW[obj->CurLenW] = '\0';
+    obj->MarkBufDirty(pos, text_len - pos);
+    obj->CurLenA += new_text_len;
+    obj->GapPos += new_text_len;
+    if (obj->GetGapLen() > 0)
+        obj->TextA[obj->GapPos] = '\0';
+    obj->LineIndex.OnInsertChars(pos, new_text, new_text_len);
 
     return true;
 }
@@ -3619,8 +4150,8 @@ static bool STB_TEXTEDIT_INSERTCHARS(STB_TEXTEDIT_STRING* obj, int pos, const Im
 // the stb_textedit_paste() function creates two separate records, so we perform it manually. (FIXME: Report to nothings/stb?)
 static void stb_textedit_replace(STB_TEXTEDIT_STRING* str, STB_TexteditState* state, const STB_TEXTEDIT_CHARTYPE* text, int text_len)
 {
-    stb_text_makeundo_replace(str, state, 0, str->CurLenW, text_len);
-    ImStb::STB_TEXTEDIT_DELETECHARS(str, 0, str->CurLenW);
+    stb_text_makeundo_replace(str, state, 0, str->CurLenA, text_len);
+    ImStb::STB_TEXTEDIT_DELETECHARS(str, 0, str->CurLenA);
     if (text_len <= 0)
         return;
     if (ImStb::STB_TEXTEDIT_INSERTCHARS(str, 0, text, text_len))
@@ -3632,6 +4163,36 @@ static void stb_textedit_replace(STB_TEXTEDIT_STRING* str, STB_TexteditState* st
     IM_ASSERT(0); // Failed to insert character, normally shouldn't happen because of how we currently use stb_textedit_replace()
 }
 
+// Record the modification of the text by a user callback as a single replace, so the undo records before it still apply to the text they were made for.
+// 'old_text' is a zero-terminated copy of the text before the callback, the new text is at the beginning of the edit buffer (gap at the end).
+// Return false if the text is unchanged, otherwise the replaced range [*out_begin, old_len - *out_tail) of the old text.
+static bool stb_textedit_reconcile_undo(STB_TEXTEDIT_STRING* str, STB_TexteditState* state, const char* old_text, int old_len, int new_len, int* out_begin, int* out_tail)
+{
+    const char* new_text = str->TextA.Data;
+    const int min_len = ImMin(old_len, new_len);
+    int begin = 0;
+    while (begin < min_len && old_text[begin] == new_text[begin])
+        begin++;
+    if (begin == old_len && begin == new_len)
+        return false;
+    int tail = 0;
+    while (tail < min_len - begin && old_text[old_len - 1 - tail] == new_text[new_len - 1 - tail])
+        tail++;
+
+    // Replace whole UTF-8 sequences, so undo/redo don't place the cursor within one
+    while (begin > 0 && ((old_text[begin] & 0xC0) == 0x80 || (new_text[begin] & 0xC0) == 0x80))
+        begin--;
+    while (tail > 0 && (old_text[old_len - tail] & 0xC0) == 0x80)
+        tail--;
+
+    const int delete_len = old_len - tail - begin;
+    if (STB_TEXTEDIT_CHARTYPE* p = stb_text_createundo(&state->undostate, begin, delete_len, new_len - tail - begin))
+        memcpy(p, old_text + begin, (size_t)delete_len);
+    *out_begin = begin;
+    *out_tail = tail;
+    return true;
+}
+
 } // namespace ImStb
 
 void ImGuiInputTextState::OnKeyPressed(int key)
@@ -3641,13 +4202,24 @@ void ImGuiInputTextState::OnKeyPressed(int key)
     CursorAnimReset();
 }
 
+void ImGuiInputTextState::OnCharPressed(unsigned int c)
+{
+    char utf8[4];
+    const int utf8_len = ImTextCharToUtf8(utf8, IM_ARRAYSIZE(utf8), c);
+    if (utf8_len == 0)
+        return;
+    stb_textedit_text(this, &Stb, utf8, utf8_len);
+    CursorFollow = true;
+    CursorAnimReset();
+}
+
 ImGuiInputTextCallbackData::ImGuiInputTextCallbackData()
 {
     memset(this, 0, sizeof(*this));
 }
 
 // Public API to manipulate UTF-8 text
-// We expose UTF-8 to the user (unlike the STB_TEXTEDIT_* functions which are manipulating wchar)
+// Those mirror the STB_TEXTEDIT_* functions but operate on the user-facing callback buffer.
 // FIXME: The existence of this rarely exercised code path is a bit of a nuisance.
 void ImGuiInputTextCallbackData::DeleteChars(int pos, int bytes_count)
 {
@@ -3676,13 +4248,13 @@ void ImGuiInputTextCallbackData::InsertChars(int pos, const char* new_text, cons
         if (!is_resizable)
             return;
 
-        // Contrary to STB_TEXTEDIT_INSERTCHARS() this is working in the UTF8 buffer, hence the mildly similar code (until we remove the U16 buffer altogether!)
+        // Grow the edit buffer, which is what Buf points to (InputTextEx() updates its line index over the modified range when BufDirty is set)
         ImGuiContext& g = *GImGui;
         ImGuiInputTextState* edit_state = &g.InputTextState;
         IM_ASSERT(edit_state->ID != 0 && g.ActiveId == edit_state->ID);
         IM_ASSERT(Buf == edit_state->TextA.Data);
         int new_buf_size = BufTextLen + ImClamp(new_text_len * 4, 32, ImMax(256, new_text_len)) + 1;
-        edit_state->TextA.reserve(new_buf_size + 1);
+        edit_state->TextA.resize(new_buf_size + 1);
         Buf = edit_state->TextA.Data;
         BufSize = edit_state->BufCapacityA = new_buf_size;
     }
@@ -3787,10 +4359,12 @@ static bool InputTextFilterCharacter(unsigned int* p_char, ImGuiInputTextFlags f
 //   Note that in std::string world, capacity() would omit 1 byte used by the zero-terminator.
 // - When active, hold on a privately held copy of the text (and apply back to 'buf'). So changing 'buf' while the InputText is active has no effect.
 // - If you want to use ImGui::InputText() with std::string, see misc/cpp/imgui_stdlib.h
-// (FIXME: Rather confusing and messy function, among the worse part of our codebase, expecting to rewrite a V2 at some point.. Partly because we are
-//  doing UTF8 > U16 > UTF8 conversions on the go to easily interface with stb_textedit. Ideally should stay in UTF-8 all the time. See https://github.com/nothings/stb/issues/188)
+// - When active, the text is edited in UTF-8 (stb_textedit positions are byte offsets) and we maintain a line index of the edit buffer,
+//   so the per-frame cost of locating the cursor/selection doesn't depend on the size of the text.
+// (FIXME: Rather confusing and messy function, among the worse part of our codebase, expecting to rewrite a V2 at some point..)
 bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* callback_user_data)
 {
+    IM_MEMTAG_SCOPE(ImGuiMemTag_InputText);
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
@@ -3886,22 +4460,26 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state = &g.InputTextState;
         state->CursorAnimReset();
 
-        // Take a copy of the initial buffer value (both in original UTF-8 format and converted to wchar)
+        // Take a copy of the initial buffer value
         // From the moment we focused we are ignoring the content of 'buf' (unless we are in read-only mode)
         const int buf_len = (int)strlen(buf);
         state->InitialTextA.resize(buf_len + 1);    // UTF-8. we use +1 to make sure that .Data is always pointing to at least an empty string.
         memcpy(state->InitialTextA.Data, buf, buf_len + 1);
 
         // Start edition
-        const char* buf_end = NULL;
-        state->TextW.resize(buf_size + 1);          // wchar count <= UTF-8 count. we use +1 to make sure that .Data is always pointing to at least an empty string.
-        state->TextA.resize(0);
-        state->TextAIsValid = false;                // TextA is not valid yet (we will display buf until then)
-        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, buf_size, buf, NULL, &buf_end);
-        state->CurLenA = (int)(buf_end - buf);      // We can't get the result from ImStrncpy() above because it is not UTF-8 aware. Here we'll cut off malformed UTF-8.
+        state->TextA.resize(buf_size + 1);          // we use +1 to make sure that .Data is always pointing to at least an empty string.
+        // Malformed UTF-8 is replaced with U+FFFD, and written back to 'buf' with the first edit
+        ImVector<char> sanitized_text;
+        int text_len = buf_len, valid_len;
+        const char* text = InputTextSanitizeUtf8(buf, &text_len, ImMax(buf_size - 1, 0), &sanitized_text, &valid_len);
+        state->SetText(text, text_len);
+        state->BufSyncedLen = buf_len;
+        state->BufDirtyBegin = -1;
+        if (valid_len != buf_len)
+            state->MarkBufDirty(valid_len, 0);
 
         // Preserve cursor position and undo/redo stack if we come back to same widget
-        // FIXME: For non-readonly widgets we might be able to require that TextAIsValid && TextA == buf ? (untested) and discard undo stack if user buffer has changed.
+        // FIXME: For non-readonly widgets we might be able to require that TextA == buf ? (untested) and discard undo stack if user buffer has changed.
         const bool recycle_state = (state->ID == id);
         if (recycle_state)
         {
@@ -3957,21 +4535,21 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     bool value_changed = false;
     bool enter_pressed = false;
 
-    // When read-only we always use the live data passed to the function
-    // FIXME-OPT: Because our selection/cursor code currently needs the wide text we need to convert it when active, which is not ideal :(
+    // When read-only we always use the live data passed to the function, our edit buffer only mirrors it for cursor/selection purpose
     if (is_readonly && state != NULL && (render_cursor || render_selection))
     {
-        const char* buf_end = NULL;
-        state->TextW.resize(buf_size + 1);
-        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, buf, NULL, &buf_end);
-        state->CurLenA = (int)(buf_end - buf);
+        ImVector<char> sanitized_text;
+        int text_len = (int)strlen(buf), valid_len;
+        const char* text = InputTextSanitizeUtf8(buf, &text_len, INT_MAX, &sanitized_text, &valid_len);
+        if (text_len != state->CurLenA || memcmp(state->GetText(), text, (size_t)text_len) != 0)
+            state->SetText(text, text_len);
         state->CursorClamp();
         render_selection &= state->HasSelection();
     }
 
     // Select the buffer to render.
-    const bool buf_display_from_state = (render_cursor || render_selection || g.ActiveId == id) && !is_readonly && state && state->TextAIsValid;
-    const bool is_displaying_hint = (hint != NULL && (buf_display_from_state ? state->TextA.Data : buf)[0] == 0);
+    const bool buf_display_from_state = (render_cursor || render_selection || g.ActiveId == id) && !is_readonly && state;
+    const bool is_displaying_hint = (hint != NULL && (buf_display_from_state ? state->CurLenA == 0 : buf[0] == 0));
 
     // Password pushes a temporary font with only a fallback glyph
     if (is_password && !is_displaying_hint)
@@ -3990,11 +4568,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     }
 
     // Process mouse inputs and character inputs
-    int backup_current_text_length = 0;
     if (g.ActiveId == id)
     {
         IM_ASSERT(state != NULL);
-        backup_current_text_length = state->CurLenA;
         state->Edited = false;
         state->BufCapacityA = buf_size;
         state->UserFlags = flags;
@@ -4047,7 +4623,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 unsigned int c = '\t'; // Insert TAB
                 if (InputTextFilterCharacter(&c, flags, callback, callback_user_data))
-                    state->OnKeyPressed((int)c);
+                    state->OnCharPressed(c);
             }
 
         // Process regular text input (before we check for Return because using some IME will effectively send a Return?)
@@ -4062,7 +4638,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     if (c == '\t' && io.KeyShift)
                         continue;
                     if (InputTextFilterCharacter(&c, flags, callback, callback_user_data))
-                        state->OnKeyPressed((int)c);
+                        state->OnCharPressed(c);
                 }
 
             // Consume characters
@@ -4126,7 +4702,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 unsigned int c = '\n'; // Insert new line
                 if (InputTextFilterCharacter(&c, flags, callback, callback_user_data))
-                    state->OnKeyPressed((int)c);
+                    state->OnCharPressed(c);
             }
         }
         else if (IsKeyPressedMap(ImGuiKey_Escape))
@@ -4149,12 +4725,11 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             if (io.SetClipboardTextFn)
             {
                 const int ib = state->HasSelection() ? ImMin(state->Stb.select_start, state->Stb.select_end) : 0;
-                const int ie = state->HasSelection() ? ImMax(state->Stb.select_start, state->Stb.select_end) : state->CurLenW;
-                const int clipboard_data_len = ImTextCountUtf8BytesFromStr(state->TextW.Data + ib, state->TextW.Data + ie) + 1;
-                char* clipboard_data = (char*)IM_ALLOC(clipboard_data_len * sizeof(char));
-                ImTextStrToUtf8(clipboard_data, clipboard_data_len, state->TextW.Data + ib, state->TextW.Data + ie);
+                const int ie = state->HasSelection() ? ImMax(state->Stb.select_start, state->Stb.select_end) : state->CurLenA;
+                char* clipboard_data = (char*)MemAllocFrame((size_t)(ie - ib + 1));
+                memcpy(clipboard_data, state->GetTextRange(ib, ie) + ib, (size_t)(ie - ib));
+                clipboard_data[ie - ib] = 0;
                 SetClipboardText(clipboard_data);
-                MemFree(clipboard_data);
             }
             if (is_cut)
             {
@@ -4168,10 +4743,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         {
             if (const char* clipboard = GetClipboardText())
             {
-                // Filter pasted buffer
+                // Filter pasted buffer (filtering may change characters, so we re-encode them)
                 const int clipboard_len = (int)strlen(clipboard);
-                ImWchar* clipboard_filtered = (ImWchar*)IM_ALLOC((clipboard_len + 1) * sizeof(ImWchar));
-                int clipboard_filtered_len = 0;
+                ImVector<char> clipboard_filtered;
+                clipboard_filtered.reserve(clipboard_len + 1);
                 for (const char* s = clipboard; *s; )
                 {
                     unsigned int c;
@@ -4180,15 +4755,16 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                         break;
                     if (!InputTextFilterCharacter(&c, flags, callback, callback_user_data))
                         continue;
-                    clipboard_filtered[clipboard_filtered_len++] = (ImWchar)c;
+                    char utf8[4];
+                    const int utf8_len = ImTextCharToUtf8(utf8, IM_ARRAYSIZE(utf8), c);
+                    for (int n = 0; n < utf8_len; n++)
+                        clipboard_filtered.push_back(utf8[n]);
                 }
-                clipboard_filtered[clipboard_filtered_len] = 0;
-                if (clipboard_filtered_len > 0) // If everything was filtered, ignore the pasting operation
+                if (clipboard_filtered.Size > 0) // If everything was filtered, ignore the pasting operation
                 {
-                    stb_textedit_paste(state, &state->Stb, clipboard_filtered, clipboard_filtered_len);
+                    stb_textedit_paste(state, &state->Stb, clipboard_filtered.Data, clipboard_filtered.Size);
                     state->CursorFollow = true;
                 }
-                MemFree(clipboard_filtered);
             }
         }
 
@@ -4202,6 +4778,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         IM_ASSERT(state != NULL);
         const char* apply_new_text = NULL;
         int apply_new_text_length = 0;
+        bool apply_new_text_from_state = false;
         if (cancel_edit)
         {
             // Restore initial value. Only return true if restoring to the initial value changes the current buffer contents.
@@ -4210,13 +4787,10 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 // Push records into the undo stack so we can CTRL+Z the revert operation itself
                 apply_new_text = state->InitialTextA.Data;
                 apply_new_text_length = state->InitialTextA.Size - 1;
-                ImVector<ImWchar> w_text;
-                if (apply_new_text_length > 0)
-                {
-                    w_text.resize(ImTextCountCharsFromUtf8(apply_new_text, apply_new_text + apply_new_text_length) + 1);
-                    ImTextStrFromUtf8(w_text.Data, w_text.Size, apply_new_text, apply_new_text + apply_new_text_length);
-                }
-                stb_textedit_replace(state, &state->Stb, w_text.Data, (apply_new_text_length > 0) ? (w_text.Size - 1) : 0);
+                ImVector<char> sanitized_text;
+                int text_len = apply_new_text_length, valid_len;
+                const char* text = InputTextSanitizeUtf8(apply_new_text, &text_len, ImMax(buf_size - 1, 0), &sanitized_text, &valid_len);
+                stb_textedit_replace(state, &state->Stb, text, text_len);
             }
         }
 
@@ -4229,13 +4803,6 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             // Apply new value immediately - copy modified buffer back
             // Note that as soon as the input box is active, the in-widget value gets priority over any underlying modification of the input buffer
             // FIXME: We actually always render 'buf' when calling DrawList->AddText, making the comment above incorrect.
-            // FIXME-OPT: CPU waste to do this every time the widget is active, should mark dirty state from the stb_textedit callbacks.
-            if (!is_readonly)
-            {
-                state->TextAIsValid = true;
-                state->TextA.resize(state->TextW.Size * 4 + 1);
-                ImTextStrToUtf8(state->TextA.Data, state->TextA.Size, state->TextW.Data, NULL);
-            }
 
             // User callback
             if ((flags & (ImGuiInputTextFlags_CallbackCompletion | ImGuiInputTextFlags_CallbackHistory | ImGuiInputTextFlags_CallbackEdit | ImGuiInputTextFlags_CallbackAlways)) != 0)
@@ -4278,16 +4845,18 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     callback_data.UserData = callback_user_data;
 
                     callback_data.EventKey = event_key;
+                    // Callbacks see the text at the beginning of the edit buffer and the spare capacity after it. Both the gap and
+                    // the backup are only touched when the text was modified since the last callback (e.g. not on most frames of ImGuiInputTextFlags_CallbackAlways).
+                    state->MoveGap(state->CurLenA);
+                    state->UpdateCallbackTextBackup();
                     callback_data.Buf = state->TextA.Data;
                     callback_data.BufTextLen = state->CurLenA;
                     callback_data.BufSize = state->BufCapacityA;
                     callback_data.BufDirty = false;
 
-                    // We have to convert from wchar-positions to UTF-8-positions, which can be pretty slow (an incentive to ditch the ImWchar buffer, see https://github.com/nothings/stb/issues/188)
-                    ImWchar* text = state->TextW.Data;
-                    const int utf8_cursor_pos = callback_data.CursorPos = ImTextCountUtf8BytesFromStr(text, text + state->Stb.cursor);
-                    const int utf8_selection_start = callback_data.SelectionStart = ImTextCountUtf8BytesFromStr(text, text + state->Stb.select_start);
-                    const int utf8_selection_end = callback_data.SelectionEnd = ImTextCountUtf8BytesFromStr(text, text + state->Stb.select_end);
+                    const int utf8_cursor_pos = callback_data.CursorPos = state->Stb.cursor;
+                    const int utf8_selection_start = callback_data.SelectionStart = state->Stb.select_start;
+                    const int utf8_selection_end = callback_data.SelectionEnd = state->Stb.select_end;
 
                     // Call user code
                     callback(&callback_data);
@@ -4296,33 +4865,67 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     IM_ASSERT(callback_data.Buf == state->TextA.Data);  // Invalid to modify those fields
                     IM_ASSERT(callback_data.BufSize == state->BufCapacityA);
                     IM_ASSERT(callback_data.Flags == flags);
-                    if (callback_data.CursorPos != utf8_cursor_pos)            { state->Stb.cursor = ImTextCountCharsFromUtf8(callback_data.Buf, callback_data.Buf + callback_data.CursorPos); state->CursorFollow = true; }
-                    if (callback_data.SelectionStart != utf8_selection_start)  { state->Stb.select_start = ImTextCountCharsFromUtf8(callback_data.Buf, callback_data.Buf + callback_data.SelectionStart); }
-                    if (callback_data.SelectionEnd != utf8_selection_end)      { state->Stb.select_end = ImTextCountCharsFromUtf8(callback_data.Buf, callback_data.Buf + callback_data.SelectionEnd); }
+                    if (callback_data.CursorPos != utf8_cursor_pos)            { state->Stb.cursor = callback_data.CursorPos; state->CursorFollow = true; }
+                    if (callback_data.SelectionStart != utf8_selection_start)  { state->Stb.select_start = callback_data.SelectionStart; }
+                    if (callback_data.SelectionEnd != utf8_selection_end)      { state->Stb.select_end = callback_data.SelectionEnd; }
                     if (callback_data.BufDirty)
                     {
                         IM_ASSERT(callback_data.BufTextLen == (int)strlen(callback_data.Buf)); // You need to maintain BufTextLen if you change the text!
-                        if (callback_data.BufTextLen > backup_current_text_length && is_resizable)
-                            state->TextW.resize(state->TextW.Size + (callback_data.BufTextLen - backup_current_text_length));
-                        state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, callback_data.Buf, NULL);
-                        state->CurLenA = callback_data.BufTextLen;  // Assume correct length and valid UTF-8 from user, saves us an extra strlen()
+                        const int new_len = callback_data.BufTextLen;       // Assume correct length and valid UTF-8 from user, saves us an extra strlen()
+                        int edit_begin, edit_tail;
+                        if (ImStb::stb_textedit_reconcile_undo(state, &state->Stb, state->CallbackTextBackup.Data, state->CurLenA, new_len, &edit_begin, &edit_tail))
+                        {
+                            state->LineIndex.OnDeleteChars(edit_begin, state->CurLenA - edit_tail - edit_begin);
+                            state->LineIndex.OnInsertChars(edit_begin, state->TextA.Data + edit_begin, new_len - edit_tail - edit_begin);
+                            state->CurLenA = state->GapPos = new_len;
+                            state->MarkBufDirty(edit_begin, edit_tail);
+                        }
+                        state->TextA[state->TextA.Size - 1] = 0;
+                        state->CursorClamp();
                         state->CursorAnimReset();
+                        state->Edited = true;
                     }
                 }
             }
 
-            // Will copy result string if modified
-            if (!is_readonly && strcmp(state->TextA.Data, buf) != 0)
+            // Will copy result string if modified. We track the range of text modified since our last copy, so we don't compare
+            // the (possibly very large) buffers on frames without edits, except for a final application when releasing the active id.
+            const bool buf_dirty = (state->BufDirtyBegin >= 0);
+            if (!is_readonly && buf_dirty && (flags & ImGuiInputTextFlags_IncrementalCopyBack) && !is_resizable && state->CurLenA < buf_size && state->BufSyncedLen < buf_size)
+            {
+                // The user buffer still holds our last copy (required by ImGuiInputTextFlags_IncrementalCopyBack):
+                // only copy the modified range, moving the unmodified tail of the user buffer in place.
+                const int text_len = state->CurLenA;
+                const int dirty_begin = state->BufDirtyBegin;
+                const int dirty_end = text_len - state->BufDirtyTail;
+                const char* text = state->GetTextRange(dirty_begin, dirty_end);
+                if (text_len != state->BufSyncedLen || memcmp(buf + dirty_begin, text + dirty_begin, (size_t)(dirty_end - dirty_begin)) != 0)
+                {
+                    memmove(buf + dirty_end, buf + state->BufSyncedLen - state->BufDirtyTail, (size_t)state->BufDirtyTail);
+                    memcpy(buf + dirty_begin, text + dirty_begin, (size_t)(dirty_end - dirty_begin));
+                    buf[text_len] = 0;
+                    value_changed = true;
+                }
+                state->BufSyncedLen = text_len;
+                state->BufDirtyBegin = -1;
+            }
+            else if (!is_readonly && (buf_dirty || clear_active_id || enter_pressed))
             {
-                apply_new_text = state->TextA.Data;
-                apply_new_text_length = state->CurLenA;
+                if (!InputTextBufferEquals(state, buf, buf_size))
+                {
+                    apply_new_text = state->TextA.Data;         // Copied from both sides of the gap below, see apply_new_text_from_state
+                    apply_new_text_length = state->CurLenA;
+                    apply_new_text_from_state = true;
+                }
+                state->BufSyncedLen = state->CurLenA;
+                state->BufDirtyBegin = -1;
             }
         }
 
         // Copy result to user buffer
         if (apply_new_text)
         {
-            // We cannot test for 'backup_current_text_length != apply_new_text_length' here because we have no guarantee that the size
+            // We cannot test for a change of the edit buffer length here because we have no guarantee that the size
             // of our owned buffer matches the size of the string object held by the user, and by design we allow InputText() to be used
             // without any storage on user's side.
             IM_ASSERT(apply_new_text_length >= 0);
@@ -4344,9 +4947,17 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             //IMGUI_DEBUG_LOG("InputText(\"%s\"): apply_new_text length %d\n", label, apply_new_text_length);
 
             // If the underlying buffer resize was denied or not carried to the next frame, apply_new_text_length+1 may be >= buf_size.
-            ImStrncpy(buf, apply_new_text, ImMin(apply_new_text_length + 1, buf_size));
+            if (apply_new_text_from_state)
+                InputTextCopyToBuffer(state, buf, ImMin(apply_new_text_length + 1, buf_size));
+            else
+                ImStrncpy(buf, apply_new_text, ImMin(apply_new_text_length + 1, buf_size));
+            state->BufSyncedLen = ImMin(apply_new_text_length, buf_size - 1);
+            state->BufDirtyBegin = -1;
             value_changed = true;
         }
+        if (value_changed && is_multiline && (flags & ImGuiInputTextFlags_RetainLineIndex))
+            if (ImGuiInputTextLineCache* line_cache = InputTextFindLineCache(id))
+                line_cache->EditedByWidget = true;
 
         // Clear temporary user storage
         state->UserFlags = 0;
@@ -4373,7 +4984,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     // without any carriage return, which would makes ImFont::RenderText() reserve too many vertices and probably crash. Avoid it altogether.
     // Note that we only use this limit on single-line InputText(), so a pathologically large line on a InputTextMultiline() would still crash.
     const int buf_display_max_length = 2 * 1024 * 1024;
-    const char* buf_display = buf_display_from_state ? state->TextA.Data : buf; //-V595
+    // The edit buffer of an active multi-line widget is only read by visible ranges (moving its gap less), other paths read it as a whole.
+    const bool buf_display_by_range = buf_display_from_state && is_multiline && !g.LogEnabled;
+    const char* buf_display = buf_display_from_state ? (buf_display_by_range ? state->TextA.Data : state->GetText()) : buf; //-V595
     const char* buf_display_end = NULL; // We have specialized paths below for setting the length
     if (is_displaying_hint)
     {
@@ -4395,58 +5008,30 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         // - Handle scrolling, highlight selection, display cursor (those all requires some form of 1d->2d cursor position calculation)
         // - Measure text height (for scrollbar)
         // We are attempting to do most of that in **one main pass** to minimize the computation cost (non-negligible for large amount of text) + 2nd pass for selection rendering (we could merge them by an extra refactoring effort)
-        // FIXME: This should occur on buf_display but we'd need to maintain cursor/select_start/select_end for UTF-8.
-        const ImWchar* text_begin = state->TextW.Data;
+        // Cursor and selection positions are located with our line index, so we only measure from the beginning of their line.
+        ImGuiTextLineIndex* line_index = &state->LineIndex;
         ImVec2 cursor_offset, select_start_offset;
 
         {
-            // Find lines numbers straddling 'cursor' (slot 0) and 'select_start' (slot 1) positions.
-            const ImWchar* searches_input_ptr[2] = { NULL, NULL };
-            int searches_result_line_no[2] = { -1000, -1000 };
-            int searches_remaining = 0;
-            if (render_cursor)
-            {
-                searches_input_ptr[0] = text_begin + state->Stb.cursor;
-                searches_result_line_no[0] = -1;
-                searches_remaining++;
-            }
+            // Calculate 2d position of 'cursor' and 'select_start' by finding the beginning of their line and measuring distance
+            const int cursor_line = line_index->FindLine(state->Stb.cursor);
+            const int cursor_line_start = line_index->GetLineStart(cursor_line);
+            const char* cursor_text = state->GetTextRange(cursor_line_start, state->Stb.cursor);
+            cursor_offset.x = InputTextCalcTextSize(cursor_text + cursor_line_start, cursor_text + state->Stb.cursor).x;
+            cursor_offset.y = (cursor_line + 1) * g.FontSize;
             if (render_selection)
             {
-                searches_input_ptr[1] = text_begin + ImMin(state->Stb.select_start, state->Stb.select_end);
-                searches_result_line_no[1] = -1;
-                searches_remaining++;
-            }
-
-            // Iterate all lines to find our line numbers
-            // In multi-line mode, we never exit the loop until all lines are counted, so add one extra to the searches_remaining counter.
-            searches_remaining += is_multiline ? 1 : 0;
-            int line_count = 0;
-            //for (const ImWchar* s = text_begin; (s = (const ImWchar*)wcschr((const wchar_t*)s, (wchar_t)'\n')) != NULL; s++)  // FIXME-OPT: Could use this when wchar_t are 16-bit
-            for (const ImWchar* s = text_begin; *s != 0; s++)
-                if (*s == '\n')
-                {
-                    line_count++;
-                    if (searches_result_line_no[0] == -1 && s >= searches_input_ptr[0]) { searches_result_line_no[0] = line_count; if (--searches_remaining <= 0) break; }
-                    if (searches_result_line_no[1] == -1 && s >= searches_input_ptr[1]) { searches_result_line_no[1] = line_count; if (--searches_remaining <= 0) break; }
-                }
-            line_count++;
-            if (searches_result_line_no[0] == -1)
-                searches_result_line_no[0] = line_count;
-            if (searches_result_line_no[1] == -1)
-                searches_result_line_no[1] = line_count;
-
-            // Calculate 2d position by finding the beginning of the line and measuring distance
-            cursor_offset.x = InputTextCalcTextSizeW(ImStrbolW(searches_input_ptr[0], text_begin), searches_input_ptr[0]).x;
-            cursor_offset.y = searches_result_line_no[0] * g.FontSize;
-            if (searches_result_line_no[1] >= 0)
-            {
-                select_start_offset.x = InputTextCalcTextSizeW(ImStrbolW(searches_input_ptr[1], text_begin), searches_input_ptr[1]).x;
-                select_start_offset.y = searches_result_line_no[1] * g.FontSize;
+                const int select_start = ImMin(state->Stb.select_start, state->Stb.select_end);
+                const int select_start_line = line_index->FindLine(select_start);
+                const int select_start_line_start = line_index->GetLineStart(select_start_line);
+                const char* select_start_text = state->GetTextRange(select_start_line_start, select_start);
+                select_start_offset.x = InputTextCalcTextSize(select_start_text + select_start_line_start, select_start_text + select_start).x;
+                select_start_offset.y = (select_start_line + 1) * g.FontSize;
             }
 
             // Store text height (note that we haven't calculated text width at all, see GitHub issues #383, #1224)
             if (is_multiline)
-                text_size = ImVec2(inner_size.x, line_count * g.FontSize);
+                text_size = ImVec2(inner_size.x, line_index->GetLineCount() * g.FontSize);
         }
 
         // Scroll
@@ -4483,45 +5068,52 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             state->CursorFollow = false;
         }
 
-        // Draw selection
+        // Draw selection, one span per visible line. Lines fully inside the selection use the cached width of the line index.
         const ImVec2 draw_scroll = ImVec2(state->ScrollX, 0.0f);
         if (render_selection)
         {
-            const ImWchar* text_selected_begin = text_begin + ImMin(state->Stb.select_start, state->Stb.select_end);
-            const ImWchar* text_selected_end = text_begin + ImMax(state->Stb.select_start, state->Stb.select_end);
+            const int text_selected_begin = ImMin(state->Stb.select_start, state->Stb.select_end);
+            const int text_selected_end = ImMax(state->Stb.select_start, state->Stb.select_end);
+            const int line_selected_begin = line_index->FindLine(text_selected_begin);
+            const int line_selected_end = line_index->FindLine(text_selected_end);
 
             ImU32 bg_color = GetColorU32(ImGuiCol_TextSelectedBg, render_cursor ? 1.0f : 0.6f); // FIXME: current code flow mandate that render_cursor is always true here, we are leaving the transparent one for tests.
             float bg_offy_up = is_multiline ? 0.0f : -1.0f;    // FIXME: those offsets should be part of the style? they don't play so well with multi-line selection.
             float bg_offy_dn = is_multiline ? 0.0f : 2.0f;
-            ImVec2 rect_pos = draw_pos + select_start_offset - draw_scroll;
-            for (const ImWchar* p = text_selected_begin; p < text_selected_end; )
+            const ImVec2 rect_origin = draw_pos - draw_scroll;
+            const int line_min = ImMax(line_selected_begin, (int)((clip_rect.y - rect_origin.y) / g.FontSize) - 1);
+            const int line_max = ImMin(line_selected_end, (int)((clip_rect.w - rect_origin.y) / g.FontSize) + 1);
+            for (int line = line_min; line <= line_max; line++)
             {
-                if (rect_pos.y > clip_rect.w + g.FontSize)
-                    break;
-                if (rect_pos.y < clip_rect.y)
-                {
-                    //p = (const ImWchar*)wmemchr((const wchar_t*)p, '\n', text_selected_end - p);  // FIXME-OPT: Could use this when wchar_t are 16-bit
-                    //p = p ? p + 1 : text_selected_end;
-                    while (p < text_selected_end)
-                        if (*p++ == '\n')
-                            break;
-                }
+                const int line_start = line_index->GetLineStart(line);
+                const int line_end = line_index->GetLineEnd(line);
+                if (line > line_selected_begin && text_selected_end == line_start)
+                    break; // Selection ends at the beginning of this line
+                const int span_begin = ImMax(text_selected_begin, line_start);
+                const int span_end = ImMin(text_selected_end, line_end);
+                const char* span_text = state->GetTextRange(span_begin, span_end);
+                float span_x = (line == line_selected_begin) ? select_start_offset.x : 0.0f;
+                float span_w;
+                if (span_begin == line_start && span_end == line_end)
+                    span_w = line_index->GetLineWidth(line, span_text);
                 else
-                {
-                    ImVec2 rect_size = InputTextCalcTextSizeW(p, text_selected_end, &p, NULL, true);
-                    if (rect_size.x <= 0.0f) rect_size.x = IM_FLOOR(g.Font->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected empty lines
-                    ImRect rect(rect_pos + ImVec2(0.0f, bg_offy_up - g.FontSize), rect_pos + ImVec2(rect_size.x, bg_offy_dn));
-                    rect.ClipWith(clip_rect);
-                    if (rect.Overlaps(clip_rect))
-                        draw_window->DrawList->AddRectFilled(rect.Min, rect.Max, bg_color);
-                }
-                rect_pos.x = draw_pos.x - draw_scroll.x;
-                rect_pos.y += g.FontSize;
+                    span_w = InputTextCalcTextSize(span_text + span_begin, span_text + span_end).x;
+                if (span_w <= 0.0f) span_w = IM_FLOOR(g.Font->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected empty lines
+                const float line_bottom_y = rect_origin.y + (line + 1) * g.FontSize;
+                ImRect rect(ImVec2(rect_origin.x + span_x, line_bottom_y + bg_offy_up - g.FontSize), ImVec2(rect_origin.x + span_x + span_w, line_bottom_y + bg_offy_dn));
+                rect.ClipWith(clip_rect);
+                if (rect.Overlaps(clip_rect))
+                    draw_window->DrawList->AddRectFilled(rect.Min, rect.Max, bg_color);
             }
         }
 
         // We test for 'buf_display_max_length' as a way to avoid some pathological cases (e.g. single-line 1 MB string) which would make ImDrawList crash.
-        if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
+        // Multi-line text is rendered from the first to the last visible line only.
+        if (is_multiline && !is_displaying_hint)
+        {
+            InputTextRenderVisibleLines(draw_window->DrawList, draw_window->ClipRect, draw_pos - draw_scroll, GetColorU32(ImGuiCol_Text), NULL, *line_index, state);
+        }
+        else if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
             draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
@@ -4545,14 +5137,28 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     else
     {
         // Render text only (no selection, no cursor)
-        if (is_multiline)
+        ImGuiInputTextLineCache* line_cache = NULL;
+        if (is_multiline && (flags & ImGuiInputTextFlags_RetainLineIndex) && !is_displaying_hint && !buf_display_from_state)
+        {
+            // Measure and render from the line index kept between frames, only scanning the text appended since last frame
+            line_cache = InputTextUpdateLineCache(id, buf, buf_size);
+            buf_display_end = buf_display + line_cache->TextLen;
+            text_size = ImVec2(inner_size.x, line_cache->LineIndex.GetLineCount() * g.FontSize);
+            InputTextRenderVisibleLines(draw_window->DrawList, draw_window->ClipRect, draw_pos, GetColorU32(ImGuiCol_Text), buf_display, line_cache->LineIndex);
+        }
+        else if (is_multiline)
+        {
+            // Submitting without ImGuiInputTextFlags_RetainLineIndex invalidates the index kept for this widget
+            if (ImGuiInputTextLineCache* stale_line_cache = InputTextFindLineCache(id))
+                stale_line_cache->TextLen = -1;
             text_size = ImVec2(inner_size.x, InputTextCalcTextLenAndLineCount(buf_display, &buf_display_end) * g.FontSize); // We don't need width
+        }
         else if (!is_displaying_hint && g.ActiveId == id)
             buf_display_end = buf_display + state->CurLenA;
         else if (!is_displaying_hint)
             buf_display_end = buf_display + strlen(buf_display);
 
-        if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
+        if (line_cache == NULL && (is_multiline || (buf_display_end - buf_display) < buf_display_max_length))
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
             draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
@@ -5487,6 +6093,10 @@ void ImGui::ColorPickerOptionsPopup(const float* ref_col, ImGuiColorEditFlags fl
 // - GetTreeNodeToLabelSpacing()
 // - SetNextItemOpen()
 // - CollapsingHeader()
+// - ImGuiTreeView
+// - BeginTreeView()
+// - TreeViewNode()
+// - EndTreeView()
 //-------------------------------------------------------------------------
 
 bool ImGui::TreeNode(const char* str_id, const char* fmt, ...)
@@ -5515,6 +6125,14 @@ bool ImGui::TreeNode(const char* label)
     return TreeNodeBehavior(window->GetID(label), 0, label, NULL);
 }
 
+bool ImGui::TreeNode(const ImGuiLabelHash& label)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    return TreeNodeBehavior(window->GetID(label), 0, label.Label, NULL);
+}
+
 bool ImGui::TreeNodeV(const char* str_id, const char* fmt, va_list args)
 {
     return TreeNodeExV(str_id, 0, fmt, args);
@@ -5628,6 +6246,7 @@ bool ImGui::TreeNodeBehavior(ImGuiID id, ImGuiTreeNodeFlags flags, const char* l
 
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
+    const int selection_idx = (g.NextItemData.Flags & ImGuiNextItemDataFlags_HasSelectionIndex) ? g.NextItemData.SelectionIndex : -1;
     const bool display_frame = (flags & ImGuiTreeNodeFlags_Framed) != 0;
     const ImVec2 padding = (display_frame || (flags & ImGuiTreeNodeFlags_FramePadding)) ? style.FramePadding : ImVec2(style.FramePadding.x, ImMin(window->DC.CurrLineTextBaseOffset, style.FramePadding.y));
 
@@ -5689,11 +6308,11 @@ bool ImGui::TreeNodeBehavior(ImGuiID id, ImGuiTreeNodeFlags flags, const char* l
 
     // We allow clicking on the arrow section with keyboard modifiers held, in order to easily
     // allow browsing a tree while preserving selection with code implementing multi-selection patterns.
-    // When clicking on the rest of the tree node we always disallow keyboard modifiers.
+    // When clicking on the rest of the tree node we always disallow keyboard modifiers, unless the node is part of a multi-select scope.
     const float arrow_hit_x1 = (text_pos.x - text_offset_x) - style.TouchExtraPadding.x;
     const float arrow_hit_x2 = (text_pos.x - text_offset_x) + (g.FontSize + padding.x * 2.0f) + style.TouchExtraPadding.x;
     const bool is_mouse_x_over_arrow = (g.IO.MousePos.x >= arrow_hit_x1 && g.IO.MousePos.x < arrow_hit_x2);
-    if (window != g.HoveredWindow || !is_mouse_x_over_arrow)
+    if ((window != g.HoveredWindow || !is_mouse_x_over_arrow) && selection_idx < 0)
         button_flags |= ImGuiButtonFlags_NoKeyModifiers;
 
     // Open behaviors can be altered with the _OpenOnArrow and _OnOnDoubleClick flags.
@@ -5713,10 +6332,14 @@ bool ImGui::TreeNodeBehavior(ImGuiID id, ImGuiTreeNodeFlags flags, const char* l
         button_flags |= ImGuiButtonFlags_PressedOnClickRelease;
 
     bool selected = (flags & ImGuiTreeNodeFlags_Selected) != 0;
+    if (selection_idx >= 0)
+        selected = g.CurrentMultiSelect->Selection->Contains(selection_idx);
     const bool was_selected = selected;
 
     bool hovered, held;
     bool pressed = ButtonBehavior(interact_bb, id, &hovered, &held, button_flags);
+    if (selection_idx >= 0)
+        selected = MultiSelectItemFooter(id, selection_idx, interact_bb, pressed && (g.NavActivateId == id || !is_mouse_x_over_arrow)); // Clicking the arrow only opens/closes
     bool toggled = false;
     if (!is_leaf)
     {
@@ -5757,8 +6380,8 @@ bool ImGui::TreeNodeBehavior(ImGuiID id, ImGuiTreeNodeFlags flags, const char* l
     if (flags & ImGuiTreeNodeFlags_AllowItemOverlap)
         SetItemAllowOverlap();
 
-    // In this branch, TreeNodeBehavior() cannot toggle the selection so this will never trigger.
-    if (selected != was_selected) //-V547
+    // Within a multi-select scope, TreeNodeBehavior() may toggle the selection
+    if (selected != was_selected)
         window->DC.LastItemStatusFlags |= ImGuiItemStatusFlags_ToggledSelection;
 
     // Render
@@ -5925,6 +6548,122 @@ bool ImGui::CollapsingHeader(const char* label, bool* p_open, ImGuiTreeNodeFlags
     return is_open;
 }
 
+int ImGuiTreeView::FindRow(int node) const
+{
+    for (int row_idx = 0; row_idx < Rows.Size; row_idx++)
+        if (Rows[row_idx].Node == node)
+            return row_idx;
+    return -1;
+}
+
+// Append the rows of the visible descendants of 'parent_node' (-1 for the root nodes) to g.TreeViewNewRows, in display order.
+// Open states are read from the storage, the same way TreeNodeBehaviorIsOpen() does for nodes without ImGuiTreeNodeFlags_DefaultOpen.
+static void TreeViewCollectRows(ImGuiTreeView* view, int parent_node, int parent_depth)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiStorage* storage = window->DC.StateStorage;
+    ImVector<int>& stack = g.TreeViewStack;
+    stack.resize(0);
+    stack.push_back(parent_node);
+    stack.push_back(0);
+    stack.push_back(view->GetChildCount(view->UserData, parent_node));
+    while (stack.Size > 0)
+    {
+        int* entry = &stack[stack.Size - 3];
+        if (entry[1] == entry[2])
+        {
+            stack.resize(stack.Size - 3);
+            continue;
+        }
+        ImGuiTreeViewRow row;
+        row.Node = view->GetChild(view->UserData, entry[0], entry[1]++);
+        row.Depth = parent_depth + stack.Size / 3;
+        row.Open = storage->GetInt(window->GetIDNoKeepAlive((void*)(intptr_t)row.Node), 0) != 0;
+        g.TreeViewNewRows.push_back(row);
+        if (row.Open)
+        {
+            const int children_count = view->GetChildCount(view->UserData, row.Node);
+            stack.push_back(row.Node);
+            stack.push_back(0);
+            stack.push_back(children_count);
+        }
+    }
+}
+
+void ImGui::BeginTreeView(ImGuiTreeView* view)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.CurrentTreeView == NULL && "Nested BeginTreeView() are not supported");
+    IM_ASSERT(view->GetChildCount != NULL && view->GetChild != NULL);
+    g.CurrentTreeView = view;
+    PushID((void*)view);
+
+    if (view->Dirty)
+    {
+        g.TreeViewNewRows.resize(0);
+        TreeViewCollectRows(view, -1, -1);
+        view->Rows.swap(g.TreeViewNewRows);
+        view->Dirty = false;
+    }
+}
+
+void ImGui::EndTreeView()
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.CurrentTreeView != NULL && "Mismatched BeginTreeView()/EndTreeView() calls");
+    g.CurrentTreeView = NULL;
+    PopID();
+}
+
+bool ImGui::TreeViewNode(ImGuiTreeView* view, int row_idx, const char* label, ImGuiTreeNodeFlags flags)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(g.CurrentTreeView == view && "Call between BeginTreeView() and EndTreeView()");
+    IM_ASSERT(row_idx >= 0 && row_idx < view->Rows.Size);
+    if (window->SkipItems)
+        return false;
+
+    const int node = view->Rows[row_idx].Node;
+    const int depth = view->Rows[row_idx].Depth;
+    const ImGuiID id = window->GetID((void*)(intptr_t)node);
+    if (view->GetChildCount(view->UserData, node) == 0)
+        flags |= ImGuiTreeNodeFlags_Leaf;
+    flags |= ImGuiTreeNodeFlags_NoTreePushOnOpen;
+
+    const float indent_w = depth * g.Style.IndentSpacing;
+    if (indent_w > 0.0f)
+        Indent(indent_w);
+    const bool is_open = TreeNodeBehavior(id, flags, label);
+    if (indent_w > 0.0f)
+        Unindent(indent_w);
+
+    // Insert or remove the rows of the visible descendants when the open state changed (clicked, SetNextItemOpen(), etc.)
+    const bool was_open = view->Rows[row_idx].Open;
+    if ((flags & ImGuiTreeNodeFlags_Leaf) || is_open == was_open || g.LogEnabled)
+        return is_open;
+    view->Rows[row_idx].Open = is_open;
+    if (is_open)
+    {
+        g.TreeViewNewRows.resize(0);
+        TreeViewCollectRows(view, node, depth);
+        const int new_count = g.TreeViewNewRows.Size;
+        const int old_size = view->Rows.Size;
+        view->Rows.resize(old_size + new_count);
+        memmove(view->Rows.Data + row_idx + 1 + new_count, view->Rows.Data + row_idx + 1, (size_t)(old_size - row_idx - 1) * sizeof(ImGuiTreeViewRow));
+        memcpy(view->Rows.Data + row_idx + 1, g.TreeViewNewRows.Data, (size_t)new_count * sizeof(ImGuiTreeViewRow));
+    }
+    else
+    {
+        int row_end = row_idx + 1;
+        while (row_end < view->Rows.Size && view->Rows[row_end].Depth > depth)
+            row_end++;
+        view->Rows.erase(view->Rows.Data + row_idx + 1, view->Rows.Data + row_end);
+    }
+    return is_open;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Selectable
 //-------------------------------------------------------------------------
@@ -5943,6 +6682,7 @@ bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags fl
 
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
+    const int selection_idx = (g.NextItemData.Flags & ImGuiNextItemDataFlags_HasSelectionIndex) && !(flags & ImGuiSelectableFlags_Disabled) ? g.NextItemData.SelectionIndex : -1;
 
     const bool span_all_columns = (flags & ImGuiSelectableFlags_SpanAllColumns) != 0;
     if (span_all_columns && window->DC.CurrentColumns) // FIXME-OPT: Avoid if vertically clipped.
@@ -6012,10 +6752,14 @@ bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags fl
 
     if (flags & ImGuiSelectableFlags_Disabled)
         selected = false;
+    if (selection_idx >= 0)
+        selected = g.CurrentMultiSelect->Selection->Contains(selection_idx);
 
     const bool was_selected = selected;
     bool hovered, held;
     bool pressed = ButtonBehavior(bb, id, &hovered, &held, button_flags);
+    if (selection_idx >= 0)
+        selected = MultiSelectItemFooter(id, selection_idx, bb, pressed);
 
     // Update NavId when clicking or when Hovering (this doesn't happen on most widgets), so navigation can be resumed with gamepad/keyboard
     if (pressed || (hovered && (flags & ImGuiSelectableFlags_SetNavIdOnHover)))
@@ -6032,8 +6776,8 @@ bool ImGui::Selectable(const char* label, bool selected, ImGuiSelectableFlags fl
     if (flags & ImGuiSelectableFlags_AllowItemOverlap)
         SetItemAllowOverlap();
 
-    // In this branch, Selectable() cannot toggle the selection so this will never trigger.
-    if (selected != was_selected) //-V547
+    // Within a multi-select scope, Selectable() may toggle the selection
+    if (selected != was_selected)
         window->DC.LastItemStatusFlags |= ImGuiItemStatusFlags_ToggledSelection;
 
     // Render
@@ -6071,6 +6815,235 @@ bool ImGui::Selectable(const char* label, bool* p_selected, ImGuiSelectableFlags
     return false;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] Widgets: Multi-select
+//-------------------------------------------------------------------------
+// - ImGuiSelectionRanges
+// - BeginMultiSelect()
+// - EndMultiSelect()
+// - SetNextItemSelectionIndex()
+// - MultiSelectItemFooter() [Internal]
+//-------------------------------------------------------------------------
+
+// Number of boundaries <= item_idx (the item is selected when it is odd)
+static int SelectionRangesUpperBound(const ImVector<int>& bounds, int item_idx)
+{
+    int lo = 0, hi = bounds.Size;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) >> 1;
+        if (bounds.Data[mid] <= item_idx)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+bool ImGuiSelectionRanges::Contains(int item_idx) const
+{
+    return (SelectionRangesUpperBound(Bounds, item_idx) & 1) != 0;
+}
+
+// Replace the boundaries within [item_begin, item_end] with the (0 to 2) boundaries needed for the range to be uniformly (un)selected,
+// which also merges it with adjacent ranges.
+void ImGuiSelectionRanges::SetRange(int item_begin, int item_end, bool selected)
+{
+    IM_ASSERT(item_begin >= 0);
+    if (item_begin >= item_end)
+        return;
+    const int i0 = SelectionRangesUpperBound(Bounds, item_begin - 1);   // Boundaries before item_begin
+    const int i1 = SelectionRangesUpperBound(Bounds, item_end);         // Boundaries up to item_end (included)
+    int new_bounds[2];
+    int new_count = 0;
+    if (((i0 & 1) != 0) != selected)
+        new_bounds[new_count++] = item_begin;
+    if (((i1 & 1) != 0) != selected)
+        new_bounds[new_count++] = item_end;
+
+    const int old_count = i1 - i0;
+    if (old_count > new_count)
+        Bounds.erase(Bounds.Data + i0, Bounds.Data + i0 + (old_count - new_count));
+    for (int n = old_count; n < new_count; n++)
+        Bounds.insert(Bounds.Data + i0, 0);
+    for (int n = 0; n < new_count; n++)
+        Bounds[i0 + n] = new_bounds[n];
+}
+
+int ImGuiSelectionRanges::CalcSelectedCount() const
+{
+    int count = 0;
+    for (int n = 0; n + 1 < Bounds.Size; n += 2)
+        count += Bounds[n + 1] - Bounds[n];
+    return count;
+}
+
+void ImGui::BeginMultiSelect(ImGuiSelectionRanges* selection, int items_count, ImGuiMultiSelectFlags flags)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(g.CurrentMultiSelect == NULL && "Nested BeginMultiSelect() are not supported");
+    IM_ASSERT(selection != NULL && items_count >= 0);
+
+    ImGuiMultiSelectTempData* ms = &g.MultiSelectTempData;
+    g.CurrentMultiSelect = ms;
+    ms->ID = window->GetIDNoKeepAlive((const void*)selection);
+    ms->Selection = selection;
+    ms->ItemsCount = items_count;
+    ms->Flags = flags;
+    ms->Window = window;
+    ms->KeyCtrl = g.IO.ConfigMacOSXBehaviors ? g.IO.KeySuper : g.IO.KeyCtrl;
+    ms->KeyShift = g.IO.KeyShift;
+
+    // CTRL+A: select all
+    if (!(flags & ImGuiMultiSelectFlags_NoSelectAll) && g.NavWindow == window && g.ActiveId == 0 && ms->KeyCtrl && !ms->KeyShift && IsKeyPressedMap(ImGuiKey_A, false))
+    {
+        selection->Bounds.resize(0);
+        selection->SetRange(0, items_count, true);
+    }
+
+    // Box-selection: setup the lines to find the items crossing them while they are submitted
+    ms->BoxSelectActive = (g.BoxSelectId == ms->ID);
+    if (ms->BoxSelectActive)
+    {
+        ms->BoxSelectY[0] = window->Pos.y - window->Scroll.y + g.BoxSelectStartPosRel.y;
+        ms->BoxSelectY[1] = ImClamp(g.IO.MousePos.y, window->InnerClipRect.Min.y, ImMax(window->InnerClipRect.Min.y, window->InnerClipRect.Max.y - 1.0f));
+        for (int n = 0; n < 2; n++)
+        {
+            ms->BoxSelectFirst[n] = items_count;
+            ms->BoxSelectLast[n] = -1;
+        }
+    }
+}
+
+void ImGui::EndMultiSelect()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiMultiSelectTempData* ms = g.CurrentMultiSelect;
+    IM_ASSERT(ms != NULL && ms->Window == g.CurrentWindow && "Mismatched BeginMultiSelect()/EndMultiSelect() calls");
+    ImGuiWindow* window = ms->Window;
+    ImGuiSelectionRanges* selection = ms->Selection;
+    g.CurrentMultiSelect = NULL;
+
+    // Box-selection: select the items between the start line and the mouse line, which only depends on their indices when they are
+    // laid out vertically, so items which have been clipped since the start are handled.
+    if (ms->BoxSelectActive)
+    {
+        if (!g.IO.MouseDown[0])
+        {
+            g.BoxSelectId = 0;
+            if (g.ActiveId == ms->ID)
+                ClearActiveID();
+        }
+        else
+        {
+            KeepAliveID(ms->ID);
+            if (g.BoxSelectStartFirst == -2)
+            {
+                g.BoxSelectStartFirst = ms->BoxSelectFirst[0];
+                g.BoxSelectStartLast = ms->BoxSelectLast[0];
+            }
+            const bool dragging_down = (ms->BoxSelectY[1] >= ms->BoxSelectY[0]);
+            const int item_first = dragging_down ? g.BoxSelectStartFirst : ms->BoxSelectFirst[1];
+            const int item_last = dragging_down ? ms->BoxSelectLast[1] : g.BoxSelectStartLast;
+            selection->Bounds = g.BoxSelectInitial.Bounds;
+            if (item_first <= item_last)
+                selection->SetRange(item_first, item_last + 1, true);
+
+            // Render (clipped to avoid large coordinates when the start has been scrolled far away)
+            ImRect box_rect(ImVec2(window->Pos.x - window->Scroll.x + g.BoxSelectStartPosRel.x, ms->BoxSelectY[0]), g.IO.MousePos);
+            if (box_rect.Min.x > box_rect.Max.x) ImSwap(box_rect.Min.x, box_rect.Max.x);
+            if (box_rect.Min.y > box_rect.Max.y) ImSwap(box_rect.Min.y, box_rect.Max.y);
+            box_rect.ClipWithFull(ImRect(window->InnerClipRect.Min - ImVec2(2, 2), window->InnerClipRect.Max + ImVec2(2, 2)));
+            window->DrawList->AddRectFilled(box_rect.Min, box_rect.Max, GetColorU32(ImGuiCol_SeparatorHovered, 0.30f));
+            window->DrawList->AddRect(box_rect.Min, box_rect.Max, GetColorU32(ImGuiCol_SeparatorHovered));
+
+            // Scroll when the mouse is above or below the visible area, once the start line has been measured
+            const float scroll_dist = (g.IO.MousePos.y < window->InnerClipRect.Min.y) ? g.IO.MousePos.y - window->InnerClipRect.Min.y : (g.IO.MousePos.y > window->InnerClipRect.Max.y) ? g.IO.MousePos.y - window->InnerClipRect.Max.y : 0.0f;
+            if (scroll_dist != 0.0f)
+                SetScrollY(window, window->Scroll.y + ImClamp(scroll_dist, -100.0f, 100.0f) * g.IO.DeltaTime * 20.0f);
+        }
+    }
+
+    // Click in empty space: clear the selection and start box-selection
+    if (g.BoxSelectId == 0 && IsMouseClicked(0) && g.HoveredWindow == window && g.HoveredId == 0 && g.HoveredIdPreviousFrame == 0 && g.ActiveId == 0 && window->InnerClipRect.Contains(g.IO.MousePos))
+    {
+        if (!ms->KeyCtrl && !ms->KeyShift && !(ms->Flags & ImGuiMultiSelectFlags_NoClearOnClickVoid))
+            selection->Clear();
+        if (!(ms->Flags & ImGuiMultiSelectFlags_NoBoxSelect))
+        {
+            g.BoxSelectId = ms->ID;
+            g.BoxSelectStartPosRel = g.IO.MousePos - window->Pos + window->Scroll;
+            g.BoxSelectStartFirst = g.BoxSelectStartLast = -2;
+            g.BoxSelectInitial.Bounds = selection->Bounds;
+            SetActiveID(ms->ID, window);
+        }
+    }
+}
+
+void ImGui::SetNextItemSelectionIndex(int item_idx)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.CurrentMultiSelect != NULL && "Call between BeginMultiSelect() and EndMultiSelect()");
+    IM_ASSERT(item_idx >= 0 && item_idx < g.CurrentMultiSelect->ItemsCount);
+    g.NextItemData.Flags |= ImGuiNextItemDataFlags_HasSelectionIndex;
+    g.NextItemData.SelectionIndex = item_idx;
+}
+
+// Called by Selectable()/TreeNodeBehavior() after ButtonBehavior()
+bool ImGui::MultiSelectItemFooter(ImGuiID id, int item_idx, const ImRect& bb, bool pressed)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiMultiSelectTempData* ms = g.CurrentMultiSelect;
+    IM_ASSERT(ms != NULL);
+    ImGuiSelectionRanges* selection = ms->Selection;
+
+    if (ms->BoxSelectActive)
+        for (int n = 0; n < 2; n++)
+        {
+            if (bb.Max.y > ms->BoxSelectY[n])
+                ms->BoxSelectFirst[n] = ImMin(ms->BoxSelectFirst[n], item_idx);
+            if (bb.Min.y < ms->BoxSelectY[n])
+                ms->BoxSelectLast[n] = ImMax(ms->BoxSelectLast[n], item_idx);
+        }
+
+    // Keyboard navigation selects the item it lands on (with SHIFT: range from the anchor, with CTRL: only move)
+    bool apply = false, key_ctrl = false, key_shift = false;
+    if (g.NavJustMovedToId == id)
+    {
+        key_ctrl = (g.NavJustMovedToKeyMods & (g.IO.ConfigMacOSXBehaviors ? ImGuiKeyModFlags_Super : ImGuiKeyModFlags_Ctrl)) != 0;
+        key_shift = (g.NavJustMovedToKeyMods & ImGuiKeyModFlags_Shift) != 0;
+        apply = !key_ctrl || key_shift;
+    }
+    else if (pressed)
+    {
+        key_ctrl = ms->KeyCtrl;
+        key_shift = ms->KeyShift;
+        apply = true;
+    }
+    if (!apply)
+        return selection->Contains(item_idx);
+
+    if (key_shift && selection->Anchor >= 0)
+    {
+        if (!key_ctrl)
+            selection->Bounds.resize(0);
+        selection->SetRange(ImMin(selection->Anchor, item_idx), ImMax(selection->Anchor, item_idx) + 1, true);
+    }
+    else if (key_ctrl)
+    {
+        selection->SetSelected(item_idx, !selection->Contains(item_idx));
+        selection->Anchor = item_idx;
+    }
+    else
+    {
+        selection->Bounds.resize(0);
+        selection->SetSelected(item_idx, true);
+        selection->Anchor = item_idx;
+    }
+    return selection->Contains(item_idx);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: ListBox
 //-------------------------------------------------------------------------
@@ -6167,10 +7140,17 @@ bool ImGui::ListBox(const char* label, int* current_item, bool (*items_getter)(v
         return false;
 
     // Assume all items have even height (= 1 line of text). If you need items of different or variable sizes you can create a custom version of ListBox() in your code without using the clipper.
+    // The current item is submitted on the appearing frame so SetItemDefaultFocus() can scroll to it, and the item matching typed characters (if any) gets focus.
     ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    const int type_ahead_item = TypeAheadFindItem(items_count, TypeAheadGetSearchItem(*current_item), items_getter, data);
     bool value_changed = false;
     ImGuiListClipper clipper;
     clipper.Begin(items_count, GetTextLineHeightWithSpacing()); // We know exactly our line height here so we pass it as a minor optimization, but generally you don't need to.
+    if (window->Appearing)
+        clipper.ForceDisplayRangeByIndices(*current_item, *current_item + 1);
+    if (type_ahead_item >= 0)
+        clipper.ForceDisplayRangeByIndices(type_ahead_item, type_ahead_item + 1);
     while (clipper.Step())
         for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
         {
@@ -6187,6 +7167,8 @@ bool ImGui::ListBox(const char* label, int* current_item, bool (*items_getter)(v
             }
             if (item_selected)
                 SetItemDefaultFocus();
+            if (i == type_ahead_item)
+                TypeAheadFocusLastItem(i);
             PopID();
         }
     ListBoxFooter();
@@ -6199,12 +7181,502 @@ bool ImGui::ListBox(const char* label, int* current_item, bool (*items_getter)(v
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: PlotLines, PlotHistogram
 //-------------------------------------------------------------------------
+// - ImGuiPlotSeries
+// - ImGuiPlotEnvelope, ImGuiPlotAsyncEnvelope
 // - PlotEx() [Internal]
+// - PlotEnvelopeEx() [Internal]
 // - PlotLines()
 // - PlotHistogram()
 //-------------------------------------------------------------------------
 
+void ImGuiPlotSource::InitSpans(const float* values0, int count0, const float* values1, int count1, int stride)
+{
+    Spans[0] = values0;
+    Spans[1] = values1;
+    SpansCount[0] = count0;
+    SpansCount[1] = count1;
+    Stride = stride;
+    ValuesGetter = NULL;
+    Series = NULL;
+    ValuesCount = count0 + count1;
+}
+
+float ImGuiPlotSource::GetValue(int idx) const
+{
+    IM_ASSERT(idx >= 0 && idx < ValuesCount);
+    if (ValuesGetter)
+        return ValuesGetter(ValuesGetterData, (idx + ValuesOffset) % ValuesCount);
+    if (Series)
+        return Series->GetValue(ValuesOffset + idx);
+    const int span = (idx < SpansCount[0]) ? 0 : 1;
+    return *(const float*)(const void*)((const unsigned char*)Spans[span] + (size_t)(idx - (span ? SpansCount[0] : 0)) * Stride);
+}
+
+// Comparisons with NaN are false, so NaN values are ignored without branching. Packed values are scanned with 4 independent
+// accumulators, which breaks the dependency chain and lets compilers vectorize the loop.
+static void PlotCalcMinMax(const float* values, int count, int stride, float* io_min, float* io_max)
+{
+    float v_min = *io_min, v_max = *io_max;
+    int i = 0;
+    if (stride == sizeof(float) && count >= 8)
+    {
+        float mn[4] = { v_min, v_min, v_min, v_min };
+        float mx[4] = { v_max, v_max, v_max, v_max };
+        for (; i + 4 <= count; i += 4)
+            for (int k = 0; k < 4; k++)
+            {
+                const float v = values[i + k];
+                mn[k] = (v < mn[k]) ? v : mn[k];
+                mx[k] = (v > mx[k]) ? v : mx[k];
+            }
+        v_min = ImMin(ImMin(mn[0], mn[1]), ImMin(mn[2], mn[3]));
+        v_max = ImMax(ImMax(mx[0], mx[1]), ImMax(mx[2], mx[3]));
+    }
+    for (; i < count; i++)
+    {
+        const float v = *(const float*)(const void*)((const unsigned char*)values + (size_t)i * stride);
+        v_min = (v < v_min) ? v : v_min;
+        v_max = (v > v_max) ? v : v_max;
+    }
+    *io_min = v_min;
+    *io_max = v_max;
+}
+
+void ImGuiPlotSource::CalcColumnsMinMax(ImVec2* out_columns, int columns_count) const
+{
+    if (Series)
+    {
+        Series->CalcColumnsMinMax(ValuesOffset, ValuesOffset + ValuesCount, out_columns, columns_count);
+        return;
+    }
+    for (int n = 0; n < columns_count; n++)
+    {
+        out_columns[n] = ImVec2(FLT_MAX, -FLT_MAX);
+        CalcMinMax((int)((ImS64)n * ValuesCount / columns_count), (int)((ImS64)(n + 1) * ValuesCount / columns_count), &out_columns[n].x, &out_columns[n].y);
+    }
+}
+
+void ImGuiPlotSource::CalcMinMax(int idx_begin, int idx_end, float* io_min, float* io_max) const
+{
+    IM_ASSERT(idx_begin >= 0 && idx_begin <= idx_end && idx_end <= ValuesCount);
+    if (ValuesGetter)
+    {
+        float v_min = *io_min, v_max = *io_max;
+        for (int i = idx_begin; i < idx_end; i++)
+        {
+            const float v = ValuesGetter(ValuesGetterData, (i + ValuesOffset) % ValuesCount);
+            v_min = (v < v_min) ? v : v_min;
+            v_max = (v > v_max) ? v : v_max;
+        }
+        *io_min = v_min;
+        *io_max = v_max;
+        return;
+    }
+    if (Series)
+    {
+        float v_min, v_max;
+        Series->CalcMinMax(ValuesOffset + idx_begin, ValuesOffset + idx_end, &v_min, &v_max);
+        *io_min = ImMin(*io_min, v_min);
+        *io_max = ImMax(*io_max, v_max);
+        return;
+    }
+    if (idx_begin < SpansCount[0])
+        PlotCalcMinMax((const float*)(const void*)((const unsigned char*)Spans[0] + (size_t)idx_begin * Stride), ImMin(idx_end, SpansCount[0]) - idx_begin, Stride, io_min, io_max);
+    if (idx_end > SpansCount[0])
+    {
+        const int begin = ImMax(idx_begin - SpansCount[0], 0);
+        PlotCalcMinMax((const float*)(const void*)((const unsigned char*)Spans[1] + (size_t)begin * Stride), idx_end - SpansCount[0] - begin, Stride, io_min, io_max);
+    }
+}
+
+float ImGuiPlotSource::CalcMean(int idx_begin, int idx_end) const
+{
+    IM_ASSERT(idx_begin >= 0 && idx_begin <= idx_end && idx_end <= ValuesCount);
+    double sum = 0.0;
+    int count = 0;
+    if (ValuesGetter || Series)
+    {
+        for (int i = idx_begin; i < idx_end; i++)
+        {
+            const float v = GetValue(i);
+            if (v == v) // Not NaN
+            {
+                sum += v;
+                count++;
+            }
+        }
+    }
+    else
+    {
+        for (int span = 0; span < 2; span++)
+        {
+            const int span_offset = span ? SpansCount[0] : 0;
+            const int begin = ImMax(idx_begin - span_offset, 0);
+            const int end = ImMin(idx_end - span_offset, SpansCount[span]);
+            for (int i = begin; i < end; i++)
+            {
+                const float v = *(const float*)(const void*)((const unsigned char*)Spans[span] + (size_t)i * Stride);
+                if (v == v)
+                {
+                    sum += v;
+                    count++;
+                }
+            }
+        }
+    }
+    return count > 0 ? (float)(sum / count) : 0.0f;
+}
+
+void ImGuiPlotSeries::PushBack(float v)
+{
+    if (MaxCount > 0 && Values.Size == MaxCount)
+    {
+        // Full ring buffer: overwrite the oldest value
+        const int storage_idx = Head;
+        Head = (Head + 1 == Values.Size) ? 0 : Head + 1;
+        Values[storage_idx] = v;
+        UpdateLevels(storage_idx);
+        return;
+    }
+    if (MaxCount > 0 && Values.Capacity < MaxCount)
+        Values.reserve(ImMin(Values._grow_capacity(Values.Size + 1), MaxCount));
+    Values.push_back(v);
+    UpdateLevels(Values.Size - 1);
+}
+
+void ImGuiPlotSeries::SetValue(int idx, float v)
+{
+    IM_ASSERT(idx >= 0 && idx < Values.Size);
+    idx += Head;
+    if (idx >= Values.Size)
+        idx -= Values.Size;
+    Values[idx] = v;
+    UpdateLevels(idx);
+}
+
+// Recompute the min/max of the blocks containing Values[storage_idx], adding blocks at the end of levels as needed
+void ImGuiPlotSeries::UpdateLevels(int storage_idx)
+{
+    int n = storage_idx >> 4;
+    const int values_end = ImMin((n + 1) << 4, Values.Size);
+    ImVec2 mm(FLT_MAX, -FLT_MAX);
+    for (int i = n << 4; i < values_end; i++)
+    {
+        const float v = Values[i];
+        mm.x = (v < mm.x) ? v : mm.x;
+        mm.y = (v > mm.y) ? v : mm.y;
+    }
+    for (int k = 0; ; k++)
+    {
+        IM_ASSERT(k < IM_ARRAYSIZE(Levels));
+        ImVector<ImVec2>& level = Levels[k];
+        if (n == level.Size)
+            level.push_back(mm);
+        else
+            level[n] = mm;
+        if (level.Size == 1)
+            break;
+        // Parent block: combine with the sibling block, if any
+        const int sibling = n ^ 1;
+        if (sibling < level.Size)
+            mm = ImVec2(ImMin(mm.x, level[sibling].x), ImMax(mm.y, level[sibling].y));
+        n >>= 1;
+    }
+}
+
+// Min/max of Values[storage_begin, storage_end): values at both ends are scanned until aligned on 16, the rest is covered by at most 2 blocks per level
+void ImGuiPlotSeries::CalcStorageMinMax(int storage_begin, int storage_end, float* io_min, float* io_max) const
+{
+    float v_min = *io_min, v_max = *io_max;
+    int lo = storage_begin, hi = storage_end;
+    if ((lo >> 4) == (hi >> 4) || lo + 32 > hi)
+    {
+        for (int i = lo; i < hi; i++)
+        {
+            const float v = Values[i];
+            v_min = (v < v_min) ? v : v_min;
+            v_max = (v > v_max) ? v : v_max;
+        }
+        *io_min = v_min;
+        *io_max = v_max;
+        return;
+    }
+    for (; lo & 15; lo++)
+    {
+        const float v = Values[lo];
+        v_min = (v < v_min) ? v : v_min;
+        v_max = (v > v_max) ? v : v_max;
+    }
+    for (; hi & 15; hi--)
+    {
+        const float v = Values[hi - 1];
+        v_min = (v < v_min) ? v : v_min;
+        v_max = (v > v_max) ? v : v_max;
+    }
+    lo >>= 4;
+    hi >>= 4;
+    for (int k = 0; lo < hi; k++, lo >>= 1, hi >>= 1)
+    {
+        const ImVector<ImVec2>& level = Levels[k];
+        if (lo & 1)
+        {
+            v_min = ImMin(v_min, level[lo].x);
+            v_max = ImMax(v_max, level[lo].y);
+            lo++;
+        }
+        if (hi & 1)
+        {
+            hi--;
+            v_min = ImMin(v_min, level[hi].x);
+            v_max = ImMax(v_max, level[hi].y);
+        }
+    }
+    *io_min = v_min;
+    *io_max = v_max;
+}
+
+// Values [idx_begin, idx_end) are stored in one or two ranges of the ring buffer. Ranges aligned on blocks of Levels[level] are read
+// from that level, others are computed exactly with CalcStorageMinMax().
+void ImGuiPlotSeries::CalcRangeMinMax(int idx_begin, int idx_end, int level, float* io_min, float* io_max) const
+{
+    if (idx_begin == idx_end)
+        return;
+    int storage_begin = (Head + idx_begin) % Values.Size;
+    int storage_end = storage_begin + (idx_end - idx_begin);
+    int wrap_end = 0;
+    if (storage_end > Values.Size)
+    {
+        wrap_end = storage_end - Values.Size;
+        storage_end = Values.Size;
+    }
+    for (int range_n = 0; range_n < 2; range_n++)
+    {
+        const int block_mask = (level >= 0) ? (16 << level) - 1 : 0;
+        if (level >= 0 && (storage_begin & block_mask) == 0 && ((storage_end & block_mask) == 0 || storage_end == Values.Size))
+        {
+            const ImVector<ImVec2>& blocks = Levels[level];
+            float v_min = *io_min, v_max = *io_max;
+            for (int n = storage_begin >> (level + 4), n_end = (storage_end + block_mask) >> (level + 4); n < n_end; n++)
+            {
+                v_min = ImMin(v_min, blocks[n].x);
+                v_max = ImMax(v_max, blocks[n].y);
+            }
+            *io_min = v_min;
+            *io_max = v_max;
+        }
+        else
+        {
+            CalcStorageMinMax(storage_begin, storage_end, io_min, io_max);
+        }
+        if (wrap_end == 0)
+            break;
+        storage_begin = 0;
+        storage_end = wrap_end;
+    }
+}
+
+void ImGuiPlotSeries::CalcMinMax(int idx_begin, int idx_end, float* out_min, float* out_max) const
+{
+    IM_ASSERT(idx_begin >= 0 && idx_begin <= idx_end && idx_end <= Values.Size);
+    *out_min = FLT_MAX;
+    *out_max = -FLT_MAX;
+    CalcRangeMinMax(idx_begin, idx_end, -1, out_min, out_max);
+}
+
+// Exact queries for each column would cost O(log N) but touch each level of the pyramid at random places. Instead, boundaries
+// between columns are moved back to the start of a block of the largest level whose blocks are no more than half a column,
+// so the inside of each column is read sequentially from that level. The first and last boundaries are kept exact.
+void ImGuiPlotSeries::CalcColumnsMinMax(int idx_begin, int idx_end, ImVec2* out_columns, int columns_count) const
+{
+    IM_ASSERT(idx_begin >= 0 && idx_begin <= idx_end && idx_end <= Values.Size && columns_count > 0);
+    const int count = idx_end - idx_begin;
+    int level = -1;
+    while (level + 1 < IM_ARRAYSIZE(Levels) && (32 << (level + 1)) <= count / columns_count)
+        level++;
+    int column_begin = idx_begin;
+    for (int n = 0; n < columns_count; n++)
+    {
+        int column_end = idx_begin + (int)((ImS64)(n + 1) * count / columns_count);
+        if (level >= 0 && n + 1 < columns_count)
+            column_end -= ((Head + column_end) % Values.Size) & ((16 << level) - 1);
+        out_columns[n] = ImVec2(FLT_MAX, -FLT_MAX);
+        CalcRangeMinMax(column_begin, column_end, level, &out_columns[n].x, &out_columns[n].y);
+        column_begin = column_end;
+    }
+}
+
+// Doesn't use the context, and doesn't allocate when envelope->Columns (and envelope->ColumnsMean) have enough capacity: may be called from any thread
+// columns_count < 0: keep the size of envelope->Columns
+static void PlotBuildEnvelope(ImGuiPlotEnvelope* envelope, const ImGuiPlotSource& source, int columns_count)
+{
+    const int values_count = source.ValuesCount;
+    if (columns_count < 0)
+        columns_count = envelope->Columns.Size;
+    else
+        envelope->Columns.resize(columns_count);
+    if (values_count > columns_count && columns_count > 0)
+    {
+        source.CalcColumnsMinMax(envelope->Columns.Data, columns_count);
+    }
+    else
+    {
+        // Fewer values than columns: stretch values over columns
+        for (int n = 0; n < columns_count; n++)
+        {
+            const int idx = (int)((ImS64)n * values_count / columns_count);
+            envelope->Columns[n] = ImVec2(FLT_MAX, -FLT_MAX);
+            source.CalcMinMax(idx, ImMin(idx + 1, values_count), &envelope->Columns[n].x, &envelope->Columns[n].y);
+        }
+    }
+
+    // Mean of each column, over the exact range of values covered by the column (the min/max of a ImGuiPlotSeries may use slightly moved boundaries)
+    if (envelope->BuildMean)
+    {
+        if (columns_count != envelope->ColumnsMean.Size)
+            envelope->ColumnsMean.resize(columns_count);
+        for (int n = 0; n < columns_count; n++)
+        {
+            const int idx_begin = (int)((ImS64)n * values_count / columns_count);
+            const int idx_end = (values_count > columns_count) ? (int)((ImS64)(n + 1) * values_count / columns_count) : ImMin(idx_begin + 1, values_count);
+            envelope->ColumnsMean[n] = source.CalcMean(idx_begin, idx_end);
+        }
+    }
+    else
+    {
+        envelope->ColumnsMean.resize(0);
+    }
+
+    envelope->ValuesMin = FLT_MAX;
+    envelope->ValuesMax = -FLT_MAX;
+    for (int n = 0; n < envelope->Columns.Size; n++)
+    {
+        envelope->ValuesMin = ImMin(envelope->ValuesMin, envelope->Columns[n].x);
+        envelope->ValuesMax = ImMax(envelope->ValuesMax, envelope->Columns[n].y);
+    }
+    envelope->ValuesCount = values_count;
+}
+
+void ImGuiPlotEnvelope::Build(const float* values, int values_count, int values_offset, int columns_count, int stride)
+{
+    ImGuiPlotSource source;
+    source.InitRing(values, values_count, values_offset, stride);
+    PlotBuildEnvelope(this, source, columns_count);
+}
+
+void ImGuiPlotEnvelope::Build(const ImGuiPlotSeries* series, int display_start, int display_count, int columns_count)
+{
+    display_start = ImClamp(display_start, 0, series->Size());
+    display_count = (display_count < 0) ? series->Size() - display_start : ImMin(display_count, series->Size() - display_start);
+    ImGuiPlotSource source;
+    source.InitSeries(series, display_start, display_count);
+    PlotBuildEnvelope(this, source, columns_count);
+}
+
+ImGuiPlotEnvelope* ImGuiPlotAsyncEnvelope::BeginBuild(unsigned int data_version)
+{
+    if (Building || ColumnsCount <= 0)
+        return NULL;
+    if (const ImGuiPlotEnvelope* displayed = GetDisplayed())
+        if (displayed->Version == data_version && displayed->Columns.Size == ColumnsCount && displayed->BuildMean == BuildMean)
+            return NULL;
+    ImGuiPlotEnvelope* envelope = &Envelopes[FrontIdx < 0 ? 0 : FrontIdx ^ 1];
+    envelope->Columns.resize(ColumnsCount);     // Fix the column count and allocate on this thread, Build() may run on another one
+    envelope->ColumnsMean.resize(BuildMean ? ColumnsCount : 0);
+    envelope->BuildMean = BuildMean;
+    envelope->Version = data_version;
+    Building = true;
+    BuildFrame = ImGui::GetFrameCount();
+    return envelope;
+}
+
+void ImGuiPlotAsyncEnvelope::EndBuild()
+{
+    IM_ASSERT(Building && "Call BeginBuild() first!");
+    FrontIdx = (FrontIdx < 0) ? 0 : FrontIdx ^ 1;
+    Building = false;
+}
+
+// Draw one rectangle per pixel column, spanning the min/max of the column. For lines, a column is extended up to the range of the previous one so the plot stays connected.
+static void PlotRenderColumns(ImDrawList* draw_list, ImGuiPlotType plot_type, const ImRect& inner_bb, const ImVec2* columns, int columns_count, float scale_min, float scale_max, int column_hovered, ImU32 col_base, ImU32 col_hovered)
+{
+    const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+    const float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (-scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);
+    const float zero_y = ImLerp(inner_bb.Min.y, inner_bb.Max.y, histogram_zero_line_t);
+    const float column_w = inner_bb.GetWidth() / (float)columns_count;
+    draw_list->PrimReserve(columns_count * 6, columns_count * 4);
+    int rects_count = 0;
+    float prev_min = FLT_MAX, prev_max = -FLT_MAX;
+    for (int n = 0; n < columns_count; n++)
+    {
+        const ImVec2 column = columns[n];
+        if (column.x > column.y) // No valid value (all NaN)
+        {
+            prev_min = FLT_MAX;
+            prev_max = -FLT_MAX;
+            continue;
+        }
+        float v_min = column.x, v_max = column.y;
+        if (plot_type == ImGuiPlotType_Lines && prev_min <= prev_max)
+        {
+            v_min = ImMin(v_min, prev_max);
+            v_max = ImMax(v_max, prev_min);
+        }
+        prev_min = column.x;
+        prev_max = column.y;
+
+        float y0 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_max - scale_min) * inv_scale));
+        float y1 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v_min - scale_min) * inv_scale));
+        if (plot_type == ImGuiPlotType_Lines)
+        {
+            y1 = ImMax(y1, y0 + 1.0f);
+        }
+        else if (plot_type == ImGuiPlotType_Histogram)
+        {
+            y0 = ImMin(y0, zero_y);
+            y1 = ImMax(y1, zero_y);
+        }
+        const float x0 = inner_bb.Min.x + n * column_w;
+        draw_list->PrimRect(ImVec2(x0, y0), ImVec2(x0 + ImMax(column_w, 1.0f), y1), (n == column_hovered) ? col_hovered : col_base);
+        rects_count++;
+    }
+    draw_list->PrimUnreserve((columns_count - rects_count) * 6, (columns_count - rects_count) * 4);
+}
+
+// Draw the mean of each pixel column: connected line through the column centers, or bars from the zero line. Columns without values are skipped.
+static void PlotRenderColumnsMean(ImDrawList* draw_list, ImGuiPlotType plot_type, const ImRect& inner_bb, const ImVec2* columns, const float* means, int columns_count, float scale_min, float scale_max, int column_hovered, ImU32 col_base, ImU32 col_hovered)
+{
+    const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+    const float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (-scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);
+    const float zero_y = ImLerp(inner_bb.Min.y, inner_bb.Max.y, histogram_zero_line_t);
+    const float column_w = inner_bb.GetWidth() / (float)columns_count;
+    for (int n = 0; n < columns_count; n++)
+    {
+        if (columns[n].x > columns[n].y) // No valid value (all NaN)
+        {
+            if (plot_type == ImGuiPlotType_Lines)
+                draw_list->PathStroke(col_base, false);
+            continue;
+        }
+        const float y = ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((means[n] - scale_min) * inv_scale));
+        const float x0 = inner_bb.Min.x + n * column_w;
+        if (plot_type == ImGuiPlotType_Lines)
+            draw_list->PathLineTo(ImVec2(x0 + column_w * 0.5f, y));
+        else
+            draw_list->AddRectFilled(ImVec2(x0, ImMin(y, zero_y)), ImVec2(x0 + ImMax(column_w, 1.0f), ImMax(ImMax(y, zero_y), ImMin(y, zero_y) + 1.0f)), (n == column_hovered) ? col_hovered : col_base);
+    }
+    if (plot_type == ImGuiPlotType_Lines)
+        draw_list->PathStroke(col_base, false);
+}
+
 int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size)
+{
+    ImGuiPlotSource source;
+    source.InitGetter(values_getter, data, values_count, values_offset);
+    return PlotEx(plot_type, label, source, overlay_text, scale_min, scale_max, frame_size);
+}
+
+// When there are more values than pixel columns, values are decimated: each column is drawn as the [min,max] range of the values it covers.
+int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotSource& source, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size)
 {
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = GetCurrentWindow();
@@ -6228,18 +7700,23 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
         return -1;
     const bool hovered = ItemHoverable(frame_bb, id);
 
-    // Determine scale from values if not specified
-    if (scale_min == FLT_MAX || scale_max == FLT_MAX)
+    const int values_count = source.ValuesCount;
+    const int values_count_min = (plot_type == ImGuiPlotType_Lines) ? 2 : 1;
+    const int item_count = values_count + ((plot_type == ImGuiPlotType_Lines) ? -1 : 0);
+
+    // Decimate to the pixel width: a single pass computes the min/max of each column, from which we also derive the scale
+    const int columns_count = (int)inner_bb.GetWidth();
+    const bool decimate = (values_count >= values_count_min && columns_count >= 1 && item_count > columns_count);
+    if (decimate)
     {
+        g.PlotColumns.resize(columns_count);
+        source.CalcColumnsMinMax(g.PlotColumns.Data, columns_count);
         float v_min = FLT_MAX;
         float v_max = -FLT_MAX;
-        for (int i = 0; i < values_count; i++)
+        for (int n = 0; n < columns_count; n++)
         {
-            const float v = values_getter(data, i);
-            if (v != v) // Ignore NaN values
-                continue;
-            v_min = ImMin(v_min, v);
-            v_max = ImMax(v_max, v);
+            v_min = ImMin(v_min, g.PlotColumns[n].x);
+            v_max = ImMax(v_max, g.PlotColumns[n].y);
         }
         if (scale_min == FLT_MAX)
             scale_min = v_min;
@@ -6247,14 +7724,24 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
             scale_max = v_max;
     }
 
+    // Determine scale from values if not specified
+    if (scale_min == FLT_MAX || scale_max == FLT_MAX)
+    {
+        float v_min = FLT_MAX;
+        float v_max = -FLT_MAX;
+        source.CalcMinMax(0, values_count, &v_min, &v_max);
+        if (scale_min == FLT_MAX)
+            scale_min = v_min;
+        if (scale_max == FLT_MAX)
+            scale_max = v_max;
+    }
+
     RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
 
-    const int values_count_min = (plot_type == ImGuiPlotType_Lines) ? 2 : 1;
     int idx_hovered = -1;
     if (values_count >= values_count_min)
     {
         int res_w = ImMin((int)frame_size.x, values_count) + ((plot_type == ImGuiPlotType_Lines) ? -1 : 0);
-        int item_count = values_count + ((plot_type == ImGuiPlotType_Lines) ? -1 : 0);
 
         // Tooltip on hover
         if (hovered && inner_bb.Contains(g.IO.MousePos))
@@ -6263,8 +7750,8 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
             const int v_idx = (int)(t * item_count);
             IM_ASSERT(v_idx >= 0 && v_idx < values_count);
 
-            const float v0 = values_getter(data, (v_idx + values_offset) % values_count);
-            const float v1 = values_getter(data, (v_idx + 1 + values_offset) % values_count);
+            const float v0 = source.GetValue(v_idx);
+            const float v1 = source.GetValue((v_idx + 1) % values_count);
             if (plot_type == ImGuiPlotType_Lines)
                 SetTooltip("%d: %8.4g\n%d: %8.4g", v_idx, v0, v_idx + 1, v1);
             else if (plot_type == ImGuiPlotType_Histogram)
@@ -6272,41 +7759,50 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
             idx_hovered = v_idx;
         }
 
-        const float t_step = 1.0f / (float)res_w;
         const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
-
-        float v0 = values_getter(data, (0 + values_offset) % values_count);
-        float t0 = 0.0f;
-        ImVec2 tp0 = ImVec2( t0, 1.0f - ImSaturate((v0 - scale_min) * inv_scale) );                       // Point in the normalized space of our target rectangle
         float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (-scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);   // Where does the zero line stands
 
         const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
         const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
 
-        for (int n = 0; n < res_w; n++)
+        if (decimate)
         {
-            const float t1 = t0 + t_step;
-            const int v1_idx = (int)(t0 * item_count + 0.5f);
-            IM_ASSERT(v1_idx >= 0 && v1_idx < values_count);
-            const float v1 = values_getter(data, (v1_idx + values_offset + 1) % values_count);
-            const ImVec2 tp1 = ImVec2( t1, 1.0f - ImSaturate((v1 - scale_min) * inv_scale) );
+            const int column_hovered = (idx_hovered >= 0) ? (int)((ImS64)idx_hovered * columns_count / values_count) : -1;
+            PlotRenderColumns(window->DrawList, plot_type, inner_bb, g.PlotColumns.Data, columns_count, scale_min, scale_max, column_hovered, col_base, col_hovered);
+        }
+        else
+        {
+            const float t_step = 1.0f / (float)res_w;
 
-            // NB: Draw calls are merged together by the DrawList system. Still, we should render our batch are lower level to save a bit of CPU.
-            ImVec2 pos0 = ImLerp(inner_bb.Min, inner_bb.Max, tp0);
-            ImVec2 pos1 = ImLerp(inner_bb.Min, inner_bb.Max, (plot_type == ImGuiPlotType_Lines) ? tp1 : ImVec2(tp1.x, histogram_zero_line_t));
-            if (plot_type == ImGuiPlotType_Lines)
-            {
-                window->DrawList->AddLine(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
-            }
-            else if (plot_type == ImGuiPlotType_Histogram)
+            float v0 = source.GetValue(0);
+            float t0 = 0.0f;
+            ImVec2 tp0 = ImVec2( t0, 1.0f - ImSaturate((v0 - scale_min) * inv_scale) );                       // Point in the normalized space of our target rectangle
+
+            for (int n = 0; n < res_w; n++)
             {
-                if (pos1.x >= pos0.x + 2.0f)
-                    pos1.x -= 1.0f;
-                window->DrawList->AddRectFilled(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
-            }
+                const float t1 = t0 + t_step;
+                const int v1_idx = (int)(t0 * item_count + 0.5f);
+                IM_ASSERT(v1_idx >= 0 && v1_idx < values_count);
+                const float v1 = source.GetValue((v1_idx + 1) % values_count);
+                const ImVec2 tp1 = ImVec2( t1, 1.0f - ImSaturate((v1 - scale_min) * inv_scale) );
+
+                // NB: Draw calls are merged together by the DrawList system. Still, we should render our batch are lower level to save a bit of CPU.
+                ImVec2 pos0 = ImLerp(inner_bb.Min, inner_bb.Max, tp0);
+                ImVec2 pos1 = ImLerp(inner_bb.Min, inner_bb.Max, (plot_type == ImGuiPlotType_Lines) ? tp1 : ImVec2(tp1.x, histogram_zero_line_t));
+                if (plot_type == ImGuiPlotType_Lines)
+                {
+                    window->DrawList->AddLine(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
+                }
+                else if (plot_type == ImGuiPlotType_Histogram)
+                {
+                    if (pos1.x >= pos0.x + 2.0f)
+                        pos1.x -= 1.0f;
+                    window->DrawList->AddRectFilled(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
+                }
 
-            t0 = t1;
-            tp0 = tp1;
+                t0 = t1;
+                tp0 = tp1;
+            }
         }
     }
 
@@ -6322,25 +7818,115 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     return idx_hovered;
 }
 
-struct ImGuiPlotArrayGetterData
+// Draw an envelope built beforehand (possibly on another thread), resampled if its number of columns doesn't match the plot width
+int ImGui::PlotEnvelopeEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotEnvelope* envelope, const char* overlay_text, float scale_min, float scale_max, ImVec2 frame_size)
 {
-    const float* Values;
-    int Stride;
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return -1;
 
-    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
-};
+    const ImGuiStyle& style = g.Style;
+    const ImGuiID id = window->GetID(label);
 
-static float Plot_ArrayGetter(void* data, int idx)
-{
-    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
-    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
-    return v;
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    if (frame_size.x == 0.0f)
+        frame_size.x = CalcItemWidth();
+    if (frame_size.y == 0.0f)
+        frame_size.y = label_size.y + (style.FramePadding.y * 2);
+
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
+    const ImRect inner_bb(frame_bb.Min + style.FramePadding, frame_bb.Max - style.FramePadding);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Max + ImVec2(label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f, 0));
+    ItemSize(total_bb, style.FramePadding.y);
+    if (!ItemAdd(total_bb, 0, &frame_bb))
+        return -1;
+    const bool hovered = ItemHoverable(frame_bb, id);
+    const int columns_count = ImMax((int)inner_bb.GetWidth(), 1);
+
+    RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
+
+    if (envelope != NULL && envelope->Columns.Size > 0)
+    {
+        if (scale_min == FLT_MAX)
+            scale_min = envelope->ValuesMin;
+        if (scale_max == FLT_MAX)
+            scale_max = envelope->ValuesMax;
+
+        // Resample when the plot width changed since the envelope was built. Means are averaged without weighting, as columns cover about as many values.
+        const int envelope_columns_count = envelope->Columns.Size;
+        const ImVec2* columns = envelope->Columns.Data;
+        const float* means = (envelope->ColumnsMean.Size == envelope_columns_count) ? envelope->ColumnsMean.Data : NULL;
+        if (envelope_columns_count != columns_count)
+        {
+            g.PlotColumns.resize(columns_count);
+            if (means)
+                g.PlotColumnsMean.resize(columns_count);
+            for (int n = 0; n < columns_count; n++)
+            {
+                const int src_begin = (int)((ImS64)n * envelope_columns_count / columns_count);
+                const int src_end = ImMax(src_begin + 1, (int)((ImS64)(n + 1) * envelope_columns_count / columns_count));
+                ImVec2 column(FLT_MAX, -FLT_MAX);
+                float mean_sum = 0.0f;
+                int mean_count = 0;
+                for (int src_n = src_begin; src_n < src_end; src_n++)
+                {
+                    column = ImVec2(ImMin(column.x, columns[src_n].x), ImMax(column.y, columns[src_n].y));
+                    if (means && columns[src_n].x <= columns[src_n].y)
+                    {
+                        mean_sum += means[src_n];
+                        mean_count++;
+                    }
+                }
+                g.PlotColumns[n] = column;
+                if (means)
+                    g.PlotColumnsMean[n] = (mean_count > 0) ? mean_sum / mean_count : 0.0f;
+            }
+            columns = g.PlotColumns.Data;
+            if (means)
+                means = g.PlotColumnsMean.Data;
+        }
+
+        // Tooltip on hover
+        int column_hovered = -1;
+        if (hovered && inner_bb.Contains(g.IO.MousePos))
+        {
+            const float t = ImClamp((g.IO.MousePos.x - inner_bb.Min.x) / (inner_bb.Max.x - inner_bb.Min.x), 0.0f, 0.9999f);
+            column_hovered = (int)(t * columns_count);
+            const int idx_begin = (int)((ImS64)column_hovered * envelope->ValuesCount / columns_count);
+            const int idx_end = ImMax(idx_begin + 1, (int)((ImS64)(column_hovered + 1) * envelope->ValuesCount / columns_count));
+            if (idx_end - idx_begin > 1 && means)
+                SetTooltip("%d..%d: %8.4g..%8.4g, mean %8.4g", idx_begin, idx_end - 1, columns[column_hovered].x, columns[column_hovered].y, means[column_hovered]);
+            else if (idx_end - idx_begin > 1)
+                SetTooltip("%d..%d: %8.4g..%8.4g", idx_begin, idx_end - 1, columns[column_hovered].x, columns[column_hovered].y);
+            else
+                SetTooltip("%d: %8.4g", idx_begin, columns[column_hovered].x);
+        }
+
+        // With means, the min/max envelope is faded and the means are drawn over it
+        const ImGuiCol col_idx_base = (plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram;
+        const ImGuiCol col_idx_hovered = (plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered;
+        const float envelope_alpha = means ? 0.35f : 1.0f;
+        PlotRenderColumns(window->DrawList, plot_type, inner_bb, columns, columns_count, scale_min, scale_max, column_hovered, GetColorU32(col_idx_base, envelope_alpha), GetColorU32(col_idx_hovered, envelope_alpha));
+        if (means)
+            PlotRenderColumnsMean(window->DrawList, plot_type, inner_bb, columns, means, columns_count, scale_min, scale_max, column_hovered, GetColorU32(col_idx_base), GetColorU32(col_idx_hovered));
+    }
+
+    // Text overlay
+    if (overlay_text)
+        RenderTextClipped(ImVec2(frame_bb.Min.x, frame_bb.Min.y + style.FramePadding.y), frame_bb.Max, overlay_text, NULL, NULL, ImVec2(0.5f, 0.0f));
+
+    if (label_size.x > 0.0f)
+        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, inner_bb.Min.y), label);
+
+    return columns_count;
 }
 
 void ImGui::PlotLines(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
 {
-    ImGuiPlotArrayGetterData data(values, stride);
-    PlotEx(ImGuiPlotType_Lines, label, &Plot_ArrayGetter, (void*)&data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
+    ImGuiPlotSource source;
+    source.InitRing(values, values_count, values_offset, stride);
+    PlotEx(ImGuiPlotType_Lines, label, source, overlay_text, scale_min, scale_max, graph_size);
 }
 
 void ImGui::PlotLines(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
@@ -6350,8 +7936,9 @@ void ImGui::PlotLines(const char* label, float (*values_getter)(void* data, int
 
 void ImGui::PlotHistogram(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
 {
-    ImGuiPlotArrayGetterData data(values, stride);
-    PlotEx(ImGuiPlotType_Histogram, label, &Plot_ArrayGetter, (void*)&data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
+    ImGuiPlotSource source;
+    source.InitRing(values, values_count, values_offset, stride);
+    PlotEx(ImGuiPlotType_Histogram, label, source, overlay_text, scale_min, scale_max, graph_size);
 }
 
 void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
@@ -6359,6 +7946,49 @@ void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data,
     PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+static void PlotSeries(ImGuiPlotType plot_type, const char* label, const ImGuiPlotSeries* series, int display_start, int display_count, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    display_start = ImClamp(display_start, 0, series->Size());
+    display_count = (display_count < 0) ? series->Size() - display_start : ImMin(display_count, series->Size() - display_start);
+    ImGuiPlotSource source;
+    source.InitSeries(series, display_start, display_count);
+    ImGui::PlotEx(plot_type, label, source, overlay_text, scale_min, scale_max, graph_size);
+}
+
+void ImGui::PlotLines(const char* label, const ImGuiPlotSeries* series, int display_start, int display_count, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotSeries(ImGuiPlotType_Lines, label, series, display_start, display_count, overlay_text, scale_min, scale_max, graph_size);
+}
+
+void ImGui::PlotHistogram(const char* label, const ImGuiPlotSeries* series, int display_start, int display_count, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotSeries(ImGuiPlotType_Histogram, label, series, display_start, display_count, overlay_text, scale_min, scale_max, graph_size);
+}
+
+static void PlotAsyncEnvelope(ImGuiPlotType plot_type, const char* label, ImGuiPlotAsyncEnvelope* envelope, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    ImGuiContext& g = *GImGui;
+    if (envelope->Building && envelope->WaitBuildFn != NULL && g.FrameCount - envelope->BuildFrame >= envelope->MaxStaleFrames)
+    {
+        envelope->WaitBuildFn(envelope, envelope->WaitBuildUserData);
+        IM_ASSERT(!envelope->Building && "WaitBuildFn should call EndBuild()!");
+    }
+    // Clipped plots keep their previous width, so they don't request builds until visible
+    const int columns_count = ImGui::PlotEnvelopeEx(plot_type, label, envelope->GetDisplayed(), overlay_text, scale_min, scale_max, graph_size);
+    if (columns_count > 0)
+        envelope->ColumnsCount = columns_count;
+}
+
+void ImGui::PlotLines(const char* label, ImGuiPlotAsyncEnvelope* envelope, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotAsyncEnvelope(ImGuiPlotType_Lines, label, envelope, overlay_text, scale_min, scale_max, graph_size);
+}
+
+void ImGui::PlotHistogram(const char* label, ImGuiPlotAsyncEnvelope* envelope, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotAsyncEnvelope(ImGuiPlotType_Histogram, label, envelope, overlay_text, scale_min, scale_max, graph_size);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.
@@ -7939,10 +9569,7 @@ float ImGui::GetColumnOffset(int column_index)
     if (column_index < 0)
         column_index = columns->Current;
     IM_ASSERT(column_index < columns->Columns.Size);
-
-    const float t = columns->Columns[column_index].OffsetNorm;
-    const float x_offset = ImLerp(columns->OffMinX, columns->OffMaxX, t);
-    return x_offset;
+    return columns->Columns[column_index].OffsetX;
 }
 
 static float GetColumnWidthEx(ImGuiColumns* columns, int column_index, bool before_resize = false)
@@ -7968,7 +9595,7 @@ float ImGui::GetColumnWidth(int column_index)
 
     if (column_index < 0)
         column_index = columns->Current;
-    return GetColumnOffsetFromNorm(columns, columns->Columns[column_index + 1].OffsetNorm - columns->Columns[column_index].OffsetNorm);
+    return columns->Columns[column_index + 1].OffsetX - columns->Columns[column_index].OffsetX;
 }
 
 void ImGui::SetColumnOffset(int column_index, float offset)
@@ -7988,6 +9615,7 @@ void ImGui::SetColumnOffset(int column_index, float offset)
     if (!(columns->Flags & ImGuiColumnsFlags_NoForceWithinWindow))
         offset = ImMin(offset, columns->OffMaxX - g.Style.ColumnsMinSpacing * (columns->Count - column_index));
     columns->Columns[column_index].OffsetNorm = GetColumnNormFromOffset(columns, offset - columns->OffMinX);
+    columns->Columns[column_index].OffsetX = ImLerp(columns->OffMinX, columns->OffMaxX, columns->Columns[column_index].OffsetNorm);
 
     if (preserve_width)
         SetColumnOffset(column_index + 1, offset + ImMax(g.Style.ColumnsMinSpacing, width));
@@ -8015,6 +9643,24 @@ void ImGui::PushColumnClipRect(int column_index)
     PushClipRect(column->ClipRect.Min, column->ClipRect.Max, false);
 }
 
+// Test the vertices added to the draw list since the channel of the current column was made current against the column clipping rectangle.
+// Every vertex is read once per frame, right after being written. Sides clipped by the host don't matter, see ColumnsMergeDrawChannels().
+static void ColumnsUpdateDrawOverflow(ImGuiWindow* window, ImGuiColumns* columns)
+{
+    ImGuiColumnData* column = &columns->Columns[columns->Current];
+    const ImVector<ImDrawVert>& vtx_buffer = window->DrawList->VtxBuffer;
+    if (!column->DrawOverflow)
+    {
+        const float min_x = (column->ClipRect.Min.x > columns->HostInitialClipRect.Min.x) ? column->ClipRect.Min.x : -FLT_MAX;
+        const float max_x = (column->ClipRect.Max.x < columns->HostInitialClipRect.Max.x) ? column->ClipRect.Max.x : FLT_MAX;
+        bool overflow = false;
+        for (const ImDrawVert* vtx = vtx_buffer.Data + columns->DrawVtxStart, *vtx_end = vtx_buffer.Data + vtx_buffer.Size; vtx < vtx_end; vtx++)
+            overflow |= (vtx->pos.x < min_x) | (vtx->pos.x > max_x);
+        column->DrawOverflow = overflow;
+    }
+    columns->DrawVtxStart = vtx_buffer.Size;
+}
+
 // Get into the columns background draw command (which is generally the same draw command as before we called BeginColumns)
 void ImGui::PushColumnsBackground()
 {
@@ -8024,6 +9670,7 @@ void ImGui::PushColumnsBackground()
         return;
 
     // Optimization: avoid SetCurrentChannel() + PushClipRect()
+    ColumnsUpdateDrawOverflow(window, columns);
     columns->HostBackupClipRect = window->ClipRect;
     SetWindowClipRectBeforeSetChannel(window, columns->HostInitialClipRect);
     columns->Splitter.SetCurrentChannel(window->DrawList, 0);
@@ -8039,6 +9686,7 @@ void ImGui::PopColumnsBackground()
     // Optimization: avoid PopClipRect() + SetCurrentChannel()
     SetWindowClipRectBeforeSetChannel(window, columns->HostBackupClipRect);
     columns->Splitter.SetCurrentChannel(window->DrawList, columns->Current + 1);
+    columns->DrawVtxStart = window->DrawList->VtxBuffer.Size;
 }
 
 ImGuiColumns* ImGui::FindOrCreateColumns(ImGuiWindow* window, ImGuiID id)
@@ -8067,6 +9715,44 @@ ImGuiID ImGui::GetColumnsID(const char* str_id, int columns_count)
     return id;
 }
 
+// Each column is drawn in its own draw channel with its own clipping rectangle, which yields at least one draw command per column.
+// Contents which don't exceed their column (the common case) can use the host clipping rectangle instead, with the same result:
+// move their channels right after the background channel and switch their commands to the host clipping rectangle, so that
+// ImDrawListSplitter::Merge() merges them with the background into a single draw command. Only overflowing columns keep their own.
+// (The channels order doesn't matter otherwise, as the contents of the columns don't overlap)
+// Whether a column fits is decided from the vertices it actually drew (see ColumnsUpdateDrawOverflow()), not from its layout: custom
+// ImDrawList primitives may extend past the items size.
+static void ColumnsMergeDrawChannels(ImGuiWindow* window, ImGuiColumns* columns)
+{
+    ImDrawListSplitter* splitter = &columns->Splitter;
+    splitter->SetCurrentChannel(window->DrawList, 0);
+
+    const ImVec4 host_clip_rect = columns->HostInitialClipRect.ToVec4();
+    int merge_channel_idx = 1;
+    for (int n = 0; n < columns->Count; n++)
+    {
+        ImGuiColumnData* column = &columns->Columns[n];
+        if (column->DrawOverflow)
+            continue;
+
+        ImDrawChannel* channel = &splitter->_Channels[n + 1];
+        const ImVec4 column_clip_rect = column->ClipRect.ToVec4();
+        for (int cmd_n = 0; cmd_n < channel->_CmdBuffer.Size; cmd_n++)
+        {
+            ImVec4& cmd_clip_rect = channel->_CmdBuffer.Data[cmd_n].ClipRect;
+            if (cmd_clip_rect.x == column_clip_rect.x && cmd_clip_rect.y == column_clip_rect.y && cmd_clip_rect.z == column_clip_rect.z && cmd_clip_rect.w == column_clip_rect.w)
+                cmd_clip_rect = host_clip_rect;
+        }
+        if (merge_channel_idx != n + 1)
+        {
+            ImDrawChannel* dst_channel = &splitter->_Channels[merge_channel_idx];
+            dst_channel->_CmdBuffer.swap(channel->_CmdBuffer);
+            dst_channel->_IdxBuffer.swap(channel->_IdxBuffer);
+        }
+        merge_channel_idx++;
+    }
+}
+
 void ImGui::BeginColumns(const char* str_id, int columns_count, ImGuiColumnsFlags flags)
 {
     ImGuiContext& g = *GImGui;
@@ -8117,12 +9803,21 @@ void ImGui::BeginColumns(const char* str_id, int columns_count, ImGuiColumnsFlag
         }
     }
 
+    // Resolve offsets once, they are used by every NextColumn() call
+    for (int n = 0; n < columns_count + 1; n++)
+    {
+        ImGuiColumnData* column = &columns->Columns[n];
+        column->OffsetX = ImLerp(columns->OffMinX, columns->OffMaxX, column->OffsetNorm);
+        column->ContentMaxX = -FLT_MAX;
+        column->DrawOverflow = false;
+    }
+
     for (int n = 0; n < columns_count; n++)
     {
         // Compute clipping rectangle
         ImGuiColumnData* column = &columns->Columns[n];
-        float clip_x1 = IM_ROUND(window->Pos.x + GetColumnOffset(n));
-        float clip_x2 = IM_ROUND(window->Pos.x + GetColumnOffset(n + 1) - 1.0f);
+        float clip_x1 = IM_ROUND(window->Pos.x + column->OffsetX);
+        float clip_x2 = IM_ROUND(window->Pos.x + columns->Columns[n + 1].OffsetX - 1.0f);
         column->ClipRect = ImRect(clip_x1, -FLT_MAX, clip_x2, +FLT_MAX);
         column->ClipRect.ClipWithFull(window->ClipRect);
     }
@@ -8132,15 +9827,17 @@ void ImGui::BeginColumns(const char* str_id, int columns_count, ImGuiColumnsFlag
         columns->Splitter.Split(window->DrawList, 1 + columns->Count);
         columns->Splitter.SetCurrentChannel(window->DrawList, 1);
         PushColumnClipRect(0);
+        columns->DrawVtxStart = window->DrawList->VtxBuffer.Size;
     }
 
     // We don't generally store Indent.x inside ColumnsOffset because it may be manipulated by the user.
-    float offset_0 = GetColumnOffset(columns->Current);
-    float offset_1 = GetColumnOffset(columns->Current + 1);
+    float offset_0 = columns->Columns[columns->Current].OffsetX;
+    float offset_1 = columns->Columns[columns->Current + 1].OffsetX;
     float width = offset_1 - offset_0;
     PushItemWidth(width * 0.65f);
     window->DC.ColumnsOffset.x = ImMax(column_padding - window->WindowPadding.x, 0.0f);
     window->DC.CursorPos.x = IM_FLOOR(window->Pos.x + window->DC.Indent.x + window->DC.ColumnsOffset.x);
+    window->DC.CursorMaxPos.x = window->DC.CursorPos.x; // Measure the contents of each column separately, see ColumnsMergeDrawChannels()
     window->WorkRect.Max.x = window->Pos.x + offset_1 - column_padding;
 }
 
@@ -8161,6 +9858,9 @@ void ImGui::NextColumn()
     }
 
     // Next column
+    ImGuiColumnData* prev_column = &columns->Columns[columns->Current];
+    prev_column->ContentMaxX = ImMax(prev_column->ContentMaxX, window->DC.CursorMaxPos.x);
+    ColumnsUpdateDrawOverflow(window, columns);
     if (++columns->Current == columns->Count)
         columns->Current = 0;
 
@@ -8178,7 +9878,7 @@ void ImGui::NextColumn()
     {
         // Columns 1+ ignore IndentX (by canceling it out)
         // FIXME-COLUMNS: Unnecessary, could be locked?
-        window->DC.ColumnsOffset.x = GetColumnOffset(columns->Current) - window->DC.Indent.x + column_padding;
+        window->DC.ColumnsOffset.x = column->OffsetX - window->DC.Indent.x + column_padding;
     }
     else
     {
@@ -8188,12 +9888,13 @@ void ImGui::NextColumn()
     }
     window->DC.CursorPos.x = IM_FLOOR(window->Pos.x + window->DC.Indent.x + window->DC.ColumnsOffset.x);
     window->DC.CursorPos.y = columns->LineMinY;
+    window->DC.CursorMaxPos.x = window->DC.CursorPos.x;
     window->DC.CurrLineSize = ImVec2(0.0f, 0.0f);
     window->DC.CurrLineTextBaseOffset = 0.0f;
 
     // FIXME-COLUMNS: Share code with BeginColumns() - move code on columns setup.
-    float offset_0 = GetColumnOffset(columns->Current);
-    float offset_1 = GetColumnOffset(columns->Current + 1);
+    float offset_0 = column->OffsetX;
+    float offset_1 = columns->Columns[columns->Current + 1].OffsetX;
     float width = offset_1 - offset_0;
     PushItemWidth(width * 0.65f);
     window->WorkRect.Max.x = window->Pos.x + offset_1 - column_padding;
@@ -8207,17 +9908,23 @@ void ImGui::EndColumns()
     IM_ASSERT(columns != NULL);
 
     PopItemWidth();
+    ImGuiColumnData* last_column = &columns->Columns[columns->Current];
+    last_column->ContentMaxX = ImMax(last_column->ContentMaxX, window->DC.CursorMaxPos.x);
     if (columns->Count > 1)
     {
+        ColumnsUpdateDrawOverflow(window, columns);
         PopClipRect();
+        ColumnsMergeDrawChannels(window, columns);
         columns->Splitter.Merge(window->DrawList);
     }
 
     const ImGuiColumnsFlags flags = columns->Flags;
     columns->LineMaxY = ImMax(columns->LineMaxY, window->DC.CursorPos.y);
     window->DC.CursorPos.y = columns->LineMaxY;
-    if (!(flags & ImGuiColumnsFlags_GrowParentContentsSize))
-        window->DC.CursorMaxPos.x = columns->HostCursorMaxPosX;  // Restore cursor max pos, as columns don't grow parent
+    window->DC.CursorMaxPos.x = columns->HostCursorMaxPosX;  // Restore cursor max pos, as columns don't grow parent
+    if (flags & ImGuiColumnsFlags_GrowParentContentsSize)
+        for (int n = 0; n < columns->Count; n++)
+            window->DC.CursorMaxPos.x = ImMax(window->DC.CursorMaxPos.x, columns->Columns[n].ContentMaxX);
 
     // Draw columns borders and handle resize
     // The IsBeingResized flag ensure we preserve pre-resize columns width so back-and-forth are not lossy
@@ -2,6 +2,8 @@
 // This is a slightly modified version of stb_textedit.h 1.13. 
 // Those changes would need to be pushed into nothings/stb:
 // - Fix in stb_textedit_discard_redo (see https://github.com/nothings/stb/issues/321)
+// - Support for variable-length encodings (UTF-8): STB_TEXTEDIT_GETNEXTCHARINDEX, STB_TEXTEDIT_GETPREVCHARINDEX, stb_textedit_text()
+// - Optional row seeking hooks for long texts: STB_TEXTEDIT_SEEKROW_BY_Y, STB_TEXTEDIT_SEEKROW_BY_CHAR
 // Grep for [DEAR IMGUI] to find the changes.
 
 // stb_textedit.h - v1.13  - public domain - Sean Barrett
@@ -205,6 +207,7 @@
 //    int  stb_textedit_cut(STB_TEXTEDIT_STRING *str, STB_TexteditState *state)
 //    int  stb_textedit_paste(STB_TEXTEDIT_STRING *str, STB_TexteditState *state, STB_TEXTEDIT_CHARTYPE *text, int len)
 //    void stb_textedit_key(STB_TEXTEDIT_STRING *str, STB_TexteditState *state, STB_TEXEDIT_KEYTYPE key)
+//    void stb_textedit_text(STB_TEXTEDIT_STRING *str, STB_TexteditState *state, const STB_TEXTEDIT_CHARTYPE *text, int text_len)   [DEAR IMGUI]
 //
 //    Each of these functions potentially updates the string and updates the
 //    state.
@@ -388,6 +391,24 @@ typedef struct
 #define STB_TEXTEDIT_memmove memmove
 #endif
 
+// [DEAR IMGUI]
+// Variable-length encodings: an index is a position in STB_TEXTEDIT_CHARTYPE units (e.g. bytes for UTF-8),
+// cursor movements and single character deletions step over a whole encoded character using those.
+// STB_TEXTEDIT_GETWIDTH() is expected to return 0.0f for indices which are not the first unit of a character.
+#ifndef STB_TEXTEDIT_GETNEXTCHARINDEX
+#define STB_TEXTEDIT_GETNEXTCHARINDEX(obj, idx)   ((idx) + 1)
+#endif
+#ifndef STB_TEXTEDIT_GETPREVCHARINDEX
+#define STB_TEXTEDIT_GETPREVCHARINDEX(obj, idx)   ((idx) - 1)
+#endif
+
+// [DEAR IMGUI]
+// Optional: when the client keeps a line index, those let us skip directly to the interesting row instead of
+// calling STB_TEXTEDIT_LAYOUTROW() on every row from the start of the text.
+//    STB_TEXTEDIT_SEEKROW_BY_Y(obj,y,&i,&base_y)                  set i/base_y to the start/top of a row at or before the one straddling y
+//    STB_TEXTEDIT_SEEKROW_BY_CHAR(obj,n,&i,&prev_first,&row_y)    set i/row_y to the start/top of the row containing character n (last row if n==len),
+//                                                                 prev_first to the start of the row before it (0 for the first row)
+
 
 /////////////////////////////////////////////////////////////////////////////
 //
@@ -407,6 +428,10 @@ static int stb_text_locate_coord(STB_TEXTEDIT_STRING *str, float x, float y)
    r.num_chars = 0;
 
    // search rows to find one that straddles 'y'
+#ifdef STB_TEXTEDIT_SEEKROW_BY_Y
+   if (y >= 0)
+      STB_TEXTEDIT_SEEKROW_BY_Y(str, y, &i, &base_y);
+#endif
    while (i < n) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
       if (r.num_chars <= 0)
@@ -434,13 +459,13 @@ static int stb_text_locate_coord(STB_TEXTEDIT_STRING *str, float x, float y)
    if (x < r.x1) {
       // search characters in row for one that straddles 'x'
       prev_x = r.x0;
-      for (k=0; k < r.num_chars; ++k) {
+      for (k=0; k < r.num_chars; k = STB_TEXTEDIT_GETNEXTCHARINDEX(str, i+k) - i) {
          float w = STB_TEXTEDIT_GETWIDTH(str, i, k);
          if (x < prev_x+w) {
             if (x < prev_x+w/2)
                return k+i;
             else
-               return k+i+1;
+               return STB_TEXTEDIT_GETNEXTCHARINDEX(str, i+k);
          }
          prev_x += w;
       }
@@ -536,6 +561,9 @@ static void stb_textedit_find_charpos(StbFindState *find, STB_TEXTEDIT_STRING *s
          find->y = 0;
          find->x = 0;
          find->height = 1;
+#ifdef STB_TEXTEDIT_SEEKROW_BY_CHAR
+         STB_TEXTEDIT_SEEKROW_BY_CHAR(str, n, &i, &prev_start, &find->y);
+#endif
          while (i < z) {
             STB_TEXTEDIT_LAYOUTROW(&r, str, i);
             prev_start = i;
@@ -550,6 +578,9 @@ static void stb_textedit_find_charpos(StbFindState *find, STB_TEXTEDIT_STRING *s
 
    // search rows to find the one that straddles character n
    find->y = 0;
+#ifdef STB_TEXTEDIT_SEEKROW_BY_CHAR
+   STB_TEXTEDIT_SEEKROW_BY_CHAR(str, n, &i, &prev_start, &find->y);
+#endif
 
    for(;;) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
@@ -722,6 +753,33 @@ static int stb_textedit_paste_internal(STB_TEXTEDIT_STRING *str, STB_TexteditSta
    return 0;
 }
 
+// [DEAR IMGUI]
+// API text: insert text at the cursor (replacing the selection), as a single undo record.
+// Extracted from stb_textedit_key() so a character spanning multiple STB_TEXTEDIT_CHARTYPE can be inserted at once.
+static void stb_textedit_text(STB_TEXTEDIT_STRING *str, STB_TexteditState *state, const STB_TEXTEDIT_CHARTYPE *text, int text_len)
+{
+   // can't add newline in single-line mode
+   if (text[0] == '\n' && state->single_line)
+      return;
+
+   if (state->insert_mode && !STB_TEXT_HAS_SELECTION(state) && state->cursor < STB_TEXTEDIT_STRINGLEN(str)) {
+      int del_len = STB_TEXTEDIT_GETNEXTCHARINDEX(str, state->cursor) - state->cursor;
+      stb_text_makeundo_replace(str, state, state->cursor, del_len, text_len);
+      STB_TEXTEDIT_DELETECHARS(str, state->cursor, del_len);
+      if (STB_TEXTEDIT_INSERTCHARS(str, state->cursor, text, text_len)) {
+         state->cursor += text_len;
+         state->has_preferred_x = 0;
+      }
+   } else {
+      stb_textedit_delete_selection(str,state); // implicitly clamps
+      if (STB_TEXTEDIT_INSERTCHARS(str, state->cursor, text, text_len)) {
+         stb_text_makeundo_insert(state, state->cursor, text_len);
+         state->cursor += text_len;
+         state->has_preferred_x = 0;
+      }
+   }
+}
+
 #ifndef STB_TEXTEDIT_KEYTYPE
 #define STB_TEXTEDIT_KEYTYPE int
 #endif
@@ -735,26 +793,7 @@ retry:
          int c = STB_TEXTEDIT_KEYTOTEXT(key);
          if (c > 0) {
             STB_TEXTEDIT_CHARTYPE ch = (STB_TEXTEDIT_CHARTYPE) c;
-
-            // can't add newline in single-line mode
-            if (c == '\n' && state->single_line)
-               break;
-
-            if (state->insert_mode && !STB_TEXT_HAS_SELECTION(state) && state->cursor < STB_TEXTEDIT_STRINGLEN(str)) {
-               stb_text_makeundo_replace(str, state, state->cursor, 1, 1);
-               STB_TEXTEDIT_DELETECHARS(str, state->cursor, 1);
-               if (STB_TEXTEDIT_INSERTCHARS(str, state->cursor, &ch, 1)) {
-                  ++state->cursor;
-                  state->has_preferred_x = 0;
-               }
-            } else {
-               stb_textedit_delete_selection(str,state); // implicitly clamps
-               if (STB_TEXTEDIT_INSERTCHARS(str, state->cursor, &ch, 1)) {
-                  stb_text_makeundo_insert(state, state->cursor, 1);
-                  ++state->cursor;
-                  state->has_preferred_x = 0;
-               }
-            }
+            stb_textedit_text(str, state, &ch, 1);
          }
          break;
       }
@@ -781,7 +820,7 @@ retry:
             stb_textedit_move_to_first(state);
          else 
             if (state->cursor > 0)
-               --state->cursor;
+               state->cursor = STB_TEXTEDIT_GETPREVCHARINDEX(str, state->cursor);
          state->has_preferred_x = 0;
          break;
 
@@ -790,7 +829,7 @@ retry:
          if (STB_TEXT_HAS_SELECTION(state))
             stb_textedit_move_to_last(str, state);
          else
-            ++state->cursor;
+            state->cursor = STB_TEXTEDIT_GETNEXTCHARINDEX(str, state->cursor);
          stb_textedit_clamp(str, state);
          state->has_preferred_x = 0;
          break;
@@ -800,7 +839,7 @@ retry:
          stb_textedit_prep_selection_at_cursor(state);
          // move selection left
          if (state->select_end > 0)
-            --state->select_end;
+            state->select_end = STB_TEXTEDIT_GETPREVCHARINDEX(str, state->select_end);
          state->cursor = state->select_end;
          state->has_preferred_x = 0;
          break;
@@ -850,7 +889,7 @@ retry:
       case STB_TEXTEDIT_K_RIGHT | STB_TEXTEDIT_K_SHIFT:
          stb_textedit_prep_selection_at_cursor(state);
          // move selection right
-         ++state->select_end;
+         state->select_end = STB_TEXTEDIT_GETNEXTCHARINDEX(str, state->select_end);
          stb_textedit_clamp(str, state);
          state->cursor = state->select_end;
          state->has_preferred_x = 0;
@@ -996,7 +1035,7 @@ retry:
          else {
             int n = STB_TEXTEDIT_STRINGLEN(str);
             if (state->cursor < n)
-               stb_textedit_delete(str, state, state->cursor, 1);
+               stb_textedit_delete(str, state, state->cursor, STB_TEXTEDIT_GETNEXTCHARINDEX(str, state->cursor) - state->cursor);
          }
          state->has_preferred_x = 0;
          break;
@@ -1008,8 +1047,9 @@ retry:
          else {
             stb_textedit_clamp(str, state);
             if (state->cursor > 0) {
-               stb_textedit_delete(str, state, state->cursor-1, 1);
-               --state->cursor;
+               int prev = STB_TEXTEDIT_GETPREVCHARINDEX(str, state->cursor);
+               stb_textedit_delete(str, state, prev, state->cursor - prev);
+               state->cursor = prev;
             }
          }
          state->has_preferred_x = 0;
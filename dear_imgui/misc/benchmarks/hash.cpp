@@ -0,0 +1,289 @@
+// dear imgui: benchmark and tests for the hash function used for IDs (ImHashStr(), ImHashData())
+// - Speed: ImHashStr() on a set of generated labels shaped like typical ones, against a byte-per-byte CRC32 (what 1.79 and earlier used).
+// - Identity: with the CRC hashes, ImHashStr()/ImHashData() must give the same IDs as the byte-per-byte code, including the "###" handling.
+//   Tested on random strings rich in '#' with random seeds, in both the sized and zero-terminated forms.
+// - Collisions: number of identical IDs among (label x seed) pairs, vs the count expected from as many random 32-bit values.
+// - Labels: IM_LABEL() hashes (computed at compile-time when IMGUI_HAS_CONSTEXPR_HASH is defined) must give the same IDs as ImHashStr()
+//   under any seed, directly with ImHashLabel() and through GetID()/PushID() in a window.
+// Usage: hash [number of IDs for the collision test, default 10000000]
+// Build (from this folder), with the same IMGUI_USE_HASH_XXX define as your build, if any (see imconfig.h):
+//   c++ -O2 -I../.. hash.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp -o hash
+//   c++ -O2 -msse4.2 -DIMGUI_USE_HASH_CRC32C -I../.. hash.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp -o hash
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+struct HashTestResults
+{
+    int     LabelsCount;
+    float   LabelsAvgLen;
+    double  NsPerLabel;             // ImHashStr()
+    double  NsPerLabelReference;    // Byte-per-byte CRC32
+    int     IdentityTested;         // 0 when the hash has no byte-per-byte reference (IMGUI_USE_HASH_WYHASH)
+    int     IdentityMismatches;
+    int     CollisionsIdsCount;
+    int     Collisions;
+    double  CollisionsExpected;
+
+    HashTestResults()  { memset(this, 0, sizeof(*this)); }
+};
+
+static ImU32 HashTestRand(ImU32* state)
+{
+    // xorshift32: deterministic, so results are comparable between builds
+    ImU32 x = *state;
+    x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+    return *state = x;
+}
+
+// Byte-per-byte CRC as used up to 1.79 (with the polynomial of the selected CRC hash). 'str' = true applies the "###" operator (resets to seed) like ImHashStr().
+static ImU32 HashTestReference(const char* data_p, size_t data_size, ImU32 seed, bool str)
+{
+#ifdef IMGUI_USE_HASH_CRC32C
+    const ImU32 poly = 0x82F63B78u;
+#else
+    const ImU32 poly = 0xEDB88320u;
+#endif
+    static ImU32 crc32_lut[256] = { 0 };
+    if (crc32_lut[1] == 0)
+        for (ImU32 i = 0; i < 256; i++)
+        {
+            ImU32 crc = i;
+            for (int bit = 0; bit < 8; bit++)
+                crc = (crc >> 1) ^ (poly & (0u - (crc & 1)));
+            crc32_lut[i] = crc;
+        }
+
+    seed = ~seed;
+    ImU32 crc = seed;
+    const unsigned char* data = (const unsigned char*)data_p;
+    const unsigned char* data_end = data + (data_size != 0 ? data_size : strlen(data_p));
+    while (data < data_end)
+    {
+        unsigned char c = *data++;
+        if (str && c == '#' && data_end - data >= 2 && data[0] == '#' && data[1] == '#')
+            crc = seed;
+        crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
+    }
+    return ~crc;
+}
+
+// Time spent per label, in nanoseconds: best of a few runs, each of them repeating the whole set for at least ~20 ms of CPU time.
+static double HashTestTime(const ImVector<char>& labels_buf, const ImVector<int>& labels_offsets, bool reference, ImU32* sink)
+{
+    double best_ns = 0.0;
+    for (int run = 0; run < 5; run++)
+    {
+        int labels_hashed = 0;
+        clock_t t0 = clock(), t1 = t0;
+        while (t1 - t0 < CLOCKS_PER_SEC / 50)
+        {
+            for (int n = 0; n < labels_offsets.Size; n++)
+            {
+                const char* label = labels_buf.Data + labels_offsets[n];
+                *sink += reference ? HashTestReference(label, 0, 0, true) : ImHashStr(label, 0, 0);
+            }
+            labels_hashed += labels_offsets.Size;
+            t1 = clock();
+        }
+        double ns = (double)(t1 - t0) * 1e9 / CLOCKS_PER_SEC / labels_hashed;
+        if (run == 0 || ns < best_ns)
+            best_ns = ns;
+    }
+    return best_ns;
+}
+
+static int IMGUI_CDECL HashTestCompareIds(const void* lhs, const void* rhs)
+{
+    ImU32 a = *(const ImU32*)lhs, b = *(const ImU32*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+static void RunHashTest(HashTestResults* out, int collisions_ids_count)
+{
+    static const char* const words[] = { "Button", "Checkbox", "Color", "Delete", "Edit", "Enabled", "File", "Filter", "Float", "Help", "Input text", "Item", "Layout", "Menu", "Open", "Options", "Radio", "Save", "Scale", "Selected", "Settings", "Slider", "Style", "Table", "Text", "Tree node", "Value", "Widgets", "Window", "X" };
+    const int words_count = IM_ARRAYSIZE(words);
+    ImU32 rand_state = 0x12345678u;
+
+    // Generate distinct labels: "Word", "Word 12", "##word12", "Word##word", "Word###word12"
+    // Labels sharing the part hashed by ImHashStr() (from the last "###") are the same ID by design, so they are only added once.
+    ImVector<char> labels_buf;
+    ImVector<int> labels_offsets;
+    ImGuiStorage labels_hashed_parts;
+    int labels_len_total = 0;
+    for (int attempts = 0; labels_offsets.Size < 1000 && attempts < 100000; attempts++)
+    {
+        const char* w1 = words[HashTestRand(&rand_state) % words_count];
+        const char* w2 = words[HashTestRand(&rand_state) % words_count];
+        int num = (int)(HashTestRand(&rand_state) % 100);
+        char label[64];
+        int form = (int)(HashTestRand(&rand_state) % 20);
+        int len;
+        if (form < 8)       len = ImFormatString(label, IM_ARRAYSIZE(label), "%s", w1);
+        else if (form < 12) len = ImFormatString(label, IM_ARRAYSIZE(label), "%s %d", w1, num);
+        else if (form < 15) len = ImFormatString(label, IM_ARRAYSIZE(label), "##%s%d", w1, num);
+        else if (form < 18) len = ImFormatString(label, IM_ARRAYSIZE(label), "%s##%s", w1, w2);
+        else                len = ImFormatString(label, IM_ARRAYSIZE(label), "%s###%s%d", w1, w2, num);
+        const char* hashed_part = strstr(label, "###") ? strstr(label, "###") : label; // Our labels have at most one "###"
+        ImGuiID hashed_part_key = (ImGuiID)HashTestReference(hashed_part, 0, 0, false) | 1; // A clash here only drops a label
+        if (labels_hashed_parts.GetBool(hashed_part_key))
+            continue;
+        labels_hashed_parts.SetBool(hashed_part_key, true);
+        labels_offsets.push_back(labels_buf.Size);
+        labels_buf.resize(labels_buf.Size + len + 1);
+        memcpy(labels_buf.Data + labels_offsets.back(), label, (size_t)len + 1);
+        labels_len_total += len;
+    }
+    out->LabelsCount = labels_offsets.Size;
+    out->LabelsAvgLen = (float)labels_len_total / labels_offsets.Size;
+
+    // Speed
+    ImU32 sink = 0;
+    out->NsPerLabel = HashTestTime(labels_buf, labels_offsets, false, &sink);
+    out->NsPerLabelReference = HashTestTime(labels_buf, labels_offsets, true, &sink);
+    if (sink == 0x12345678u) // Use the result so the loops can't be optimized away
+        out->LabelsCount++;
+
+    // Identity with the byte-per-byte code
+    out->IdentityTested = out->IdentityMismatches = 0;
+#ifndef IMGUI_USE_HASH_WYHASH
+    for (int n = 0; n < 200000; n++)
+    {
+        char str[40];
+        int len = (int)(HashTestRand(&rand_state) % (IM_ARRAYSIZE(str) - 1));
+        for (int i = 0; i < len; i++)
+        {
+            ImU32 r = HashTestRand(&rand_state);
+            str[i] = (r & 1) ? '#' : (char)(1 + ((r >> 1) % 255));
+        }
+        str[len] = 0;
+        ImU32 seed = (n & 1) ? HashTestRand(&rand_state) : 0;
+        if (ImHashStr(str, 0, seed) != HashTestReference(str, 0, seed, true))
+            out->IdentityMismatches++;
+        if (len > 0 && ImHashStr(str, (size_t)len, seed) != HashTestReference(str, (size_t)len, seed, true))
+            out->IdentityMismatches++;
+        if (ImHashData(str, (size_t)len, seed) != HashTestReference(str, (size_t)len, seed, false))
+            out->IdentityMismatches++;
+        out->IdentityTested++;
+    }
+#endif
+
+    // Collisions among (label x seed), seeds being random like the IDs of parent windows/nodes are
+    ImVector<ImU32> ids;
+    ids.reserve(collisions_ids_count);
+    while (ids.Size < collisions_ids_count)
+    {
+        ImU32 seed = HashTestRand(&rand_state);
+        for (int n = 0; n < labels_offsets.Size && ids.Size < collisions_ids_count; n++)
+            ids.push_back(ImHashStr(labels_buf.Data + labels_offsets[n], 0, seed));
+    }
+    ImQsort(ids.Data, (size_t)ids.Size, sizeof(ImU32), HashTestCompareIds);
+    out->Collisions = 0;
+    for (int n = 1; n < ids.Size; n++)
+        if (ids[n] == ids[n - 1])
+            out->Collisions++;
+    out->CollisionsIdsCount = ids.Size;
+    out->CollisionsExpected = (double)ids.Size * (ids.Size - 1) / 2.0 / 4294967296.0;
+}
+
+// Literal labels, including the "##"/"###" cases and the empty label, for IM_LABEL()
+#define HASH_TEST_LABELS(X) \
+    X("") X("a") X("#") X("##") X("###") X("####") X("Label##id") X("##id") X("Hello###World") X("Other###World") \
+    X("a###b###c") X("Settings###settings") X("Delete") X("Button with a longer label, as used in some tools##button_with_a_longer_label")
+
+// Return the number of mismatches between IDs from IM_LABEL() and from the same label hashed at runtime
+static int RunLabelHashTest(int* out_tested)
+{
+#define HASH_TEST_LABEL_HASH(_LABEL)    IM_LABEL(_LABEL),
+#define HASH_TEST_LABEL_STR(_LABEL)     _LABEL,
+    const ImGuiLabelHash labels[] = { HASH_TEST_LABELS(HASH_TEST_LABEL_HASH) };
+    const char* labels_str[] = { HASH_TEST_LABELS(HASH_TEST_LABEL_STR) };
+#undef HASH_TEST_LABEL_HASH
+#undef HASH_TEST_LABEL_STR
+    IM_STATIC_ASSERT(IM_ARRAYSIZE(labels) == IM_ARRAYSIZE(labels_str));
+
+    int mismatches = 0, tested = 0;
+    ImU32 rand_state = 0x9E3779B9u;
+    for (int seed_n = 0; seed_n < 1000; seed_n++)
+    {
+        const ImU32 seed = (seed_n == 0) ? 0 : (seed_n == 1) ? 0xFFFFFFFFu : HashTestRand(&rand_state);
+        for (int n = 0; n < IM_ARRAYSIZE(labels); n++)
+        {
+            const ImU32 expected = ImHashStr(labels_str[n], 0, seed);
+            if (ImHashLabel(labels[n], seed) != expected)
+                mismatches++;
+#ifndef IMGUI_USE_HASH_WYHASH
+            if (expected != HashTestReference(labels_str[n], 0, seed, true))
+                mismatches++;
+#endif
+            tested++;
+        }
+    }
+
+    // Through the ID stack of a window, the seed being the ID pushed by PushID(IM_LABEL()) or PushID(const char*)
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(800, 600);
+    io.DeltaTime = 1.0f / 60.0f;
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    ImGui::NewFrame();
+    ImGui::Begin("Hash test");
+    for (int push_n = 0; push_n < IM_ARRAYSIZE(labels); push_n++)
+    {
+        ImGui::PushID(labels[push_n]);
+        const ImGuiID seed_from_label = ImGui::GetID("");
+        ImGui::PopID();
+        ImGui::PushID(labels_str[push_n]);
+        const ImGuiID seed_from_str = ImGui::GetID("");
+        for (int n = 0; n < IM_ARRAYSIZE(labels); n++)
+        {
+            if (ImGui::GetID(labels[n]) != ImGui::GetID(labels_str[n]))
+                mismatches++;
+            tested++;
+        }
+        ImGui::PopID();
+        if (seed_from_label != seed_from_str)
+            mismatches++;
+    }
+    ImGui::End();
+    ImGui::EndFrame();
+
+    *out_tested = tested;
+    return mismatches;
+}
+
+int main(int argc, char** argv)
+{
+    const int collisions_ids_count = (argc > 1) ? atoi(argv[1]) : 10000000;
+    ImGui::CreateContext();
+#if defined(IMGUI_USE_HASH_CRC32C)
+    printf("Hash: CRC32C (IMGUI_USE_HASH_CRC32C)\n");
+#elif defined(IMGUI_USE_HASH_WYHASH)
+    printf("Hash: wyhash (IMGUI_USE_HASH_WYHASH)\n");
+#else
+    printf("Hash: CRC32\n");
+#endif
+    HashTestResults results;
+    RunHashTest(&results, collisions_ids_count);
+    printf("Speed on %d labels (avg length %.1f): %.1f ns/label, byte-per-byte CRC: %.1f ns/label\n", results.LabelsCount, results.LabelsAvgLen, results.NsPerLabel, results.NsPerLabelReference);
+    if (results.IdentityTested > 0)
+        printf("Identity with byte-per-byte code: %d mismatches on %d strings\n", results.IdentityMismatches, results.IdentityTested);
+    else
+        printf("Identity with byte-per-byte code: n/a\n");
+    printf("Collisions: %d among %d IDs, %.0f expected from random values\n", results.Collisions, results.CollisionsIdsCount, results.CollisionsExpected);
+    int label_tested = 0;
+    const int label_mismatches = RunLabelHashTest(&label_tested);
+#ifdef IMGUI_HAS_CONSTEXPR_HASH
+    printf("IM_LABEL() hashed at compile-time: %d mismatches on %d labels and seeds\n", label_mismatches, label_tested);
+#else
+    printf("IM_LABEL() hashed at runtime (no IMGUI_HAS_CONSTEXPR_HASH): %d mismatches on %d labels and seeds\n", label_mismatches, label_tested);
+#endif
+    ImGui::DestroyContext();
+    return (results.IdentityMismatches == 0 && label_mismatches == 0) ? 0 : 1;
+}
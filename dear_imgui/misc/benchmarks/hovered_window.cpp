@@ -0,0 +1,163 @@
+// dear imgui: benchmark and stress test for hovered window detection (FindHoveredWindow() and its g.WindowsHitGrid)
+// - Stress test: many windows with children, some with ImGuiWindowFlags_NoMouseInputs, some with a hit-test hole, windows moved,
+//   focused and not submitted at random, display size and style.TouchExtraPadding changed along the way. Every frame, the hovered
+//   window found by NewFrame() is compared with a linear walk over all windows (what 1.79 and earlier did).
+// - Timing: NewFrame() with the mouse over an empty area then over random positions, and the linear walk for the same positions.
+// Usage: hovered_window [number of windows, default 1000] [number of frames of the stress test, default 2000]
+// Build (from this folder): c++ -O2 -I../.. hovered_window.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp -o hovered_window
+
+#define IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static int              BenchWindowsCount = 1000;
+static unsigned int     BenchRandState = 1;
+
+static int BenchRand(int range)
+{
+    BenchRandState = BenchRandState * 1664525u + 1013904223u;
+    return (int)((BenchRandState >> 8) % (unsigned int)range);
+}
+
+// Linear walk over all windows, front to back, as in 1.79 and earlier. Call before NewFrame(), which clears window->Active.
+// Ignores g.MovingWindow, which the benchmark doesn't use.
+static void FindHoveredWindowReference(ImGuiWindow** out_hovered_window, ImGuiWindow** out_hovered_window_under_moving_window)
+{
+    ImGuiContext& g = *GImGui;
+    const float resize_from_edges_half_thickness = 4.0f; // WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS in imgui.cpp
+    ImVec2 padding_regular = g.Style.TouchExtraPadding;
+    ImVec2 padding_for_resize_from_edges = g.IO.ConfigWindowsResizeFromEdges ? ImMax(g.Style.TouchExtraPadding, ImVec2(resize_from_edges_half_thickness, resize_from_edges_half_thickness)) : padding_regular;
+    ImGuiWindow* hovered_window = NULL;
+    for (int i = g.Windows.Size - 1; i >= 0 && hovered_window == NULL; i--)
+    {
+        ImGuiWindow* window = g.Windows[i];
+        if (!window->Active || window->Hidden)
+            continue;
+        if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
+            continue;
+        ImRect bb(window->OuterRectClipped);
+        if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_AlwaysAutoResize))
+            bb.Expand(padding_regular);
+        else
+            bb.Expand(padding_for_resize_from_edges);
+        if (!bb.Contains(g.IO.MousePos))
+            continue;
+        if (window->HitTestHoleSize.x != 0)
+        {
+            ImVec2 hole_pos(window->Pos.x + (float)window->HitTestHoleOffset.x, window->Pos.y + (float)window->HitTestHoleOffset.y);
+            ImVec2 hole_size((float)window->HitTestHoleSize.x, (float)window->HitTestHoleSize.y);
+            if (ImRect(hole_pos, hole_pos + hole_size).Contains(g.IO.MousePos))
+                continue;
+        }
+        hovered_window = window;
+    }
+    *out_hovered_window = hovered_window;
+    *out_hovered_window_under_moving_window = hovered_window;
+}
+
+// Windows stay in the left part of the display, leaving an empty area on the right for the timing.
+// 'stress' moves, focuses and skips windows at random. Returns the time spent in NewFrame().
+static clock_t BenchFrame(bool stress)
+{
+    clock_t t0 = clock();
+    ImGui::NewFrame();
+    clock_t new_frame_time = clock() - t0;
+    const ImVec2 area(ImGui::GetIO().DisplaySize.x * 0.75f, ImGui::GetIO().DisplaySize.y);
+    for (int n = 0; n < BenchWindowsCount; n++)
+    {
+        if (stress && BenchRand(50) == 0)
+            continue;
+        char name[32];
+        ImFormatString(name, IM_ARRAYSIZE(name), "Window %d", n);
+        ImGuiWindowFlags flags = ImGuiWindowFlags_NoSavedSettings | ((n % 7) == 3 ? ImGuiWindowFlags_NoMouseInputs : 0);
+        ImGuiCond cond = (stress && BenchRand(20) == 0) ? ImGuiCond_Always : ImGuiCond_Once;
+        ImGui::SetNextWindowPos(ImVec2((float)BenchRand((int)area.x - 100), (float)BenchRand((int)area.y - 50)), cond);
+        ImGui::SetNextWindowSize(ImVec2((float)(60 + (n * 37) % 200), (float)(40 + (n * 53) % 150)), ImGuiCond_Once);
+        if (stress && BenchRand(30) == 0)
+            ImGui::SetNextWindowFocus();
+        ImGui::Begin(name, NULL, flags);
+        if ((n % 11) == 5)
+            ImGui::SetWindowHitTestHole(ImGui::GetCurrentWindow(), ImGui::GetWindowPos() + ImVec2(10, 10), ImVec2(30, 20));
+        if ((n % 5) == 2)
+        {
+            ImGui::BeginChild("child", ImVec2(40, 25), true);
+            ImGui::EndChild();
+        }
+        ImGui::End();
+    }
+    ImGui::Render();
+    return new_frame_time;
+}
+
+int main(int argc, char** argv)
+{
+    int stress_frames = 2000;
+    if (argc > 1)
+        BenchWindowsCount = atoi(argv[1]);
+    if (argc > 2)
+        stress_frames = atoi(argv[2]);
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    ImGuiContext& g = *GImGui;
+
+    // Stress test
+    int mismatches = 0, hovered_frames = 0;
+    for (int frame = 0; frame < stress_frames; frame++)
+    {
+        if (frame % 500 == 250)
+            io.DisplaySize = (io.DisplaySize.x == 1920) ? ImVec2(1280, 720) : ImVec2(1920, 1080);
+        if (frame % 300 == 150)
+            ImGui::GetStyle().TouchExtraPadding = (ImGui::GetStyle().TouchExtraPadding.x == 0.0f) ? ImVec2(6.0f, 3.0f) : ImVec2(0.0f, 0.0f);
+        io.MousePos = ImVec2((float)BenchRand((int)io.DisplaySize.x + 40) - 20.0f, (float)BenchRand((int)io.DisplaySize.y + 40) - 20.0f);
+        ImGuiWindow* expected_window;
+        ImGuiWindow* expected_window_under_moving_window;
+        FindHoveredWindowReference(&expected_window, &expected_window_under_moving_window);
+        BenchFrame(frame > 0);
+        if (g.HoveredWindow != expected_window || g.HoveredWindowUnderMovingWindow != expected_window_under_moving_window)
+        {
+            if (mismatches++ < 10)
+                printf("Frame %d: mouse (%.0f,%.0f) hovered '%s' expected '%s'\n", frame, io.MousePos.x, io.MousePos.y, g.HoveredWindow ? g.HoveredWindow->Name : "NULL", expected_window ? expected_window->Name : "NULL");
+        }
+        if (expected_window)
+            hovered_frames++;
+    }
+    printf("Stress test: %d windows (%d in g.Windows), %d frames, %d with a hovered window, %d mismatches\n", BenchWindowsCount, g.Windows.Size, stress_frames, hovered_frames, mismatches);
+
+    // Timing, without moving windows
+    io.DisplaySize = ImVec2(1920, 1080);
+    ImGui::GetStyle().TouchExtraPadding = ImVec2(0.0f, 0.0f);
+    const int timing_frames = 500;
+    for (int empty_area = 1; empty_area >= 0; empty_area--)
+    {
+        clock_t new_frame_time = 0, reference_time = 0;
+        for (int frame = 0; frame < timing_frames; frame++)
+        {
+            io.MousePos = empty_area ? ImVec2(1900.0f, 500.0f) : ImVec2((float)BenchRand(1440), (float)BenchRand(1080));
+            ImGuiWindow* expected_window;
+            ImGuiWindow* expected_window_under_moving_window;
+            clock_t t0 = clock();
+            for (int repeat = 0; repeat < 10; repeat++)
+                FindHoveredWindowReference(&expected_window, &expected_window_under_moving_window);
+            reference_time += clock() - t0;
+
+            new_frame_time += BenchFrame(false);
+            if (g.HoveredWindow != expected_window)
+                mismatches++;
+        }
+        printf("Mouse over %s: NewFrame() %.1f us, linear walk alone %.2f us\n", empty_area ? "an empty area" : "random positions",
+            (double)new_frame_time * 1e6 / CLOCKS_PER_SEC / timing_frames, (double)reference_time * 1e6 / CLOCKS_PER_SEC / (timing_frames * 10));
+    }
+
+    ImGui::DestroyContext();
+    return mismatches > 0 ? 1 : 0;
+}
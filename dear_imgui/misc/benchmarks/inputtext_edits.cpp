@@ -0,0 +1,102 @@
+// dear imgui: benchmark for InputTextMultiline() editing large buffers
+// Types characters, new lines and backspaces at random positions of a large text, one edit per frame, and reports the time per frame.
+// Each edit is followed by a frame without input, timed separately (e.g. what ImGuiInputTextFlags_CallbackAlways costs while idle).
+// Usage: inputtext_edits [size in MB, default 10] [--local] [--callback] [--incremental]
+//   --local        edit around the middle of the text instead of anywhere
+//   --callback     use ImGuiInputTextFlags_CallbackAlways with a callback which doesn't touch the text
+//   --incremental  use ImGuiInputTextFlags_IncrementalCopyBack
+// Build (from this folder): c++ -O2 -I../.. inputtext_edits.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp -o inputtext_edits
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static char*                BenchBuf = NULL;
+static size_t               BenchBufSize = 0;
+static ImGuiInputTextFlags  BenchFlags = 0;
+
+static int BenchCallback(ImGuiInputTextCallbackData* data)
+{
+    return data->CursorPos < 0; // Reads the cursor, like most ImGuiInputTextFlags_CallbackAlways callbacks
+}
+
+static void BenchFrame(const char* chars, int key)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    for (int k = 0; k < 8; k++)
+        io.KeysDown[k] = (k == key);
+    if (chars)
+        io.AddInputCharactersUTF8(chars);
+    ImGui::NewFrame();
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(800, 600));
+    ImGui::Begin("Benchmark");
+    if (key == -2)
+        ImGui::SetKeyboardFocusHere();
+    ImGui::InputTextMultiline("##text", BenchBuf, BenchBufSize, ImVec2(780, 560), BenchFlags, (BenchFlags & ImGuiInputTextFlags_CallbackAlways) ? BenchCallback : NULL);
+    ImGui::End();
+    ImGui::Render();
+}
+
+int main(int argc, char** argv)
+{
+    int size_mb = 10;
+    bool local = false;
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--local") == 0)            local = true;
+        else if (strcmp(argv[n], "--callback") == 0)    BenchFlags |= ImGuiInputTextFlags_CallbackAlways;
+        else if (strcmp(argv[n], "--incremental") == 0) BenchFlags |= ImGuiInputTextFlags_IncrementalCopyBack;
+        else                                            size_mb = atoi(argv[n]);
+    }
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(800, 600);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.KeyMap[ImGuiKey_Backspace] = 1;
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+    // Lines of 64 characters
+    const size_t text_len = (size_t)size_mb << 20;
+    BenchBufSize = text_len + (1 << 16);
+    BenchBuf = (char*)malloc(BenchBufSize);
+    for (size_t i = 0; i < text_len; i++)
+        BenchBuf[i] = (i % 64 == 63) ? '\n' : (char)('a' + i % 26);
+    BenchBuf[text_len] = 0;
+    BenchFrame(NULL, -2);
+    BenchFrame(NULL, -1);
+    BenchFrame(NULL, -1);
+
+    ImGuiInputTextState& state = GImGui->InputTextState;
+    unsigned int rng = 1;
+    const int edits_count = 200;
+    clock_t total_edit = 0, total_idle = 0;
+    for (int n = 0; n < edits_count; n++)
+    {
+        rng = rng * 1103515245u + 12345u;
+        const int pos = local ? (int)(text_len / 2) + (int)((rng >> 4) % 256u) : 1 + (int)((rng >> 4) % (unsigned int)(text_len - 2));
+        state.Stb.cursor = state.Stb.select_start = state.Stb.select_end = pos;
+        clock_t t0 = clock();
+        if (n & 1)
+            BenchFrame(NULL, 1);
+        else
+            BenchFrame((rng & 0x100) ? "\n" : "x", -1);
+        clock_t t1 = clock();
+        BenchFrame(NULL, -1);
+        total_edit += t1 - t0;
+        total_idle += clock() - t1;
+    }
+    printf("%d MB%s%s%s: %.3f ms/edit, %.3f ms/idle frame\n", size_mb, local ? " local" : "", (BenchFlags & ImGuiInputTextFlags_CallbackAlways) ? " callback" : "", (BenchFlags & ImGuiInputTextFlags_IncrementalCopyBack) ? " incremental" : "",
+        (double)total_edit * 1000.0 / CLOCKS_PER_SEC / edits_count, (double)total_idle * 1000.0 / CLOCKS_PER_SEC / edits_count);
+
+    ImGui::DestroyContext();
+    free(BenchBuf);
+    return 0;
+}
@@ -0,0 +1,177 @@
+// dear imgui: benchmark and tests for ImGuiStorage (key->value storage used for tree node states, etc.)
+// - Insert: SetInt() on N new random hashed keys, one by one (e.g. first expansion of a tree with N nodes).
+// - Hit/Miss: GetInt() on present/absent keys.
+// - Bulk: Data.push_back() of all pairs then BuildSortByKey().
+// Each one is measured against a sorted vector with binary search and insertion in place (what 1.79 and earlier used),
+// and the results of both are checked against each other.
+// Inserting 1M keys one by one into the sorted vector takes minutes: it is only measured with --all.
+// Usage: storage [--all] [number of keys...], default 1000 100000 1000000
+// Build (from this folder):
+//   c++ -O2 -I../.. storage.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp -o storage
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Sorted vector storage, as in 1.79 and earlier
+struct StorageReference
+{
+    ImVector<ImGuiStorage::ImGuiStoragePair> Data;
+
+    ImGuiStorage::ImGuiStoragePair* LowerBound(ImGuiID key)
+    {
+        ImGuiStorage::ImGuiStoragePair* first = Data.Data;
+        size_t count = (size_t)Data.Size;
+        while (count > 0)
+        {
+            size_t count2 = count >> 1;
+            ImGuiStorage::ImGuiStoragePair* mid = first + count2;
+            if (mid->key < key) { first = ++mid; count -= count2 + 1; }
+            else                { count = count2; }
+        }
+        return first;
+    }
+    int GetInt(ImGuiID key, int default_val)
+    {
+        ImGuiStorage::ImGuiStoragePair* it = LowerBound(key);
+        return (it == Data.end() || it->key != key) ? default_val : it->val_i;
+    }
+    void SetInt(ImGuiID key, int val)
+    {
+        ImGuiStorage::ImGuiStoragePair* it = LowerBound(key);
+        if (it == Data.end() || it->key != key)
+            Data.insert(it, ImGuiStorage::ImGuiStoragePair(key, val));
+        else
+            it->val_i = val;
+    }
+};
+
+static ImU32 StorageTestRand(ImU32* state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state ^ (*state >> 15);
+}
+
+static int IMGUI_CDECL StorageTestComparePairs(const void* lhs, const void* rhs)
+{
+    ImGuiID a = ((const ImGuiStorage::ImGuiStoragePair*)lhs)->key, b = ((const ImGuiStorage::ImGuiStoragePair*)rhs)->key;
+    return a < b ? -1 : a > b ? +1 : 0;
+}
+
+static double StorageTestMs(clock_t t0)
+{
+    return (double)(clock() - t0) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+static int RunStorageTest(int keys_count, bool reference_insert)
+{
+    // Distinct random keys (like hashed IDs), and as many keys absent from the storage
+    ImVector<ImGuiID> keys, missing_keys;
+    {
+        ImGuiStorage seen;
+        ImU32 rand_state = (ImU32)keys_count;
+        while (keys.Size < keys_count || missing_keys.Size < keys_count)
+        {
+            ImGuiID key = StorageTestRand(&rand_state);
+            if (key == 0 || seen.GetInt(key) != 0)
+                continue;
+            seen.SetInt(key, 1);
+            (keys.Size < keys_count ? keys : missing_keys).push_back(key);
+        }
+    }
+    const int lookups_count = keys_count < 1000000 ? 1000000 : keys_count;
+    int errors = 0;
+    volatile int sink = 0;
+
+    // Insert
+    ImGuiStorage storage;
+    StorageReference reference;
+    clock_t t0 = clock();
+    for (int n = 0; n < keys_count; n++)
+        storage.SetInt(keys[n], n);
+    const double insert_ms = StorageTestMs(t0);
+    double insert_ms_reference = -1.0;
+    if (reference_insert)
+    {
+        t0 = clock();
+        for (int n = 0; n < keys_count; n++)
+            reference.SetInt(keys[n], n);
+        insert_ms_reference = StorageTestMs(t0);
+    }
+    else
+    {
+        for (int n = 0; n < keys_count; n++)
+            reference.Data.push_back(ImGuiStorage::ImGuiStoragePair(keys[n], n));
+        ImQsort(reference.Data.Data, (size_t)reference.Data.Size, sizeof(ImGuiStorage::ImGuiStoragePair), StorageTestComparePairs);
+    }
+
+    // Hit, Miss
+    double ns[2][2]; // [hit/miss][storage/reference]
+    for (int miss = 0; miss < 2; miss++)
+    {
+        const ImVector<ImGuiID>& lookup_keys = miss ? missing_keys : keys;
+        ImU32 rand_state = 1;
+        t0 = clock();
+        for (int n = 0; n < lookups_count; n++)
+            sink += storage.GetInt(lookup_keys[(int)(StorageTestRand(&rand_state) % (ImU32)keys_count)], -1);
+        ns[miss][0] = StorageTestMs(t0) * 1e6 / lookups_count;
+        rand_state = 1;
+        t0 = clock();
+        for (int n = 0; n < lookups_count; n++)
+            sink += reference.GetInt(lookup_keys[(int)(StorageTestRand(&rand_state) % (ImU32)keys_count)], -1);
+        ns[miss][1] = StorageTestMs(t0) * 1e6 / lookups_count;
+    }
+    for (int n = 0; n < keys_count; n++)
+    {
+        if (storage.GetInt(keys[n], -1) != n || reference.GetInt(keys[n], -1) != n)
+            errors++;
+        if (storage.GetInt(missing_keys[n], -1) != -1)
+            errors++;
+    }
+
+    // Bulk build
+    ImGuiStorage bulk;
+    t0 = clock();
+    for (int n = 0; n < keys_count; n++)
+        bulk.Data.push_back(ImGuiStorage::ImGuiStoragePair(keys[n], n));
+    bulk.BuildSortByKey();
+    const double bulk_ms = StorageTestMs(t0);
+    for (int n = 0; n < keys_count; n++)
+        if (bulk.GetInt(keys[n], -1) != n || bulk.Data[n].key != reference.Data[n].key)
+            errors++;
+
+    printf("%8d keys: insert all %10.2f ms", keys_count, insert_ms);
+    if (insert_ms_reference >= 0.0)
+        printf(" (sorted vector %10.2f ms)", insert_ms_reference);
+    else
+        printf(" (sorted vector  not measured)");
+    printf(", hit %6.1f ns (%6.1f ns), miss %6.1f ns (%6.1f ns), bulk build %8.2f ms, %d errors\n", ns[0][0], ns[0][1], ns[1][0], ns[1][1], bulk_ms, errors);
+    return errors;
+}
+
+int main(int argc, char** argv)
+{
+    bool all = false;
+    ImVector<int> keys_counts;
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--all") == 0)
+            all = true;
+        else if (atoi(argv[n]) > 0)
+            keys_counts.push_back(atoi(argv[n]));
+    }
+    if (keys_counts.Size == 0)
+    {
+        keys_counts.push_back(1000);
+        keys_counts.push_back(100000);
+        keys_counts.push_back(1000000);
+    }
+
+    int errors = 0;
+    for (int n = 0; n < keys_counts.Size; n++)
+        errors += RunStorageTest(keys_counts[n], all || keys_counts[n] <= 100000);
+    return errors > 0 ? 1 : 0;
+}